@@ -19,7 +19,7 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
-load("@rules_cc//cc:defs.bzl", "cc_library", "cc_test")
+load("@rules_cc//cc:defs.bzl", "cc_binary", "cc_library", "cc_test")
 load("//bazel:cc/defs.bzl", "sanitizer", violet_copts = "copts", violet_defines = "defines")
 load(":version.bzl", "DEVBUILD", "encode_as_int")
 
@@ -69,3 +69,21 @@ def violet_cc_test(
         size = size,
         **kwargs
     )
+
+def violet_cc_benchmark(
+        name,
+        deps = [],
+        copts = [],
+        linkopts = [],
+        **kwargs):
+    if "visibility" in kwargs:
+        fail("`visibility` in `violet_cc_benchmark`(%s) is not allowed" % name)
+
+    return cc_binary(
+        name = name,
+        deps = deps + ["@google_benchmark//:benchmark", "@google_benchmark//:benchmark_main"],
+        copts = copts + sanitizer["copts"],
+        linkopts = linkopts + sanitizer["linkopts"],
+        visibility = ["//visibility:public"],
+        **kwargs
+    )
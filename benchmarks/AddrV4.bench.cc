@@ -0,0 +1,173 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/IP/AddrV4.h>
+#include <violet/Networking/Socket/AddrV4.h>
+
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto corpus() -> Vec<String>
+{
+    std::mt19937 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    Vec<String> addrs;
+    addrs.reserve(4096);
+
+    for (UInt i = 0; i < 4096; ++i) {
+        addrs.push_back(ip::AddrV4::FromUInt32(static_cast<UInt32>(rng())).ToString());
+    }
+
+    return addrs;
+}
+
+void BM_FromStr(benchmark::State& state)
+{
+    auto inputs = corpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto result = ip::AddrV4::FromStr(inputs[idx++ % inputs.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Scanner-style garbage: every input is rejected, one of the error kinds each.
+void BM_FromStrInvalid(benchmark::State& state)
+{
+    Vec<String> inputs;
+    UInt i = 0;
+    for (const auto& input: corpus()) {
+        switch (i++ % 4) {
+        case 0:
+            inputs.push_back(input + ".1");
+            break;
+
+        case 1:
+            inputs.push_back(input.substr(0, input.rfind('.')));
+            break;
+
+        case 2:
+            inputs.push_back("300." + input.substr(input.find('.') + 1));
+            break;
+
+        default:
+            inputs.push_back(input + "x");
+            break;
+        }
+    }
+
+    UInt idx = 0;
+    for (auto _: state) {
+        auto result = ip::AddrV4::FromStr(inputs[idx++ % inputs.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Summing the octets lets the optimizer drop the `Result` entirely, but only if it can see into `FromStr`.
+void BM_FromStrOctetSum(benchmark::State& state)
+{
+    auto inputs = corpus();
+
+    for (auto _: state) {
+        UInt32 sum = 0;
+        for (const auto& input: inputs) {
+            if (auto result = ip::AddrV4::FromStr(input); result.Ok()) {
+                sum += result.Value().AsUInt32();
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(inputs.size()));
+}
+
+// A fixed-width input whose contents the optimizer can't see, but whose length it can: once inlined, the
+// length checks and the copy into the SIMD register are specialized for 15 bytes.
+void BM_FromStrKnownLength(benchmark::State& state)
+{
+    Array<char, 15> buf = { '1', '9', '2', '.', '1', '6', '8', '.', '1', '0', '0', '.', '2', '0', '0' };
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(buf);
+
+        auto result = ip::AddrV4::FromStr(Str(buf.data(), buf.size()));
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ToChars(benchmark::State& state)
+{
+    Vec<ip::AddrV4> addrs;
+    for (const auto& input: corpus()) {
+        addrs.push_back(ip::AddrV4::FromStr(input).Value());
+    }
+
+    Array<char, ip::AddrV4::kMaxStringLength> buf;
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto result = addrs[idx++ % addrs.size()].ToChars(buf.data(), buf.data() + buf.size());
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(buf.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SocketFromStr(benchmark::State& state)
+{
+    Vec<String> inputs;
+    for (const auto& input: corpus()) {
+        inputs.push_back(input + ":8080");
+    }
+
+    UInt idx = 0;
+    for (auto _: state) {
+        auto result = socket::AddrV4::FromStr(inputs[idx++ % inputs.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_FromStr);
+BENCHMARK(BM_FromStrInvalid);
+BENCHMARK(BM_FromStrOctetSum);
+BENCHMARK(BM_FromStrKnownLength);
+BENCHMARK(BM_ToChars);
+BENCHMARK(BM_SocketFromStr);
@@ -0,0 +1,214 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+#include <benchmark/benchmark.h>
+#include <violet/Networking/SocketAddress.h>
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// How the addresses of real clients are allocated, 65,536 of each. Sequential allocations are the
+// worst case for a weak hash, since neighbouring keys differ in only a few bits.
+enum struct Corpus : Int64 {
+    kV6Subnets, ///< the first 256 hosts of 256 neighbouring `/64`s, e.g. DHCPv6 pools per VLAN
+    kV6Hosts, ///< `::1` upwards within a single `/64`
+    kV6Prefixes, ///< `::1` of sequential `/48`s, like the routers of a provider's customers
+    kV4Hosts, ///< `10.0.0.0` upwards
+    kV4Ports ///< every port of one address, like the flows behind a NAT
+};
+
+constexpr UInt kKeys = 65'536;
+
+auto corpusV6(Corpus corpus) -> Vec<ip::AddrV6>
+{
+    Vec<ip::AddrV6> out;
+    out.reserve(kKeys);
+    for (UInt64 i = 0; i < kKeys; ++i) {
+        switch (corpus) {
+        case Corpus::kV6Subnets:
+            out.push_back(ip::AddrV6::FromWords(0x20010DB800000000 | (i >> 8), i & 0xFF));
+            break;
+
+        case Corpus::kV6Hosts:
+            out.push_back(ip::AddrV6::FromWords(0x20010DB800000000, i + 1));
+            break;
+
+        default:
+            out.push_back(ip::AddrV6::FromWords(0x2001000000000000 | (i << 16), 1));
+            break;
+        }
+    }
+
+    return out;
+}
+
+auto corpusV4(Corpus corpus) -> Vec<socket::AddrV4>
+{
+    Vec<socket::AddrV4> out;
+    out.reserve(kKeys);
+    for (UInt32 i = 0; i < kKeys; ++i) {
+        out.push_back(corpus == Corpus::kV4Hosts ? socket::AddrV4(ip::AddrV4::FromUInt32(0x0A000000 + i), 443)
+                                                 : socket::AddrV4(ip::AddrV4(203, 0, 113, 7), static_cast<UInt16>(i)));
+    }
+
+    return out;
+}
+
+// What `std::hash<ip::AddrV6>` used to be; there was no hash for socket addresses, and this is how
+// one is usually built from the hashes of the parts.
+struct XorShiftHash {
+    auto operator()(const ip::AddrV6& addr) const noexcept -> UInt
+    {
+        return std::hash<UInt64>{ }(addr.High64()) ^ (std::hash<UInt64>{ }(addr.Low64()) << 1);
+    }
+
+    auto operator()(const socket::AddrV4& addr) const noexcept -> UInt
+    {
+        return std::hash<UInt32>{ }(addr.Address.AsUInt32()) ^ (std::hash<UInt16>{ }(addr.Port) << 1);
+    }
+};
+
+struct StdHash {
+    template<typename T>
+    auto operator()(const T& value) const noexcept -> UInt
+    {
+        return std::hash<T>{ }(value);
+    }
+};
+
+struct AbslHash {
+    template<typename T>
+    auto operator()(const T& value) const noexcept -> UInt
+    {
+        return absl::Hash<T>{ }(value);
+    }
+};
+
+// the share of keys with a hash of their own, and the most keys in one bucket of a power-of-two table
+// of as many buckets as keys, indexed by the low bits like most open-addressing tables
+template<typename Hash, typename T>
+void distribution(benchmark::State& state, const Vec<T>& keys)
+{
+    std::unordered_set<UInt> distinct;
+    Vec<UInt32> buckets(kKeys);
+    for (const auto& key: keys) {
+        const UInt hash = Hash{ }(key);
+        distinct.insert(hash);
+        buckets[hash % kKeys]++;
+    }
+
+    state.counters["distinct"] = static_cast<double>(distinct.size()) / static_cast<double>(keys.size());
+    state.counters["max_bucket"] = *std::max_element(buckets.begin(), buckets.end());
+}
+
+// looks the keys up in random order in a `std::unordered_map`, which picks a bucket modulo a prime, or
+// in an `absl::flat_hash_map`, which picks one by the high bits of the hash
+template<template<typename...> typename Map, typename Hash, typename T>
+void lookup(benchmark::State& state, const Vec<T>& keys)
+{
+    Map<T, UInt, Hash> map;
+    for (UInt i = 0; i < keys.size(); ++i) {
+        map.emplace(keys[i], i);
+    }
+
+    Vec<T> queries = keys;
+    std::shuffle(queries.begin(), queries.end(), std::mt19937_64(0xF10)); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    UInt idx = 0;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(map.find(queries[idx++ % queries.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    distribution<Hash>(state, keys);
+}
+
+template<typename Hash>
+void BM_LookupV6(benchmark::State& state)
+{
+    lookup<std::unordered_map, Hash>(state, corpusV6(static_cast<Corpus>(state.range(0))));
+}
+
+template<typename Hash>
+void BM_FlatLookupV6(benchmark::State& state)
+{
+    lookup<absl::flat_hash_map, Hash>(state, corpusV6(static_cast<Corpus>(state.range(0))));
+}
+
+template<typename Hash>
+void BM_LookupV4(benchmark::State& state)
+{
+    lookup<std::unordered_map, Hash>(state, corpusV4(static_cast<Corpus>(state.range(0))));
+}
+
+template<typename Hash>
+void BM_HashV6(benchmark::State& state)
+{
+    const auto keys = corpusV6(Corpus::kV6Hosts);
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(Hash{ }(keys[idx++ % keys.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void v6Corpora(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("corpus");
+    for (auto corpus: { Corpus::kV6Subnets, Corpus::kV6Hosts, Corpus::kV6Prefixes }) {
+        bench->Arg(static_cast<Int64>(corpus));
+    }
+}
+
+void v4Corpora(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("corpus");
+    for (auto corpus: { Corpus::kV4Hosts, Corpus::kV4Ports }) {
+        bench->Arg(static_cast<Int64>(corpus));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_HashV6<XorShiftHash>);
+BENCHMARK(BM_HashV6<StdHash>);
+BENCHMARK(BM_HashV6<AbslHash>);
+BENCHMARK(BM_LookupV6<XorShiftHash>)->Apply(v6Corpora);
+BENCHMARK(BM_LookupV6<StdHash>)->Apply(v6Corpora);
+BENCHMARK(BM_LookupV6<AbslHash>)->Apply(v6Corpora);
+BENCHMARK(BM_FlatLookupV6<XorShiftHash>)->Apply(v6Corpora);
+BENCHMARK(BM_FlatLookupV6<StdHash>)->Apply(v6Corpora);
+BENCHMARK(BM_LookupV4<XorShiftHash>)->Apply(v4Corpora);
+BENCHMARK(BM_LookupV4<StdHash>)->Apply(v4Corpora);
+BENCHMARK(BM_LookupV4<AbslHash>)->Apply(v4Corpora);
@@ -0,0 +1,131 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/IP/BloomFilter.h>
+#include <violet/Networking/IP/CuckooFilter.h>
+#include <violet/Networking/IP/IPSetV4.h>
+
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// A million blocked addresses, queried with addresses that are almost never among them: the case a
+// filter in front of an exact set is for.
+constexpr UInt kEntries = 1'000'000;
+
+auto blocked() -> const Vec<AddrV4>&
+{
+    static const Vec<AddrV4> addresses = []() -> Vec<AddrV4> {
+        std::mt19937 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        Vec<AddrV4> out;
+        out.reserve(kEntries);
+        for (UInt i = 0; i < kEntries; ++i) {
+            out.push_back(AddrV4::FromUInt32(static_cast<UInt32>(rng())));
+        }
+
+        return out;
+    }();
+
+    return addresses;
+}
+
+auto queries() -> const Vec<AddrV4>&
+{
+    static const Vec<AddrV4> addresses = []() -> Vec<AddrV4> {
+        std::mt19937 rng(0xF10); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        Vec<AddrV4> out;
+        out.reserve(1 << 16);
+        for (UInt i = 0; i < (1 << 16); ++i) {
+            out.push_back(AddrV4::FromUInt32(static_cast<UInt32>(rng())));
+        }
+
+        return out;
+    }();
+
+    return addresses;
+}
+
+template<typename Filter>
+void query(benchmark::State& state, const Filter& filter)
+{
+    const auto& addresses = queries();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(filter.MayContain(addresses[idx++ % addresses.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bits/address"] = static_cast<double>(filter.MemoryUsage() * 8) / static_cast<double>(kEntries);
+}
+
+void BM_ExactSetV4(benchmark::State& state)
+{
+    IPSetV4::Builder builder;
+    for (const auto& address: blocked()) {
+        builder.Add(address, address);
+    }
+
+    const IPSetV4 set = builder.Build();
+    const auto& addresses = queries();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(set.Contains(addresses[idx++ % addresses.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bits/address"] = static_cast<double>(set.MemoryUsage() * 8) / static_cast<double>(kEntries);
+}
+
+void BM_BloomFilterV4(benchmark::State& state)
+{
+    BloomFilter<AddrV4> filter(kEntries, static_cast<UInt>(state.range(0)));
+    for (const auto& address: blocked()) {
+        filter.Insert(address);
+    }
+
+    query(state, filter);
+}
+
+void BM_CuckooFilterV4(benchmark::State& state)
+{
+    CuckooFilter<AddrV4> filter(kEntries);
+    for (const auto& address: blocked()) {
+        filter.Insert(address);
+    }
+
+    query(state, filter);
+}
+
+} // namespace
+
+BENCHMARK(BM_ExactSetV4);
+BENCHMARK(BM_BloomFilterV4)->Arg(8)->Arg(12)->Arg(16);
+BENCHMARK(BM_CuckooFilterV4);
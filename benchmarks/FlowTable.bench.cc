@@ -0,0 +1,196 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/FlowTable.h>
+
+#include <random>
+#include <unordered_map>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// A million live TCP flows from random clients to a handful of servers.
+constexpr UInt kFlows = 1'000'000;
+
+struct Connection {
+    UInt64 Packets = 0;
+    UInt64 Bytes = 0;
+};
+
+auto randomFlow(std::mt19937_64& rng) -> FlowKey
+{
+    const UInt64 bits = rng();
+    return { socket::AddrV4(ip::AddrV4::FromUInt32(static_cast<UInt32>(bits)), static_cast<UInt16>(bits >> 32)),
+        socket::AddrV4(ip::AddrV4(192, 0, 2, static_cast<UInt8>((bits >> 48) % 8)), 443), IPProtocol::kTCP };
+}
+
+auto flows() -> const Vec<FlowKey>&
+{
+    static const Vec<FlowKey> keys = []() -> Vec<FlowKey> {
+        std::mt19937_64 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        Vec<FlowKey> out;
+        out.reserve(kFlows);
+        for (UInt i = 0; i < kFlows; ++i) {
+            out.push_back(randomFlow(rng));
+        }
+
+        return out;
+    }();
+
+    return keys;
+}
+
+// packets of the live flows in random order, with one in eight of a flow that isn't tracked
+auto packets() -> const Vec<FlowKey>&
+{
+    static const Vec<FlowKey> keys = []() -> Vec<FlowKey> {
+        std::mt19937_64 rng(0xF10); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        Vec<FlowKey> out;
+        out.reserve(1 << 16);
+        for (UInt i = 0; i < (1 << 16); ++i) {
+            out.push_back(i % 8 == 0 ? randomFlow(rng) : flows()[rng() % kFlows]);
+        }
+
+        return out;
+    }();
+
+    return keys;
+}
+
+auto table() -> const FlowTable<Connection>&
+{
+    static const FlowTable<Connection> flowTable = []() -> FlowTable<Connection> {
+        FlowTable<Connection> out(kFlows);
+        for (const auto& key: flows()) {
+            out.Insert(key, { });
+        }
+
+        return out;
+    }();
+
+    return flowTable;
+}
+
+void BM_UnorderedMapGet(benchmark::State& state)
+{
+    std::unordered_map<FlowKey, Connection> map;
+    map.reserve(kFlows);
+    for (const auto& key: flows()) {
+        map.emplace(key, Connection{ });
+    }
+
+    const auto& keys = packets();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(map.find(keys[idx++ % keys.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FlowTableGet(benchmark::State& state)
+{
+    const auto& flowTable = table();
+    const auto& keys = packets();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(flowTable.Get(keys[idx++ % keys.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes/flow"] = static_cast<double>(flowTable.MemoryUsage()) / static_cast<double>(kFlows);
+}
+
+void BM_FlowTableGetMany(benchmark::State& state)
+{
+    const auto& flowTable = table();
+    const auto& keys = packets();
+    const auto batch = static_cast<UInt>(state.range(0));
+
+    Vec<const Connection*> values(batch);
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(flowTable.GetMany(Span<const FlowKey>(keys).subspan(idx, batch), values));
+        idx = (idx + batch) % (keys.size() - batch);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// flows that open and close: insert a new one, remove the oldest
+template<typename Map>
+void churn(benchmark::State& state, Map& map, auto remove)
+{
+    const auto& keys = flows();
+    for (UInt i = 0; i < kFlows / 2; ++i) {
+        map.insert_or_assign(keys[i], Connection{ });
+    }
+
+    UInt idx = 0;
+    for (auto _: state) {
+        map.insert_or_assign(keys[(idx + (kFlows / 2)) % kFlows], Connection{ });
+        remove(map, keys[idx % kFlows]);
+        idx++;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_UnorderedMapChurn(benchmark::State& state)
+{
+    std::unordered_map<FlowKey, Connection> map;
+    map.reserve(kFlows);
+
+    churn(state, map, [](auto& self, const FlowKey& key) -> void { self.erase(key); });
+}
+
+void BM_FlowTableChurn(benchmark::State& state)
+{
+    // `churn` is written against the `std::unordered_map` names
+    struct Adapter {
+        FlowTable<Connection> Table{ kFlows };
+
+        void insert_or_assign(const FlowKey& key, Connection value) // NOLINT(readability-identifier-naming)
+        {
+            this->Table.Insert(key, value);
+        }
+    } map;
+
+    churn(state, map, [](auto& self, const FlowKey& key) -> void { self.Table.Remove(key); });
+}
+
+} // namespace
+
+BENCHMARK(BM_UnorderedMapGet);
+BENCHMARK(BM_FlowTableGet);
+BENCHMARK(BM_FlowTableGetMany)->Arg(16)->Arg(64);
+BENCHMARK(BM_UnorderedMapChurn);
+BENCHMARK(BM_FlowTableChurn);
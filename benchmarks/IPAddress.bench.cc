@@ -0,0 +1,135 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/IPAddress.h>
+
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// ~60% IPv4 and ~40% IPv6, which is roughly what our edges see.
+auto mixedCorpus() -> Vec<String>
+{
+    std::mt19937 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    Vec<String> corpus;
+    corpus.reserve(4096);
+
+    for (UInt i = 0; i < 4096; ++i) {
+        if (rng() % 5 < 3) {
+            corpus.push_back(ip::AddrV4::FromUInt32(static_cast<UInt32>(rng())).ToString());
+        } else {
+            corpus.push_back(ip::AddrV6(0x2001, 0xdb8, static_cast<UInt16>(rng()), 0, 0, static_cast<UInt16>(rng()),
+                static_cast<UInt16>(rng()), static_cast<UInt16>(rng()))
+                    .ToString());
+        }
+    }
+
+    return corpus;
+}
+
+// What `IPAddress::FromStr` used to do: run the IPv4 parser and only then try IPv6.
+auto tryEachFamily(Str input) noexcept -> Optional<IPAddress>
+{
+    if (auto v4 = ip::AddrV4::FromStr(input); v4.Ok()) {
+        return IPAddress::V4(v4.Value());
+    }
+
+    if (auto v6 = ip::AddrV6::FromStr(input); v6.Ok()) {
+        return IPAddress::V6(v6.Value());
+    }
+
+    return Nothing;
+}
+
+void BM_FromStrMixed(benchmark::State& state)
+{
+    auto corpus = mixedCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto result = IPAddress::FromStr(corpus[idx++ % corpus.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_TryEachFamilyMixed(benchmark::State& state)
+{
+    auto corpus = mixedCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto result = tryEachFamily(corpus[idx++ % corpus.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ParseManyMixed(benchmark::State& state)
+{
+    auto corpus = mixedCorpus();
+    Vec<Str> inputs(corpus.begin(), corpus.end());
+
+    Vec<IPAddress> out(inputs.size(), IPAddress::V4(ip::AddrV4()));
+    Vec<IPAddress::ParseStatus> status(inputs.size());
+
+    for (auto _: state) {
+        auto parsed = IPAddress::ParseMany(inputs, out, status);
+        benchmark::DoNotOptimize(parsed);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(inputs.size()));
+}
+
+void BM_FromStrLoopMixed(benchmark::State& state)
+{
+    auto corpus = mixedCorpus();
+    Vec<IPAddress> out(corpus.size(), IPAddress::V4(ip::AddrV4()));
+
+    for (auto _: state) {
+        for (UInt i = 0; i < corpus.size(); ++i) {
+            if (auto result = IPAddress::FromStr(corpus[i]); result.Ok()) {
+                out[i] = result.Value();
+            }
+        }
+
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(corpus.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_FromStrMixed);
+BENCHMARK(BM_TryEachFamilyMixed);
+BENCHMARK(BM_ParseManyMixed);
+BENCHMARK(BM_FromStrLoopMixed);
@@ -0,0 +1,170 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/IP/IPSetV4.h>
+#include <violet/Networking/IP/IPSetV6.h>
+
+#include <algorithm>
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// A blocklist of two million random addresses and short ranges, like a feed of scanners and spammers.
+constexpr UInt kEntries = 2'000'000;
+
+auto blocklistV4() -> const IPSetV4&
+{
+    static const IPSetV4 set = []() -> IPSetV4 {
+        std::mt19937 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        IPSetV4::Builder builder;
+        for (UInt i = 0; i < kEntries; ++i) {
+            const auto first = static_cast<UInt32>(rng());
+            const UInt32 last = first + std::min<UInt32>(rng() % 16, ~first);
+            builder.Add(AddrV4::FromUInt32(first), AddrV4::FromUInt32(last));
+        }
+
+        return builder.Build();
+    }();
+
+    return set;
+}
+
+auto blocklistV6() -> const IPSetV6&
+{
+    static const IPSetV6 set = []() -> IPSetV6 {
+        std::mt19937_64 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        IPSetV6::Builder builder;
+        for (UInt i = 0; i < kEntries; ++i) {
+            // whole `/64`s within `2000::/3`, as blocking single addresses of a subnet is pointless
+            const UInt64 high = 0x2000'0000'0000'0000 | (rng() >> 3);
+            builder.Add(NetworkV6(AddrV6::FromWords(high, 0), 64));
+        }
+
+        return builder.Build();
+    }();
+
+    return set;
+}
+
+// half of the lookups hit a range, half miss
+template<typename Set>
+auto corpus(const Set& set, auto randomAddress) -> Vec<typename Set::Address>
+{
+    std::mt19937_64 rng(0xF10); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    Vec<typename Set::Range> ranges(set.begin(), set.end());
+    Vec<typename Set::Address> out;
+    out.reserve(1 << 16);
+    for (UInt i = 0; i < (1 << 16); ++i) {
+        out.push_back(i % 2 == 0 ? ranges[rng() % ranges.size()].First : randomAddress(rng));
+    }
+
+    return out;
+}
+
+// The usual approach: the same ranges sorted, searched with `std::upper_bound`.
+template<typename Set>
+void lookupSorted(benchmark::State& state, const Set& set, const Vec<typename Set::Address>& addresses)
+{
+    const Vec<typename Set::Range> ranges(set.begin(), set.end());
+    UInt idx = 0;
+
+    for (auto _: state) {
+        const auto& address = addresses[idx++ % addresses.size()];
+        auto it = std::upper_bound(ranges.begin(), ranges.end(), address,
+            [](const auto& addr, const auto& range) -> bool { return addr < range.First; });
+
+        benchmark::DoNotOptimize(it != ranges.begin() && address <= std::prev(it)->Last);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Set>
+void lookup(benchmark::State& state, const Set& set, const Vec<typename Set::Address>& addresses)
+{
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(set.Contains(addresses[idx++ % addresses.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes/range"] = static_cast<double>(set.MemoryUsage()) / static_cast<double>(set.Size());
+}
+
+auto randomV4(std::mt19937_64& rng) -> AddrV4
+{
+    return AddrV4::FromUInt32(static_cast<UInt32>(rng()));
+}
+
+auto randomV6(std::mt19937_64& rng) -> AddrV6
+{
+    return AddrV6::FromWords(0x2000'0000'0000'0000 | (rng() >> 3), rng());
+}
+
+void BM_ContainsSortedV4(benchmark::State& state)
+{
+    lookupSorted(state, blocklistV4(), corpus(blocklistV4(), randomV4));
+}
+
+void BM_ContainsV4(benchmark::State& state)
+{
+    lookup(state, blocklistV4(), corpus(blocklistV4(), randomV4));
+}
+
+void BM_ContainsSortedV6(benchmark::State& state)
+{
+    lookupSorted(state, blocklistV6(), corpus(blocklistV6(), randomV6));
+}
+
+void BM_ContainsV6(benchmark::State& state)
+{
+    lookup(state, blocklistV6(), corpus(blocklistV6(), randomV6));
+}
+
+void BM_UnionV4(benchmark::State& state)
+{
+    const auto& lhs = blocklistV4();
+    const IPSetV4 rhs = IPSetV4::Builder().Add(NetworkV4(AddrV4(10, 0, 0, 0), 8)).Build();
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(lhs.Union(rhs));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(lhs.Size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_ContainsSortedV4);
+BENCHMARK(BM_ContainsV4);
+BENCHMARK(BM_ContainsSortedV6);
+BENCHMARK(BM_ContainsV6);
+BENCHMARK(BM_UnionV4);
@@ -0,0 +1,157 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/IP/PrefixMapV4.h>
+
+#include <map>
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// A million prefixes shaped roughly like a full BGP table: mostly `/24`s, a tail of shorter
+// prefixes and a few longer ones.
+auto routeTable() -> const Vec<NetworkV4>&
+{
+    static const Vec<NetworkV4> networks = []() -> Vec<NetworkV4> {
+        std::mt19937 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        Vec<NetworkV4> out;
+        out.reserve(1'000'000);
+        for (UInt i = 0; i < 1'000'000; ++i) {
+            const UInt roll = rng() % 100;
+            UInt prefix = 24;
+            if (roll >= 95) {
+                prefix = 25 + (rng() % 8);
+            } else if (roll >= 60) {
+                prefix = 16 + (rng() % 8);
+            }
+
+            out.emplace_back(AddrV4::FromUInt32(static_cast<UInt32>(rng())), static_cast<UInt8>(prefix));
+        }
+
+        return out;
+    }();
+
+    return networks;
+}
+
+auto trafficCorpus() -> Vec<AddrV4>
+{
+    std::mt19937 rng(0xF10); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    Vec<AddrV4> corpus;
+    corpus.reserve(1 << 16);
+    for (UInt i = 0; i < (1 << 16); ++i) {
+        corpus.push_back(AddrV4::FromUInt32(static_cast<UInt32>(rng())));
+    }
+
+    return corpus;
+}
+
+auto prefixMap() -> const PrefixMapV4<UInt32>&
+{
+    static const PrefixMapV4<UInt32> map = []() -> PrefixMapV4<UInt32> {
+        PrefixMapV4<UInt32> out;
+        for (UInt32 i = 0; const auto& network: routeTable()) {
+            out.Insert(network, i++);
+        }
+
+        return out;
+    }();
+
+    return map;
+}
+
+// The usual ordered-map approach: probe the map once per prefix length, from the longest down.
+struct OrderedMapLpm final {
+    std::map<NetworkV4, UInt32> Routes;
+
+    [[nodiscard]] auto Lookup(AddrV4 address) const noexcept -> const UInt32*
+    {
+        for (UInt8 prefix = 33; prefix-- > 0;) {
+            if (auto it = this->Routes.find(NetworkV4(address, prefix)); it != this->Routes.end()) {
+                return &it->second;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+void BM_LookupOrderedMap(benchmark::State& state)
+{
+    static const OrderedMapLpm lpm = []() -> OrderedMapLpm {
+        OrderedMapLpm out;
+        for (UInt32 i = 0; const auto& network: routeTable()) {
+            out.Routes.emplace(network, i++);
+        }
+
+        return out;
+    }();
+
+    auto corpus = trafficCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(lpm.Lookup(corpus[idx++ % corpus.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Lookup(benchmark::State& state)
+{
+    const auto& map = prefixMap();
+    auto corpus = trafficCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(map.Lookup(corpus[idx++ % corpus.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LookupMany(benchmark::State& state)
+{
+    const auto& map = prefixMap();
+    auto corpus = trafficCorpus();
+    Vec<const UInt32*> values(corpus.size());
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(map.LookupMany(corpus, values));
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(corpus.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_LookupOrderedMap);
+BENCHMARK(BM_Lookup);
+BENCHMARK(BM_LookupMany);
@@ -0,0 +1,147 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/IP/PrefixMapV6.h>
+
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// 200k prefixes shaped roughly like a full IPv6 BGP table: ~30k allocations of `/29` to `/32` in the
+// RIR blocks, each announced as a whole and as more-specifics, mostly `/48`s.
+auto routeTable() -> const Vec<NetworkV6>&
+{
+    static const Vec<NetworkV6> networks = []() -> Vec<NetworkV6> {
+        std::mt19937_64 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+        constexpr Array<UInt64, 6> kRirBlocks = { 0x2001, 0x2400, 0x2600, 0x2800, 0x2a00, 0x2c00 };
+        Vec<UInt64> allocations(30'000);
+        for (auto& allocation: allocations) {
+            const UInt64 block = kRirBlocks[rng() % kRirBlocks.size()];
+            allocation = (block << 48) | ((rng() & (block == 0x2001 ? 0xFFFF : 0xFFFFF)) << 32);
+        }
+
+        Vec<NetworkV6> out;
+        out.reserve(200'000);
+        for (UInt i = 0; i < 200'000; ++i) {
+            const UInt64 allocation = allocations[rng() % allocations.size()];
+            const UInt roll = rng() % 100;
+
+            UInt prefix = 48;
+            if (roll < 15) {
+                prefix = 29 + (rng() % 4);
+            } else if (roll < 45) {
+                prefix = 33 + (rng() % 15);
+            } else if (roll >= 97) {
+                prefix = 49 + (rng() % 16);
+            }
+
+            out.emplace_back(AddrV6::FromWords(allocation | (rng() & 0xFFFFFFFF), rng()), static_cast<UInt8>(prefix));
+        }
+
+        return out;
+    }();
+
+    return networks;
+}
+
+// Traffic to addresses within the table, so that lookups walk down to the deeper nodes.
+auto trafficCorpus() -> Vec<AddrV6>
+{
+    std::mt19937_64 rng(0xF10); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    Vec<AddrV6> corpus;
+    corpus.reserve(1 << 16);
+    for (UInt i = 0; i < (1 << 16); ++i) {
+        const auto& network = routeTable()[rng() % routeTable().size()];
+        corpus.push_back(AddrV6::FromWords(network.Address().High64() | (rng() & 0xFFFF), rng()));
+    }
+
+    return corpus;
+}
+
+auto prefixMap() -> const PrefixMapV6<UInt32>&
+{
+    static const PrefixMapV6<UInt32> map = []() -> PrefixMapV6<UInt32> {
+        PrefixMapV6<UInt32> out;
+        for (UInt32 i = 0; const auto& network: routeTable()) {
+            out.Insert(network, i++);
+        }
+
+        return out;
+    }();
+
+    return map;
+}
+
+void BM_Insert(benchmark::State& state)
+{
+    for (auto _: state) {
+        PrefixMapV6<UInt32> map;
+        for (UInt32 i = 0; const auto& network: routeTable()) {
+            map.Insert(network, i++);
+        }
+
+        state.counters["bytes"] = static_cast<double>(map.MemoryUsage());
+        benchmark::DoNotOptimize(map);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(routeTable().size()));
+}
+
+void BM_Lookup(benchmark::State& state)
+{
+    const auto& map = prefixMap();
+    auto corpus = trafficCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(map.Lookup(corpus[idx++ % corpus.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LookupMany(benchmark::State& state)
+{
+    const auto& map = prefixMap();
+    auto corpus = trafficCorpus();
+    Vec<const UInt32*> values(corpus.size());
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(map.LookupMany(corpus, values));
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(corpus.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_Insert)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Lookup);
+BENCHMARK(BM_LookupMany);
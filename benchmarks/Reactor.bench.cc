@@ -0,0 +1,216 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/Socket/Reactor.h>
+
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// Small requests, like a cache's, so that the cost is mostly the server's system calls.
+constexpr UInt kPayload = 64;
+
+const auto kLocalhost = SocketAddress::V4({ ip::AddrV4::Localhost(), 0 });
+
+struct Echo final: socket::Reactor::Handler {
+    void OnData(socket::Reactor& reactor, socket::ConnectionId id, Span<const UInt8> data) override
+    {
+        reactor.Send(id, data);
+    }
+};
+
+// An echo server on its own thread, which counts the system calls it makes.
+struct Server {
+    socket::TcpListener Listener = std::move(socket::TcpListener::Bind(kLocalhost).Value());
+    std::atomic<bool> Stopped = false;
+    std::atomic<UInt64> Syscalls = 0;
+    std::atomic<bool> Failed = false;
+    std::thread Thread;
+
+    Server() = default;
+    Server(const Server&) = delete;
+    Server(Server&&) = delete;
+    auto operator=(const Server&) -> Server& = delete;
+    auto operator=(Server&&) -> Server& = delete;
+
+    ~Server()
+    {
+        this->Stopped = true;
+        if (this->Thread.joinable()) {
+            this->Thread.join();
+        }
+    }
+
+    // The reactor has to be made on the thread that uses it, since its ring only allows one.
+    void RunReactor()
+    {
+        this->Thread = std::thread([this] {
+            Echo echo;
+            auto reactor = socket::Reactor::Create(echo);
+            if (reactor.Err() || reactor.Value().Listen(this->Listener).Err()) {
+                this->Failed = true;
+                return;
+            }
+
+            auto& loop = reactor.Value();
+            while (!this->Stopped.load(std::memory_order_relaxed)) {
+                (void)loop.Poll(std::chrono::milliseconds(10));
+                this->Syscalls.store(loop.Statistics().Enters, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    // Level-triggered epoll: one `epoll_wait` per turn, then a `read` and a `write` per request.
+    void RunEpoll()
+    {
+        this->Thread = std::thread([this] {
+            const int epoll = ::epoll_create1(EPOLL_CLOEXEC);
+            std::unordered_map<int, socket::TcpStream> streams;
+            UInt64 syscalls = 0;
+
+            epoll_event event{ };
+            event.events = EPOLLIN;
+            event.data.fd = this->Listener.AsDescriptor().Get();
+            ::epoll_ctl(epoll, EPOLL_CTL_ADD, event.data.fd, &event);
+
+            Array<epoll_event, 64> events{ };
+            Array<UInt8, 4096> buffer{ };
+            while (!this->Stopped.load(std::memory_order_relaxed)) {
+                const int ready = ::epoll_wait(epoll, events.data(), static_cast<int>(events.size()), 10);
+                syscalls++;
+
+                for (int i = 0; i < ready; i++) {
+                    const int fd = events[i].data.fd;
+                    if (fd == this->Listener.AsDescriptor().Get()) {
+                        (void)this->Listener.AcceptAll([&](socket::TcpListener::Accepted&& accepted) {
+                            const int added = accepted.Stream.AsDescriptor().Get();
+
+                            epoll_event interest{ };
+                            interest.events = EPOLLIN;
+                            interest.data.fd = added;
+                            ::epoll_ctl(epoll, EPOLL_CTL_ADD, added, &interest);
+
+                            streams.emplace(added, std::move(accepted.Stream));
+                        });
+
+                        continue;
+                    }
+
+                    auto& stream = streams.at(fd);
+                    auto read = stream.Read(buffer);
+                    syscalls++;
+
+                    if (read.Ok() && read.Value() > 0) {
+                        (void)stream.Write(Span<const UInt8>(buffer.data(), read.Value()));
+                        syscalls++;
+                    } else if (read.Ok() || !read.Error().WouldBlock()) {
+                        streams.erase(fd);
+                    }
+                }
+
+                this->Syscalls.store(syscalls, std::memory_order_relaxed);
+            }
+
+            ::close(epoll);
+        });
+    }
+};
+
+// `state.range(0)` blocking clients that each send a request and wait for its echo, all at once.
+void echo(benchmark::State& state, Server& server)
+{
+    Vec<socket::TcpStream> clients;
+    for (Int64 i = 0; i < state.range(0); i++) {
+        clients.push_back(std::move(socket::TcpStream::Connect(server.Listener.LocalAddress().Value()).Value()));
+        (void)clients.back().SetNoDelay(true);
+    }
+
+    Array<UInt8, kPayload> request{ };
+    Array<UInt8, kPayload> response{ };
+
+    // make sure every connection was accepted before measuring
+    for (auto& client: clients) {
+        (void)client.Write(request);
+        for (UInt got = 0; got < kPayload;) {
+            got += client.Read(Span(response).subspan(got)).Value();
+        }
+    }
+
+    if (server.Failed) {
+        state.SkipWithError("io_uring is not available");
+        return;
+    }
+
+    const UInt64 before = server.Syscalls.load();
+    for (auto _: state) {
+        for (auto& client: clients) {
+            (void)client.Write(request);
+        }
+
+        for (auto& client: clients) {
+            for (UInt got = 0; got < kPayload;) {
+                auto read = client.Read(Span(response).subspan(got));
+                if (read.Err() || read.Value() == 0) {
+                    state.SkipWithError("the server closed the connection");
+                    return;
+                }
+
+                got += read.Value();
+            }
+        }
+    }
+
+    const auto requests = static_cast<double>(state.iterations() * state.range(0));
+    state.SetItemsProcessed(static_cast<Int64>(requests));
+    state.counters["syscalls/request"] = static_cast<double>(server.Syscalls.load() - before) / requests;
+}
+
+void BM_EchoEpoll(benchmark::State& state)
+{
+    Server server;
+    server.RunEpoll();
+
+    echo(state, server);
+}
+
+void BM_EchoReactor(benchmark::State& state)
+{
+    Server server;
+    server.RunReactor();
+
+    echo(state, server);
+}
+
+} // namespace
+
+BENCHMARK(BM_EchoEpoll)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+BENCHMARK(BM_EchoReactor)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
@@ -0,0 +1,196 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/IP/PrefixMapV4.h>
+#include <violet/Networking/IP/SnapshotCell.h>
+
+#include <memory>
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto makeAcl() -> PrefixMapV4<UInt32>
+{
+    std::mt19937 rng(0xAC1); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    PrefixMapV4<UInt32> acl;
+    for (UInt32 i = 0; i < 100'000; ++i) {
+        acl.Insert(NetworkV4(AddrV4::FromUInt32(static_cast<UInt32>(rng())), static_cast<UInt8>(16 + (rng() % 9))), i);
+    }
+
+    return acl;
+}
+
+auto trafficCorpus() -> Vec<AddrV4>
+{
+    std::mt19937 rng(0xF10); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    Vec<AddrV4> corpus;
+    corpus.reserve(1 << 16);
+    for (UInt i = 0; i < (1 << 16); ++i) {
+        corpus.push_back(AddrV4::FromUInt32(static_cast<UInt32>(rng())));
+    }
+
+    return corpus;
+}
+
+auto snapshotCell() -> SnapshotCell<PrefixMapV4<UInt32>>&
+{
+    static SnapshotCell<PrefixMapV4<UInt32>> cell(makeAcl());
+    return cell;
+}
+
+auto sharedAcl() -> std::shared_ptr<const PrefixMapV4<UInt32>>&
+{
+    static std::shared_ptr<const PrefixMapV4<UInt32>> acl = std::make_shared<const PrefixMapV4<UInt32>>(makeAcl());
+    return acl;
+}
+
+// The lookup without any synchronization, which is what the other two are compared to.
+void BM_LookupUnsynchronized(benchmark::State& state)
+{
+    static const PrefixMapV4<UInt32> acl = makeAcl();
+    auto corpus = trafficCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        benchmark::DoNotOptimize(acl.Lookup(corpus[idx++ % corpus.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// A guard per lookup, the finest granularity a worker would use.
+void BM_LookupSnapshotCell(benchmark::State& state)
+{
+    auto reader = snapshotCell().Register();
+    auto corpus = trafficCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto acl = reader.Read();
+        benchmark::DoNotOptimize(acl->Lookup(corpus[idx++ % corpus.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// The usual alternative: an atomic `shared_ptr`, whose reference count every reader writes to.
+void BM_LookupAtomicSharedPtr(benchmark::State& state)
+{
+    auto corpus = trafficCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto acl = std::atomic_load(&sharedAcl());
+        benchmark::DoNotOptimize(acl->Lookup(corpus[idx++ % corpus.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Guards while another thread publishes a new snapshot every millisecond.
+void BM_LookupWhilePublishing(benchmark::State& state)
+{
+    static SnapshotCell<PrefixMapV4<UInt32>> cell(makeAcl());
+    static const PrefixMapV4<UInt32> next = makeAcl();
+
+    std::atomic<bool> done = false;
+    std::thread writer([&]() {
+        while (!done.load(std::memory_order_relaxed)) {
+            cell.Publish(next);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    auto reader = cell.Register();
+    auto corpus = trafficCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto acl = reader.Read();
+        benchmark::DoNotOptimize(acl->Lookup(corpus[idx++ % corpus.size()]));
+    }
+
+    done = true;
+    writer.join();
+    state.SetItemsProcessed(state.iterations());
+}
+
+// A threat-feed-sized delta: 16 networks that every other delta adds and the next one removes.
+auto feedDeltas() -> std::pair<PrefixMapV4<UInt32>::Delta, PrefixMapV4<UInt32>::Delta>
+{
+    std::mt19937 rng(0xDE17A); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    PrefixMapV4<UInt32>::Delta add;
+    PrefixMapV4<UInt32>::Delta remove;
+    for (UInt32 i = 0; i < 16; ++i) {
+        const NetworkV4 network(AddrV4::FromUInt32(static_cast<UInt32>(rng())), 32);
+        add.Insert(network, i);
+        remove.Remove(network);
+    }
+
+    return { add, remove };
+}
+
+// The delta applied to a copy of the table, i.e. `Update`.
+void BM_ApplyDeltaToCopy(benchmark::State& state)
+{
+    SnapshotCell<PrefixMapV4<UInt32>> cell(makeAcl());
+    const auto [add, remove] = feedDeltas();
+
+    for (UInt i = 0; auto _: state) {
+        const auto& delta = (i++ % 2 == 0) ? add : remove;
+        cell.Update([&](PrefixMapV4<UInt32>& map) { map.Apply(delta); });
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// The delta applied in place with `Modify`, which applies it twice, once to each copy.
+void BM_ApplyDeltaInPlace(benchmark::State& state)
+{
+    SnapshotCell<PrefixMapV4<UInt32>> cell(makeAcl());
+    const auto [add, remove] = feedDeltas();
+    cell.Modify([](PrefixMapV4<UInt32>&) {});
+
+    for (UInt i = 0; auto _: state) {
+        const auto& delta = (i++ % 2 == 0) ? add : remove;
+        cell.Modify([&delta](PrefixMapV4<UInt32>& map) { map.Apply(delta); });
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_LookupUnsynchronized)->Threads(1)->Threads(4);
+BENCHMARK(BM_LookupSnapshotCell)->Threads(1)->Threads(4);
+BENCHMARK(BM_LookupAtomicSharedPtr)->Threads(1)->Threads(4);
+BENCHMARK(BM_LookupWhilePublishing);
+BENCHMARK(BM_ApplyDeltaToCopy)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApplyDeltaInPlace)->Unit(benchmark::kMicrosecond);
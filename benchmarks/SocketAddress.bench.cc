@@ -0,0 +1,227 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/SocketAddress.h>
+
+#include <arpa/inet.h>
+
+#include <format>
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// ~60% IPv4 and ~40% IPv6 socket addresses.
+auto mixedCorpus() -> Vec<String>
+{
+    std::mt19937 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    Vec<String> corpus;
+    corpus.reserve(4096);
+
+    for (UInt i = 0; i < 4096; ++i) {
+        auto port = static_cast<UInt16>(rng());
+        if (rng() % 5 < 3) {
+            corpus.push_back(socket::AddrV4(ip::AddrV4::FromUInt32(static_cast<UInt32>(rng())), port).ToString());
+        } else {
+            ip::AddrV6 address(0x2001, 0xdb8, static_cast<UInt16>(rng()), 0, 0, static_cast<UInt16>(rng()),
+                static_cast<UInt16>(rng()), static_cast<UInt16>(rng()));
+
+            corpus.push_back(socket::AddrV6(address, port).ToString());
+        }
+    }
+
+    return corpus;
+}
+
+// What `SocketAddress::FromStr` used to do: run the IPv4 parser and only then try IPv6.
+auto tryEachFamily(Str input) noexcept -> Optional<SocketAddress>
+{
+    if (auto v4 = socket::AddrV4::FromStr(input); v4.Ok()) {
+        return SocketAddress::V4(v4.Value());
+    }
+
+    if (auto v6 = socket::AddrV6::FromStr(input); v6.Ok()) {
+        return SocketAddress::V6(v6.Value());
+    }
+
+    return Nothing;
+}
+
+void BM_FromStrMixed(benchmark::State& state)
+{
+    auto corpus = mixedCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto result = SocketAddress::FromStr(corpus[idx++ % corpus.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_TryEachFamilyMixed(benchmark::State& state)
+{
+    auto corpus = mixedCorpus();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto result = tryEachFamily(corpus[idx++ % corpus.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+auto mixedAddresses() -> Vec<SocketAddress>
+{
+    Vec<SocketAddress> addresses;
+    for (const auto& text: mixedCorpus()) {
+        addresses.push_back(SocketAddress::FromStr(text).Value());
+    }
+
+    return addresses;
+}
+
+// What converting to a `sockaddr` looks like without `ToSockAddr`: format the address and hand the
+// text to `inet_pton`.
+auto toSockAddrViaText(const SocketAddress& address, sockaddr_storage& out) noexcept -> socklen_t
+{
+    out = sockaddr_storage{ };
+    if (auto v4 = address.AsV4()) {
+        const socket::AddrV4& addr = v4.Unwrap();
+        auto& in = reinterpret_cast<sockaddr_in&>(out); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        in.sin_family = AF_INET;
+        in.sin_port = htons(addr.Port);
+        inet_pton(AF_INET, addr.Address.ToString().c_str(), &in.sin_addr);
+
+        return sizeof(sockaddr_in);
+    }
+
+    const socket::AddrV6& addr = address.AsV6().Unwrap();
+    auto& in6 = reinterpret_cast<sockaddr_in6&>(out); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    in6.sin6_family = AF_INET6;
+    in6.sin6_port = htons(addr.Port);
+    inet_pton(AF_INET6, addr.Address.ToString().c_str(), &in6.sin6_addr);
+
+    return sizeof(sockaddr_in6);
+}
+
+// ...and back: `inet_ntop` the address, then parse the text along with the port.
+auto fromSockAddrViaText(const sockaddr_storage& storage) noexcept -> Optional<SocketAddress>
+{
+    Array<char, INET6_ADDRSTRLEN> buf{ };
+    if (storage.ss_family == AF_INET) {
+        const auto& in = reinterpret_cast<const sockaddr_in&>(storage); // NOLINT
+        inet_ntop(AF_INET, &in.sin_addr, buf.data(), buf.size());
+
+        return SocketAddress::Parse(std::format("{}:{}", buf.data(), ntohs(in.sin_port)));
+    }
+
+    const auto& in6 = reinterpret_cast<const sockaddr_in6&>(storage); // NOLINT
+    inet_ntop(AF_INET6, &in6.sin6_addr, buf.data(), buf.size());
+
+    return SocketAddress::Parse(std::format("[{}]:{}", buf.data(), ntohs(in6.sin6_port)));
+}
+
+void BM_ToSockAddr(benchmark::State& state)
+{
+    auto addresses = mixedAddresses();
+    sockaddr_storage storage{ };
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto length = addresses[idx++ % addresses.size()].ToSockAddr(storage);
+        benchmark::DoNotOptimize(length);
+        benchmark::DoNotOptimize(storage);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ToSockAddrViaText(benchmark::State& state)
+{
+    auto addresses = mixedAddresses();
+    sockaddr_storage storage{ };
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto length = toSockAddrViaText(addresses[idx++ % addresses.size()], storage);
+        benchmark::DoNotOptimize(length);
+        benchmark::DoNotOptimize(storage);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+auto mixedSockAddrs() -> Vec<sockaddr_storage>
+{
+    Vec<sockaddr_storage> storages;
+    for (const auto& address: mixedAddresses()) {
+        address.ToSockAddr(storages.emplace_back());
+    }
+
+    return storages;
+}
+
+void BM_FromSockAddr(benchmark::State& state)
+{
+    auto storages = mixedSockAddrs();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        const auto& storage = storages[idx++ % storages.size()];
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto result = SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&storage), sizeof(storage));
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FromSockAddrViaText(benchmark::State& state)
+{
+    auto storages = mixedSockAddrs();
+    UInt idx = 0;
+
+    for (auto _: state) {
+        auto result = fromSockAddrViaText(storages[idx++ % storages.size()]);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_FromStrMixed);
+BENCHMARK(BM_TryEachFamilyMixed);
+BENCHMARK(BM_ToSockAddr);
+BENCHMARK(BM_ToSockAddrViaText);
+BENCHMARK(BM_FromSockAddr);
+BENCHMARK(BM_FromSockAddrViaText);
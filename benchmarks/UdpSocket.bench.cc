@@ -0,0 +1,208 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Networking/Socket/UdpSocket.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// Small datagrams, like telemetry samples, so that the per-datagram cost is mostly the system call.
+constexpr UInt kPayload = 64;
+constexpr UInt kBatch = socket::UdpSocket::kMaxBatch;
+
+struct Loopback {
+    socket::UdpSocket Receiver;
+    socket::UdpSocket Sender;
+
+    static auto Open() -> Loopback
+    {
+        const auto localhost = SocketAddress::V4({ ip::AddrV4::Localhost(), 0 });
+
+        auto receiver = std::move(socket::UdpSocket::Bind(localhost).Value());
+        auto sender = std::move(socket::UdpSocket::Bind(localhost).Value());
+        (void)sender.Connect(receiver.LocalAddress().Value());
+        (void)receiver.SetReceiveBufferSize(4 << 20);
+
+        return { std::move(receiver), std::move(sender) };
+    }
+};
+
+// One `sendto` and one `recvfrom` per datagram.
+void BM_SendToRecvFrom(benchmark::State& state)
+{
+    auto loop = Loopback::Open();
+    const auto to = loop.Receiver.LocalAddress().Value();
+
+    Array<UInt8, kPayload> payload{ };
+    Array<UInt8, 2048> buffer{ };
+    auto peer = SocketAddress::V4({ });
+
+    for (auto _: state) {
+        for (UInt i = 0; i < kBatch; i++) {
+            (void)loop.Sender.SendTo(payload, to);
+        }
+
+        for (UInt i = 0; i < kBatch; i++) {
+            benchmark::DoNotOptimize(loop.Receiver.RecvFrom(buffer, peer));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<Int64>(state.iterations() * kBatch));
+}
+
+// One `sendmmsg` and one `recvmmsg` per batch.
+void BM_SendManyRecvMany(benchmark::State& state)
+{
+    auto loop = Loopback::Open();
+    const auto to = loop.Receiver.LocalAddress().Value();
+
+    Array<UInt8, kPayload> payload{ };
+    Array<Span<const UInt8>, kBatch> datagrams;
+    datagrams.fill(payload);
+    Vec<SocketAddress> peers(kBatch, to);
+
+    Vec<Array<UInt8, 2048>> storage(kBatch);
+    Array<Span<UInt8>, kBatch> buffers;
+    for (UInt i = 0; i < kBatch; i++) {
+        buffers[i] = storage[i];
+    }
+
+    Array<UInt, kBatch> sizes{ };
+    Vec<SocketAddress> from(kBatch, to);
+
+    for (auto _: state) {
+        for (UInt sent = 0; sent < kBatch;) {
+            sent += loop.Sender.SendMany(Span(datagrams).subspan(sent), Span(peers).subspan(sent)).Value();
+        }
+
+        for (UInt received = 0; received < kBatch;) {
+            received += loop.Receiver
+                            .RecvMany(Span(buffers).subspan(received), Span(sizes).subspan(received),
+                                Span(from).subspan(received))
+                            .Value();
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<Int64>(state.iterations() * kBatch));
+}
+
+// Bulk transfers, like a QUIC connection sending as fast as it can: MTU-sized datagrams, as many as
+// one GSO buffer can hold.
+constexpr UInt kSegment = 1200;
+constexpr UInt kSegments = 48;
+
+void BM_BulkSendToRecvFrom(benchmark::State& state)
+{
+    auto loop = Loopback::Open();
+    const auto to = loop.Receiver.LocalAddress().Value();
+
+    Array<UInt8, kSegment> payload{ };
+    Array<UInt8, 2048> buffer{ };
+    auto peer = SocketAddress::V4({ });
+
+    for (auto _: state) {
+        for (UInt i = 0; i < kSegments; i++) {
+            (void)loop.Sender.SendTo(payload, to);
+        }
+
+        for (UInt i = 0; i < kSegments; i++) {
+            benchmark::DoNotOptimize(loop.Receiver.RecvFrom(buffer, peer));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<Int64>(state.iterations() * kSegments));
+    state.SetBytesProcessed(static_cast<Int64>(state.iterations() * kSegments * kSegment));
+}
+
+void BM_BulkSendManyRecvMany(benchmark::State& state)
+{
+    auto loop = Loopback::Open();
+
+    Array<UInt8, kSegment> payload{ };
+    Array<Span<const UInt8>, kSegments> datagrams;
+    datagrams.fill(payload);
+
+    Vec<Array<UInt8, 2048>> storage(kSegments);
+    Array<Span<UInt8>, kSegments> buffers;
+    for (UInt i = 0; i < kSegments; i++) {
+        buffers[i] = storage[i];
+    }
+
+    Array<UInt, kSegments> sizes{ };
+    Vec<SocketAddress> from(kSegments, SocketAddress::V4({ }));
+
+    for (auto _: state) {
+        for (UInt sent = 0; sent < kSegments;) {
+            sent += loop.Sender.SendMany(Span(datagrams).subspan(sent)).Value();
+        }
+
+        for (UInt received = 0; received < kSegments;) {
+            received += loop.Receiver
+                            .RecvMany(Span(buffers).subspan(received), Span(sizes).subspan(received),
+                                Span(from).subspan(received))
+                            .Value();
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<Int64>(state.iterations() * kSegments));
+    state.SetBytesProcessed(static_cast<Int64>(state.iterations() * kSegments * kSegment));
+}
+
+// One `sendmsg` with `UDP_SEGMENT` for all of them, and as few `recvmsg`s as GRO coalesces them into.
+void BM_BulkGsoGro(benchmark::State& state)
+{
+    auto loop = Loopback::Open();
+    if (loop.Receiver.SetGro(true).Err()) {
+        state.SkipWithError("UDP GRO isn't supported");
+        return;
+    }
+
+    Vec<UInt8> payload(kSegment * kSegments);
+    Vec<UInt8> buffer(65536);
+    auto peer = SocketAddress::V4({ });
+
+    for (auto _: state) {
+        if (loop.Sender.SendSegmented(payload, kSegment).Err()) {
+            state.SkipWithError("UDP GSO isn't supported");
+            return;
+        }
+
+        for (UInt received = 0; received < payload.size();) {
+            received += loop.Receiver.RecvSegmented(buffer, peer).Value().Data.size();
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<Int64>(state.iterations() * kSegments));
+    state.SetBytesProcessed(static_cast<Int64>(state.iterations() * kSegments * kSegment));
+}
+
+} // namespace
+
+BENCHMARK(BM_SendToRecvFrom);
+BENCHMARK(BM_SendManyRecvMany);
+BENCHMARK(BM_BulkSendToRecvFrom);
+BENCHMARK(BM_BulkSendManyRecvMany);
+BENCHMARK(BM_BulkGsoGro);
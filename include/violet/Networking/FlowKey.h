@@ -0,0 +1,221 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/FixedHash.h>
+#include <violet/Networking/SocketAddress.h>
+
+#include <type_traits>
+
+namespace violet::net {
+
+/// The IP protocol number of a flow: the next-header field of an IPv6 packet, or the protocol field of
+/// an IPv4 one. Values that aren't listed here are valid as well.
+enum struct IPProtocol : UInt8 {
+    kICMP = 1, ///< Internet Control Message Protocol
+    kTCP = 6, ///< Transmission Control Protocol
+    kUDP = 17, ///< User Datagram Protocol
+    kICMPv6 = 58, ///< ICMP for IPv6
+    kSCTP = 132 ///< Stream Control Transmission Protocol
+};
+
+/// Identifies a flow by its source and destination socket addresses and its protocol, the 5-tuple that
+/// a connection table is keyed by.
+///
+/// Unlike a pair of [`SocketAddress`]es, it has a fixed layout of 48 bytes without padding: both
+/// addresses are stored as 128 bits, IPv4 ones in the low 32, followed by the scope ids of IPv6 ones,
+/// the ports, the protocol and the family. Keys are compared as 6 words and hashed with `FixedHash`
+/// without looking at the family first. The scope id keeps flows of the same link-local address on two
+/// interfaces (`fe80::1%2` and `fe80::1%3`) apart; the flow information of an IPv6 address isn't kept,
+/// just like it isn't part of [`socket::AddrV6`]'s identity.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/FlowKey.h>
+///
+/// using namespace violet::net::literals;
+///
+/// constexpr violet::net::FlowKey key(
+///     "10.0.0.1:49152"_sockaddr, "10.0.0.2:443"_sockaddr, violet::net::IPProtocol::kTCP);
+/// static_assert(key.Reversed().Source() == "10.0.0.2:443"_sockaddr);
+/// ```
+struct FlowKey final {
+    /// Constructs the key of the flow from `source` to `destination`, which must be of the same family.
+    constexpr VIOLET_IMPLICIT FlowKey(
+        const SocketAddress& source, const SocketAddress& destination, IPProtocol protocol) noexcept
+    {
+        VIOLET_DEBUG_ASSERT(source.TypeOf() == destination.TypeOf(), "a flow can't mix IPv4 and IPv6 addresses");
+
+        if (source.TypeOf() == SocketAddress::Type::V4) {
+            *this = FlowKey(source.AsV4Unchecked(Unsafe("checked the type")),
+                destination.AsV4Unchecked(Unsafe("checked in debug builds")), protocol);
+        } else {
+            *this = FlowKey(source.AsV6Unchecked(Unsafe("checked the type")),
+                destination.AsV6Unchecked(Unsafe("checked in debug builds")), protocol);
+        }
+    }
+
+    /// Constructs the key of the IPv4 flow from `source` to `destination`.
+    constexpr VIOLET_IMPLICIT FlowKey(socket::AddrV4 source, socket::AddrV4 destination, IPProtocol protocol) noexcept
+        : n_source{ 0, source.Address.AsUInt32() }
+        , n_destination{ 0, destination.Address.AsUInt32() }
+        , n_sourcePort(source.Port)
+        , n_destinationPort(destination.Port)
+        , n_protocol(protocol)
+        , n_type(SocketAddress::Type::V4)
+    {
+    }
+
+    /// Constructs the key of the IPv6 flow from `source` to `destination`.
+    constexpr VIOLET_IMPLICIT FlowKey(
+        const socket::AddrV6& source, const socket::AddrV6& destination, IPProtocol protocol) noexcept
+        : n_source{ source.Address.High64(), source.Address.Low64() }
+        , n_destination{ destination.Address.High64(), destination.Address.Low64() }
+        , n_sourceScope(source.ScopeId)
+        , n_destinationScope(destination.ScopeId)
+        , n_sourcePort(source.Port)
+        , n_destinationPort(destination.Port)
+        , n_protocol(protocol)
+        , n_type(SocketAddress::Type::V6)
+    {
+    }
+
+    [[nodiscard]] constexpr auto TypeOf() const noexcept -> SocketAddress::Type
+    {
+        return this->n_type;
+    }
+
+    [[nodiscard]] constexpr auto Source() const noexcept -> SocketAddress
+    {
+        return this->address(this->n_source, this->n_sourceScope, this->n_sourcePort);
+    }
+
+    [[nodiscard]] constexpr auto Destination() const noexcept -> SocketAddress
+    {
+        return this->address(this->n_destination, this->n_destinationScope, this->n_destinationPort);
+    }
+
+    [[nodiscard]] constexpr auto Protocol() const noexcept -> IPProtocol
+    {
+        return this->n_protocol;
+    }
+
+    /// Returns the key of the flow in the other direction, from the destination back to the source.
+    [[nodiscard]] constexpr auto Reversed() const noexcept -> FlowKey
+    {
+        FlowKey key = *this;
+        std::swap(key.n_source, key.n_destination);
+        std::swap(key.n_sourceScope, key.n_destinationScope);
+        std::swap(key.n_sourcePort, key.n_destinationPort);
+
+        return key;
+    }
+
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const FlowKey& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    constexpr friend auto operator==(const FlowKey& lhs, const FlowKey& rhs) noexcept -> bool = default;
+
+    /// Returns a 64-bit hash of `key` that, like the overloads for addresses, is the same everywhere. The
+    /// two addresses are folded by 128-bit multiplications and the result is mixed once, so it costs
+    /// about as much as hashing a single IPv6 address.
+    friend constexpr auto FixedHash(const FlowKey& key, UInt64 seed = 0) noexcept -> UInt64
+    {
+        const UInt64 addresses = fold(key.n_source[0] ^ 0x243F6A8885A308D3, key.n_destination[0] ^ 0x13198A2E03707344)
+            ^ fold(key.n_source[1] ^ 0xA4093822299F31D0, key.n_destination[1] ^ 0x082EFA98EC4E6C89);
+        const UInt64 rest = UInt64(key.n_sourcePort) | (UInt64(key.n_destinationPort) << 16)
+            | (UInt64(key.n_protocol) << 32) | (UInt64(key.n_type) << 40);
+
+        // folds to zero for the unscoped addresses of almost every flow, which hash like they did before
+        const UInt64 scopes = fold(UInt64(key.n_sourceScope) | (UInt64(key.n_destinationScope) << 32),
+            0x452821E638D01377);
+
+        return ip::detail::Mix64(addresses ^ scopes ^ rest ^ (seed * ip::detail::kSeedMultiplier));
+    }
+
+    template<typename H>
+    friend auto AbslHashValue(H state, const FlowKey& key) -> H
+    {
+        return H::combine(std::move(state), key.n_source, key.n_destination, key.n_sourceScope,
+            key.n_destinationScope, key.n_sourcePort, key.n_destinationPort, key.n_protocol, key.n_type);
+    }
+
+private:
+    // the two halves of the 128-bit product, xor-ed; `absl::uint128` can't multiply in constant expressions
+    constexpr static auto fold(UInt64 lhs, UInt64 rhs) noexcept -> UInt64
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using Wide = unsigned __int128;
+
+        const Wide product = static_cast<Wide>(lhs) * rhs;
+        return static_cast<UInt64>(product >> 64) ^ static_cast<UInt64>(product);
+#else
+        constexpr UInt64 kLow = 0xFFFFFFFF;
+
+        const UInt64 lowLow = (lhs & kLow) * (rhs & kLow);
+        const UInt64 highLow = (lhs >> 32) * (rhs & kLow);
+        const UInt64 lowHigh = (lhs & kLow) * (rhs >> 32);
+        const UInt64 cross = (lowLow >> 32) + (highLow & kLow) + lowHigh;
+
+        const UInt64 high = ((lhs >> 32) * (rhs >> 32)) + (highLow >> 32) + (cross >> 32);
+        return high ^ ((cross << 32) | (lowLow & kLow));
+#endif
+    }
+
+    [[nodiscard]] constexpr auto address(const Array<UInt64, 2>& bits, UInt32 scope, UInt16 port) const noexcept
+        -> SocketAddress
+    {
+        if (this->n_type == SocketAddress::Type::V4) {
+            return SocketAddress::V4({ ip::AddrV4::FromUInt32(static_cast<UInt32>(bits[1])), port });
+        }
+
+        return SocketAddress::V6({ ip::AddrV6::FromWords(bits[0], bits[1]), port, 0, scope });
+    }
+
+    Array<UInt64, 2> n_source{ };
+    Array<UInt64, 2> n_destination{ };
+    UInt32 n_sourceScope = 0; // always 0 for IPv4
+    UInt32 n_destinationScope = 0;
+    UInt16 n_sourcePort = 0;
+    UInt16 n_destinationPort = 0;
+    IPProtocol n_protocol{ };
+    SocketAddress::Type n_type{ };
+    UInt16 n_reserved = 0; // spelled out so that the key has no padding bytes
+};
+
+static_assert(sizeof(FlowKey) == 48);
+static_assert(std::has_unique_object_representations_v<FlowKey>);
+
+} // namespace violet::net
+
+VIOLET_FORMATTER(violet::net::FlowKey);
+
+template<>
+struct std::hash<violet::net::FlowKey> final {
+    auto operator()(const violet::net::FlowKey& key) const noexcept -> violet::UInt
+    {
+        return FixedHash(key);
+    }
+};
@@ -0,0 +1,560 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Networking/FlowKey.h>
+
+#include <bit>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace violet::net {
+
+namespace detail {
+
+/// The control bytes of 15 slots of a [`FlowTable`]: a tag for each slot, which is **0** if the slot is
+/// empty and 7 bits of the key's hash otherwise, followed by the number of keys that were inserted
+/// past the group because it was full.
+///
+/// That count is what lets a lookup stop at the first group that nothing overflowed from, so a removal
+/// can simply clear the tag instead of leaving a tombstone behind.
+struct alignas(16) FlowGroup final {
+    constexpr static UInt kSlots = 15;
+    constexpr static UInt8 kEmpty = 0;
+    constexpr static UInt8 kSaturated = 0xFF; ///< the count stays once it got here
+
+    Array<UInt8, 16> Control{ };
+
+    /// Returns a bit for every slot whose tag is `tag`, the lowest bit for the first slot.
+    [[nodiscard]] auto Match(UInt8 tag) const noexcept -> UInt32
+    {
+#if defined(__SSE2__)
+        const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(this->Control.data()));
+        const __m128i equal = _mm_cmpeq_epi8(control, _mm_set1_epi8(static_cast<char>(tag)));
+        return static_cast<UInt32>(_mm_movemask_epi8(equal)) & 0x7FFF;
+#else
+        UInt32 mask = 0;
+        for (UInt i = 0; i < kSlots; i++) {
+            mask |= UInt32(this->Control[i] == tag) << i;
+        }
+
+        return mask;
+#endif
+    }
+
+    [[nodiscard]] auto Overflow() noexcept -> UInt8&
+    {
+        return this->Control[kSlots];
+    }
+
+    [[nodiscard]] auto Overflow() const noexcept -> UInt8
+    {
+        return this->Control[kSlots];
+    }
+};
+
+static_assert(sizeof(FlowGroup) == 16);
+
+} // namespace detail
+
+/// An open-addressing hash map from [`FlowKey`]s to values of type `V`, for connection tracking and
+/// other tables of millions of live flows.
+///
+/// Keys are laid out like a SwissTable: slots come in groups of 15 with a 16-byte group of control
+/// bytes, and a lookup compares the tag of a key against the whole group at once (with SSE2 where
+/// it's available), so only the keys whose tags match are compared. Groups are probed quadratically.
+///
+/// Removing a key doesn't leave a tombstone, since every group counts the keys that overflowed it; a
+/// table with a lot of churn doesn't have to be rehashed to stay fast. Keys are hashed with the
+/// `FixedHash` of [`FlowKey`] and a per-table seed.
+///
+/// References to values are invalidated by inserts that grow the table, like with `std::vector`.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/FlowTable.h>
+///
+/// violet::net::FlowTable<Connection> connections(1 << 20);
+///
+/// auto [connection, inserted] = connections.TryEmplace(key);
+/// connection.Packets++;
+/// ```
+template<typename V>
+struct FlowTable final {
+    /// Constructs an empty table that doesn't allocate until the first insert.
+    FlowTable() = default;
+
+    /// Constructs an empty table that can hold `capacity` flows without growing; `seed` changes the
+    /// hash of every key, so that the layout of two tables differs.
+    VIOLET_EXPLICIT FlowTable(UInt capacity, UInt64 seed = 0)
+        : n_seed(seed)
+    {
+        this->Reserve(capacity);
+    }
+
+    // delegates so that the destructor cleans up after a value whose copy throws
+    FlowTable(const FlowTable& other)
+        : FlowTable()
+    {
+        this->n_seed = other.n_seed;
+        if (other.n_groups == nullptr) {
+            return;
+        }
+
+        // a slot is only tagged once its copy is constructed; the overflow counts follow at the end
+        this->allocate(other.n_mask + 1);
+        other.forEachSlot([this, &other](UInt index) -> void {
+            const UInt group = index / kSlots;
+            std::construct_at(&this->n_slots[index], other.n_slots[index]);
+            this->n_groups[group].Control[index % kSlots] = other.n_groups[group].Control[index % kSlots];
+        });
+
+        std::copy_n(other.n_groups.get(), other.n_mask + 1, this->n_groups.get());
+        this->n_size = other.n_size;
+    }
+
+    FlowTable(FlowTable&& other) noexcept
+    {
+        this->swap(other);
+    }
+
+    auto operator=(FlowTable other) noexcept -> FlowTable&
+    {
+        this->swap(other);
+        return *this;
+    }
+
+    ~FlowTable()
+    {
+        this->release();
+    }
+
+    /// Maps `key` to `value`, replacing the value that it was mapped to before.
+    /// @returns **true** if `key` wasn't in the table yet
+    auto Insert(const FlowKey& key, V value) -> bool
+    {
+        auto [existing, inserted] = this->TryEmplace(key, std::move(value));
+        if (!inserted) {
+            existing = std::move(value);
+        }
+
+        return inserted;
+    }
+
+    /// Returns the value of `key`, constructing it from `args` first if `key` isn't in the table.
+    /// @returns the value and **true** if it was constructed
+    template<typename... Args>
+    auto TryEmplace(const FlowKey& key, Args&&... args) -> std::pair<V&, bool>
+    {
+        const UInt64 hash = this->hashOf(key);
+        if (Slot* slot = this->find(key, hash)) {
+            return { slot->Value, false };
+        }
+
+        if (this->n_groups == nullptr) {
+            this->rehash(1);
+        } else if (this->n_size >= this->maxSize()) {
+            this->rehash((this->n_mask + 1) * 2);
+        }
+
+        Slot& slot = this->place(hash, key, V(std::forward<Args>(args)...));
+        this->n_size++;
+
+        return { slot.Value, true };
+    }
+
+    /// Removes `key` from the table.
+    /// @returns the value it was mapped to, if it was in the table
+    auto Remove(const FlowKey& key) -> Optional<V>
+    {
+        const UInt64 hash = this->hashOf(key);
+        Slot* slot = this->find(key, hash);
+        if (slot == nullptr) {
+            return Nothing;
+        }
+
+        Optional<V> value = Some<V>(std::move(slot->Value));
+        this->erase(static_cast<UInt>(slot - this->n_slots), hash);
+
+        return value;
+    }
+
+    /// Removes every flow for which `predicate(key, value)` returns **true**, such as the ones that
+    /// expired, in a single pass over the table.
+    /// @returns the number of flows that were removed
+    template<typename F>
+    auto RemoveIf(F predicate) -> UInt
+    {
+        UInt removed = 0;
+        this->forEachSlot([this, &predicate, &removed](UInt index) -> void {
+            Slot& slot = this->n_slots[index];
+            if (std::invoke(predicate, std::as_const(slot.Key), slot.Value)) {
+                this->erase(index, this->hashOf(slot.Key));
+                removed++;
+            }
+        });
+
+        return removed;
+    }
+
+    /// Returns the value of `key`, if it's in the table.
+    [[nodiscard]] auto Get(const FlowKey& key) noexcept -> Optional<std::reference_wrapper<V>>
+    {
+        if (Slot* slot = this->find(key, this->hashOf(key))) {
+            return std::ref(slot->Value);
+        }
+
+        return Nothing;
+    }
+
+    /// Returns the value of `key`, if it's in the table.
+    [[nodiscard]] auto Get(const FlowKey& key) const noexcept -> Optional<std::reference_wrapper<const V>>
+    {
+        if (const Slot* slot = this->find(key, this->hashOf(key))) {
+            return std::cref(slot->Value);
+        }
+
+        return Nothing;
+    }
+
+    /// Returns **true** if `key` is in the table.
+    [[nodiscard]] auto Contains(const FlowKey& key) const noexcept -> bool
+    {
+        return this->find(key, this->hashOf(key)) != nullptr;
+    }
+
+    /// Looks up every key in `keys` like `Get`, storing a pointer to the value (or **nullptr**) in the
+    /// same position of `values`, which must be at least as large. The groups and then the slots of a
+    /// batch of keys are prefetched before any of them is compared, so that the cache misses of a
+    /// burst of packets overlap.
+    ///
+    /// @returns the number of keys that were in the table
+    auto GetMany(Span<const FlowKey> keys, Span<const V*> values) const noexcept -> UInt
+    {
+        VIOLET_DEBUG_ASSERT(values.size() >= keys.size(), "output span is too small");
+
+        constexpr UInt kBatch = 16;
+
+        Array<UInt64, kBatch> hashes;
+        UInt matched = 0;
+        for (UInt i = 0; i < keys.size(); i += kBatch) {
+            const UInt count = std::min(kBatch, keys.size() - i);
+            if (this->n_size == 0) {
+                std::fill_n(values.begin() + i, count, nullptr);
+                continue;
+            }
+
+            for (UInt j = 0; j < count; j++) {
+                hashes[j] = this->hashOf(keys[i + j]);
+                __builtin_prefetch(&this->n_groups[hashes[j] & this->n_mask]);
+            }
+
+            // the first slot that matches is where the key is, unless another key shares its tag
+            for (UInt j = 0; j < count; j++) {
+                const UInt group = hashes[j] & this->n_mask;
+                if (const UInt32 match = this->n_groups[group].Match(tagOf(hashes[j]))) {
+                    __builtin_prefetch(&this->n_slots[(group * kSlots) + std::countr_zero(match)]);
+                }
+            }
+
+            for (UInt j = 0; j < count; j++) {
+                const Slot* slot = this->find(keys[i + j], hashes[j]);
+                values[i + j] = slot == nullptr ? nullptr : &slot->Value;
+                matched += slot == nullptr ? 0 : 1;
+            }
+        }
+
+        return matched;
+    }
+
+    /// Calls `fn(key, value)` for every flow in the table, in no particular order.
+    template<typename F>
+    void ForEach(F fn)
+    {
+        this->forEachSlot([this, &fn](UInt index) -> void {
+            std::invoke(fn, std::as_const(this->n_slots[index].Key), this->n_slots[index].Value);
+        });
+    }
+
+    /// Calls `fn(key, value)` for every flow in the table, in no particular order.
+    template<typename F>
+    void ForEach(F fn) const
+    {
+        this->forEachSlot([this, &fn](UInt index) -> void {
+            std::invoke(fn, this->n_slots[index].Key, std::as_const(this->n_slots[index].Value));
+        });
+    }
+
+    /// Grows the table so that it can hold `capacity` flows without growing again.
+    void Reserve(UInt capacity)
+    {
+        UInt groups = 1;
+        while (maxSize(groups) < capacity) {
+            groups *= 2;
+        }
+
+        if (this->n_groups == nullptr || groups > this->n_mask + 1) {
+            this->rehash(groups);
+        }
+    }
+
+    /// Removes every flow, keeping the memory.
+    void Clear() noexcept
+    {
+        this->forEachSlot([this](UInt index) -> void { std::destroy_at(&this->n_slots[index]); });
+        if (this->n_groups != nullptr) {
+            std::fill_n(this->n_groups.get(), this->n_mask + 1, detail::FlowGroup{ });
+        }
+
+        this->n_size = 0;
+    }
+
+    /// Returns the number of flows in the table.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    /// Returns **true** if the table has no flows.
+    [[nodiscard]] auto Empty() const noexcept -> bool
+    {
+        return this->n_size == 0;
+    }
+
+    /// Returns the number of flows the table can hold before it grows.
+    [[nodiscard]] auto Capacity() const noexcept -> UInt
+    {
+        return this->n_groups == nullptr ? 0 : this->maxSize();
+    }
+
+    /// Returns the number of bytes used by the table, including the values but not what they own.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        if (this->n_groups == nullptr) {
+            return 0;
+        }
+
+        return (this->n_mask + 1) * (sizeof(detail::FlowGroup) + (kSlots * sizeof(Slot)));
+    }
+
+private:
+    struct Slot final {
+        FlowKey Key;
+        V Value;
+    };
+
+    constexpr static UInt kSlots = detail::FlowGroup::kSlots;
+
+    // a table grows once 7/8 of its slots are used
+    constexpr static auto maxSize(UInt groups) noexcept -> UInt
+    {
+        return groups * kSlots * 7 / 8;
+    }
+
+    [[nodiscard]] auto maxSize() const noexcept -> UInt
+    {
+        return maxSize(this->n_mask + 1);
+    }
+
+    // the top 7 bits of the hash, with the high bit set so that it's never `kEmpty`; the group is picked
+    // by the low bits
+    constexpr static auto tagOf(UInt64 hash) noexcept -> UInt8
+    {
+        return static_cast<UInt8>((hash >> 57) | 0x80);
+    }
+
+    [[nodiscard]] auto hashOf(const FlowKey& key) const noexcept -> UInt64
+    {
+        return FixedHash(key, this->n_seed);
+    }
+
+    // visits the groups `hash` can be in, in order, until `fn(group)` returns **true**; the triangular
+    // steps visit every group once since there's a power of two of them
+    template<typename F>
+    void probe(UInt64 hash, F fn) const
+    {
+        UInt group = hash & this->n_mask;
+        for (UInt step = 1; step <= this->n_mask + 1; step++) {
+            if (fn(group)) {
+                return;
+            }
+
+            group = (group + step) & this->n_mask;
+        }
+    }
+
+    [[nodiscard]] auto find(const FlowKey& key, UInt64 hash) const noexcept -> Slot*
+    {
+        if (this->n_size == 0) {
+            return nullptr;
+        }
+
+        Slot* found = nullptr;
+        this->probe(hash, [this, &key, &found, tag = tagOf(hash)](UInt group) -> bool {
+            const detail::FlowGroup& control = this->n_groups[group];
+            for (UInt32 match = control.Match(tag); match != 0; match &= match - 1) {
+                Slot& slot = this->n_slots[(group * kSlots) + std::countr_zero(match)];
+                if (slot.Key == key) {
+                    found = &slot;
+                    return true;
+                }
+            }
+
+            return control.Overflow() == 0;
+        });
+
+        return found;
+    }
+
+    // constructs a slot from `args` in the first empty slot for `hash`, and only then tags it and counts
+    // it as overflowed in every full group before it, so a constructor that throws leaves the table as
+    // it was. There's always an empty slot, since a table never gets full.
+    template<typename... Args>
+    auto place(UInt64 hash, Args&&... args) -> Slot&
+    {
+        UInt index = 0;
+        this->probe(hash, [this, &index](UInt group) -> bool {
+            if (const UInt32 empty = this->n_groups[group].Match(detail::FlowGroup::kEmpty)) {
+                index = (group * kSlots) + std::countr_zero(empty);
+                return true;
+            }
+
+            return false;
+        });
+
+        Slot* slot = std::construct_at(&this->n_slots[index], std::forward<Args>(args)...);
+
+        const UInt target = index / kSlots;
+        this->probe(hash, [this, target](UInt group) -> bool {
+            if (group == target) {
+                return true;
+            }
+
+            detail::FlowGroup& control = this->n_groups[group];
+            if (control.Overflow() != detail::FlowGroup::kSaturated) {
+                control.Overflow()++;
+            }
+
+            return false;
+        });
+
+        this->n_groups[target].Control[index % kSlots] = tagOf(hash);
+        return *slot;
+    }
+
+    // destroys the slot at `index` and takes it back out of the overflow counts that `place` raised
+    void erase(UInt index, UInt64 hash) noexcept
+    {
+        const UInt target = index / kSlots;
+        this->probe(hash, [this, target](UInt group) -> bool {
+            if (group == target) {
+                return true;
+            }
+
+            detail::FlowGroup& control = this->n_groups[group];
+            if (control.Overflow() != detail::FlowGroup::kSaturated) {
+                control.Overflow()--;
+            }
+
+            return false;
+        });
+
+        std::destroy_at(&this->n_slots[index]);
+        this->n_groups[target].Control[index % kSlots] = detail::FlowGroup::kEmpty;
+        this->n_size--;
+    }
+
+    template<typename F>
+    void forEachSlot(F fn) const
+    {
+        if (this->n_groups == nullptr) {
+            return;
+        }
+
+        for (UInt group = 0; group <= this->n_mask; group++) {
+            const UInt32 full = ~this->n_groups[group].Match(detail::FlowGroup::kEmpty) & 0x7FFF;
+            for (UInt32 slots = full; slots != 0; slots &= slots - 1) {
+                fn((group * kSlots) + std::countr_zero(slots));
+            }
+        }
+    }
+
+    // copies rather than moves the values whose move can throw, like `std::vector`, so that this table
+    // is left as it was if one does
+    void rehash(UInt groups)
+    {
+        FlowTable table;
+        table.n_seed = this->n_seed;
+        table.allocate(groups);
+
+        this->forEachSlot([this, &table](UInt index) -> void {
+            Slot& slot = this->n_slots[index];
+            table.place(table.hashOf(slot.Key), std::move_if_noexcept(slot));
+        });
+
+        table.n_size = this->n_size;
+        this->Clear();
+        this->swap(table);
+    }
+
+    void allocate(UInt groups)
+    {
+        this->n_groups = std::make_unique<detail::FlowGroup[]>(groups);
+        this->n_slots = std::allocator<Slot>().allocate(groups * kSlots);
+        this->n_mask = groups - 1;
+    }
+
+    void release() noexcept
+    {
+        if (this->n_groups == nullptr) {
+            return;
+        }
+
+        this->Clear();
+        std::allocator<Slot>().deallocate(this->n_slots, (this->n_mask + 1) * kSlots);
+        this->n_groups.reset();
+        this->n_slots = nullptr;
+    }
+
+    void swap(FlowTable& other) noexcept
+    {
+        std::swap(this->n_groups, other.n_groups);
+        std::swap(this->n_slots, other.n_slots);
+        std::swap(this->n_mask, other.n_mask);
+        std::swap(this->n_size, other.n_size);
+        std::swap(this->n_seed, other.n_seed);
+    }
+
+    std::unique_ptr<detail::FlowGroup[]> n_groups;
+    Slot* n_slots = nullptr;
+    UInt n_mask = 0; // the number of groups, minus one
+    UInt n_size = 0;
+    UInt64 n_seed = 0;
+};
+
+} // namespace violet::net
@@ -0,0 +1,259 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Violet.h>
+
+namespace violet::net::ip {
+
+/// A special-purpose address category from the IANA [IPv4](https://www.iana.org/assignments/iana-ipv4-special-registry)
+/// and [IPv6](https://www.iana.org/assignments/iana-ipv6-special-registry) Special-Purpose Address Registries,
+/// plus the multicast and broadcast ranges. An address can belong to more than one category.
+enum struct AddrClass : UInt32 {
+    kUnspecified = 1U << 0, ///< `0.0.0.0`, `::`
+    kThisNetwork = 1U << 1, ///< `0.0.0.0/8`
+    kLoopback = 1U << 2, ///< `127.0.0.0/8`, `::1`
+    kPrivate = 1U << 3, ///< `10.0.0.0/8`, `172.16.0.0/12`, `192.168.0.0/16`
+    kShared = 1U << 4, ///< `100.64.0.0/10`
+    kLinkLocal = 1U << 5, ///< `169.254.0.0/16`, `fe80::/10`
+    kProtocolAssignment = 1U << 6, ///< `192.0.0.0/24`, `2001::/23`
+    kDocumentation = 1U << 7, ///< `192.0.2.0/24`, `198.51.100.0/24`, `203.0.113.0/24`, `2001:db8::/32`, `3fff::/20`
+    kBenchmarking = 1U << 8, ///< `198.18.0.0/15`, `2001:2::/48`
+    kReserved = 1U << 9, ///< `240.0.0.0/4`
+    kBroadcast = 1U << 10, ///< `255.255.255.255`
+    kMulticast = 1U << 11, ///< `224.0.0.0/4`, `ff00::/8`
+    kUniqueLocal = 1U << 12, ///< `fc00::/7`
+    kIPv4Mapped = 1U << 13, ///< `::ffff:0:0/96`
+    kTranslation = 1U << 14, ///< `64:ff9b::/96`, `64:ff9b:1::/48`
+    kDiscardOnly = 1U << 15, ///< `100::/64`
+    kAS112 = 1U << 16, ///< `192.31.196.0/24`, `192.175.48.0/24`, `2001:4:112::/48`, `2620:4f:8000::/48`
+    kAMT = 1U << 17, ///< `192.52.193.0/24`, `2001:3::/32`
+    k6to4 = 1U << 18, ///< `2002::/16`
+    kORCHIDv2 = 1U << 19, ///< `2001:20::/28`
+    kDroneRemoteId = 1U << 20, ///< `2001:30::/28`
+    kSegmentRouting = 1U << 21 ///< `5f00::/16`
+};
+
+/// A set of [`AddrClass`] flags, as returned by `AddrV4::Classify()` and `AddrV6::Classify()`.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/AddrV4.h>
+///
+/// using violet::net::ip::AddrClass;
+/// using violet::net::ip::AddrV4;
+///
+/// constexpr auto classes = AddrV4(192, 168, 1, 1).Classify();
+/// static_assert(classes.Contains(AddrClass::kPrivate));
+/// static_assert(!classes.Any(AddrClass::kLoopback | AddrClass::kMulticast));
+/// ```
+struct AddrClassSet final {
+    constexpr VIOLET_IMPLICIT AddrClassSet() noexcept = default;
+    constexpr VIOLET_IMPLICIT AddrClassSet(AddrClass cls) noexcept
+        : n_bits(static_cast<UInt32>(cls))
+    {
+    }
+
+    /// Constructs a set from its raw bit representation.
+    constexpr static auto FromBits(UInt32 bits) noexcept -> AddrClassSet
+    {
+        AddrClassSet set;
+        set.n_bits = bits;
+
+        return set;
+    }
+
+    /// Returns **true** if `cls` is in this set.
+    [[nodiscard]] constexpr auto Contains(AddrClass cls) const noexcept -> bool
+    {
+        return (this->n_bits & static_cast<UInt32>(cls)) != 0;
+    }
+
+    /// Returns **true** if any category of `other` is in this set.
+    [[nodiscard]] constexpr auto Any(AddrClassSet other) const noexcept -> bool
+    {
+        return (this->n_bits & other.n_bits) != 0;
+    }
+
+    /// Returns **true** if no category is in this set, i.e. the address isn't special in any way.
+    [[nodiscard]] constexpr auto Empty() const noexcept -> bool
+    {
+        return this->n_bits == 0;
+    }
+
+    [[nodiscard]] constexpr auto Bits() const noexcept -> UInt32
+    {
+        return this->n_bits;
+    }
+
+    constexpr friend auto operator==(AddrClassSet lhs, AddrClassSet rhs) noexcept -> bool
+    {
+        return lhs.n_bits == rhs.n_bits;
+    }
+
+    constexpr friend auto operator!=(AddrClassSet lhs, AddrClassSet rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+    constexpr friend auto operator|(AddrClassSet lhs, AddrClassSet rhs) noexcept -> AddrClassSet
+    {
+        return FromBits(lhs.n_bits | rhs.n_bits);
+    }
+
+    constexpr friend auto operator&(AddrClassSet lhs, AddrClassSet rhs) noexcept -> AddrClassSet
+    {
+        return FromBits(lhs.n_bits & rhs.n_bits);
+    }
+
+    constexpr friend auto operator|=(AddrClassSet& lhs, AddrClassSet rhs) noexcept -> AddrClassSet&
+    {
+        lhs.n_bits |= rhs.n_bits;
+        return lhs;
+    }
+
+private:
+    UInt32 n_bits = 0;
+};
+
+static_assert(sizeof(AddrClassSet) == sizeof(UInt32));
+
+constexpr auto operator|(AddrClass lhs, AddrClass rhs) noexcept -> AddrClassSet
+{
+    return AddrClassSet(lhs) | AddrClassSet(rhs);
+}
+
+/// Categories whose addresses aren't globally reachable, save for a few exceptions; see `AddrV4::Global()`.
+/// AS112, AMT, ORCHIDv2 and drone remote ID addresses are globally reachable, and 6to4 ones are whatever the
+/// IPv4 address within them is.
+constexpr AddrClassSet kNonGlobalClasses = AddrClass::kUnspecified | AddrClass::kThisNetwork | AddrClass::kLoopback
+    | AddrClass::kPrivate | AddrClass::kShared | AddrClass::kLinkLocal | AddrClass::kProtocolAssignment
+    | AddrClass::kDocumentation | AddrClass::kBenchmarking | AddrClass::kReserved | AddrClass::kBroadcast
+    | AddrClass::kMulticast | AddrClass::kUniqueLocal | AddrClass::kDiscardOnly | AddrClass::kSegmentRouting;
+
+namespace detail {
+
+struct class_range_v4_t final {
+    UInt32 Prefix;
+    UInt32 Mask;
+    AddrClass Class;
+};
+
+constexpr auto MaskV4(UInt32 length) noexcept -> UInt32
+{
+    return length == 0 ? 0 : ~UInt32{ 0 } << (32 - length);
+}
+
+constexpr Array<class_range_v4_t, 19> kClassRangesV4 = { {
+    { 0x00000000, MaskV4(32), AddrClass::kUnspecified },
+    { 0x00000000, MaskV4(8), AddrClass::kThisNetwork },
+    { 0x7F000000, MaskV4(8), AddrClass::kLoopback },
+    { 0x0A000000, MaskV4(8), AddrClass::kPrivate },
+    { 0xAC100000, MaskV4(12), AddrClass::kPrivate },
+    { 0xC0A80000, MaskV4(16), AddrClass::kPrivate },
+    { 0x64400000, MaskV4(10), AddrClass::kShared },
+    { 0xA9FE0000, MaskV4(16), AddrClass::kLinkLocal },
+    { 0xC0000000, MaskV4(24), AddrClass::kProtocolAssignment },
+    { 0xC0000200, MaskV4(24), AddrClass::kDocumentation },
+    { 0xC6336400, MaskV4(24), AddrClass::kDocumentation },
+    { 0xCB007100, MaskV4(24), AddrClass::kDocumentation },
+    { 0xC6120000, MaskV4(15), AddrClass::kBenchmarking },
+    { 0xC01FC400, MaskV4(24), AddrClass::kAS112 },
+    { 0xC0AF3000, MaskV4(24), AddrClass::kAS112 },
+    { 0xC034C100, MaskV4(24), AddrClass::kAMT },
+    { 0xF0000000, MaskV4(4), AddrClass::kReserved },
+    { 0xFFFFFFFF, MaskV4(32), AddrClass::kBroadcast },
+    { 0xE0000000, MaskV4(4), AddrClass::kMulticast },
+} };
+
+/// Classifies a host-order IPv4 address. Every range is tested unconditionally and the matches are
+/// folded into the result with a mask, so there are no data-dependent branches.
+constexpr auto ClassifyV4(UInt32 addr) noexcept -> AddrClassSet
+{
+    UInt32 bits = 0;
+    for (const auto& range: kClassRangesV4) {
+        bits |= static_cast<UInt32>(range.Class) & (0U - static_cast<UInt32>((addr & range.Mask) == range.Prefix));
+    }
+
+    return AddrClassSet::FromBits(bits);
+}
+
+struct class_range_v6_t final {
+    UInt64 PrefixHigh;
+    UInt64 PrefixLow;
+    UInt64 MaskHigh;
+    UInt64 MaskLow;
+    AddrClass Class;
+};
+
+constexpr auto MaskV6High(UInt32 length) noexcept -> UInt64
+{
+    return length == 0 ? 0 : length >= 64 ? ~UInt64{ 0 } : ~UInt64{ 0 } << (64 - length);
+}
+
+constexpr auto MaskV6Low(UInt32 length) noexcept -> UInt64
+{
+    return length <= 64 ? 0 : ~UInt64{ 0 } << (128 - length);
+}
+
+constexpr auto RangeV6(UInt64 high, UInt64 low, UInt32 length, AddrClass cls) noexcept -> class_range_v6_t
+{
+    return { high, low, MaskV6High(length), MaskV6Low(length), cls };
+}
+
+constexpr Array<class_range_v6_t, 21> kClassRangesV6 = { {
+    RangeV6(0x0000000000000000, 0x0000000000000000, 128, AddrClass::kUnspecified),
+    RangeV6(0x0000000000000000, 0x0000000000000001, 128, AddrClass::kLoopback),
+    RangeV6(0x0000000000000000, 0x0000FFFF00000000, 96, AddrClass::kIPv4Mapped),
+    RangeV6(0x0064FF9B00000000, 0x0000000000000000, 96, AddrClass::kTranslation),
+    RangeV6(0x0064FF9B00010000, 0x0000000000000000, 48, AddrClass::kTranslation),
+    RangeV6(0x0100000000000000, 0x0000000000000000, 64, AddrClass::kDiscardOnly),
+    RangeV6(0x2001000000000000, 0x0000000000000000, 23, AddrClass::kProtocolAssignment),
+    RangeV6(0x2001000200000000, 0x0000000000000000, 48, AddrClass::kBenchmarking),
+    RangeV6(0x2001000300000000, 0x0000000000000000, 32, AddrClass::kAMT),
+    RangeV6(0x2001000401120000, 0x0000000000000000, 48, AddrClass::kAS112),
+    RangeV6(0x2001002000000000, 0x0000000000000000, 28, AddrClass::kORCHIDv2),
+    RangeV6(0x2001003000000000, 0x0000000000000000, 28, AddrClass::kDroneRemoteId),
+    RangeV6(0x20010DB800000000, 0x0000000000000000, 32, AddrClass::kDocumentation),
+    RangeV6(0x2002000000000000, 0x0000000000000000, 16, AddrClass::k6to4),
+    RangeV6(0x2620004F80000000, 0x0000000000000000, 48, AddrClass::kAS112),
+    RangeV6(0x3FFF000000000000, 0x0000000000000000, 20, AddrClass::kDocumentation),
+    RangeV6(0x5F00000000000000, 0x0000000000000000, 16, AddrClass::kSegmentRouting),
+    RangeV6(0xFC00000000000000, 0x0000000000000000, 7, AddrClass::kUniqueLocal),
+    RangeV6(0xFE80000000000000, 0x0000000000000000, 10, AddrClass::kLinkLocal),
+    RangeV6(0xFF00000000000000, 0x0000000000000000, 8, AddrClass::kMulticast),
+} };
+
+/// Classifies an IPv6 address given as its high and low 64-bit words; see `ClassifyV4`.
+constexpr auto ClassifyV6(UInt64 high, UInt64 low) noexcept -> AddrClassSet
+{
+    UInt32 bits = 0;
+    for (const auto& range: kClassRangesV6) {
+        bool matches = ((high & range.MaskHigh) == range.PrefixHigh) & ((low & range.MaskLow) == range.PrefixLow);
+        bits |= static_cast<UInt32>(range.Class) & (0U - static_cast<UInt32>(matches));
+    }
+
+    return AddrClassSet::FromBits(bits);
+}
+
+} // namespace detail
+} // namespace violet::net::ip
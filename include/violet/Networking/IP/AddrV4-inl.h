@@ -0,0 +1,346 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/AddrV4.h>
+#include <violet/Networking/IP/Tables.h>
+#include <violet/Networking/Inline.h>
+
+#include <charconv>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+
+    #define VIOLET_NET_IPV4_SSE41 1
+#else
+    #define VIOLET_NET_IPV4_SSE41 0
+#endif
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+
+    #define VIOLET_NET_IPV4_CLASSIFY_SSE2 1
+    #define VIOLET_NET_IPV4_CLASSIFY_NEON 0
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    #include <arm_neon.h>
+
+    #define VIOLET_NET_IPV4_CLASSIFY_SSE2 0
+    #define VIOLET_NET_IPV4_CLASSIFY_NEON 1
+#else
+    #define VIOLET_NET_IPV4_CLASSIFY_SSE2 0
+    #define VIOLET_NET_IPV4_CLASSIFY_NEON 0
+#endif
+
+namespace violet::net::ip {
+namespace detail {
+
+#if VIOLET_NET_IPV4_SSE41
+
+// `pshufb` control masks for every octet-length combination (3^4 = 81). Each mask places the
+// hundreds, tens and ones digit of octet `i` in bytes `4i+1`, `4i+2` and `4i+3`; missing digits
+// are zeroed by the `0x80` index.
+alignas(16) constexpr auto kShuffleTable = []() constexpr -> Array<Array<UInt8, 16>, 81> {
+    Array<Array<UInt8, 16>, 81> table{ };
+    for (UInt pattern = 0; pattern < 81; ++pattern) {
+        Array<UInt, 4> lengths = { (pattern / 27) + 1, ((pattern / 9) % 3) + 1, ((pattern / 3) % 3) + 1,
+            (pattern % 3) + 1 };
+
+        UInt start = 0;
+        for (UInt octet = 0; octet < 4; ++octet) {
+            for (UInt lane = 0; lane < 4; ++lane) {
+                // lane 3 is the ones digit, lane 2 the tens and lane 1 the hundreds
+                UInt distance = 3 - lane;
+                table[pattern][(octet * 4) + lane] = distance < lengths[octet]
+                    ? static_cast<UInt8>(start + lengths[octet] - 1 - distance)
+                    : static_cast<UInt8>(0x80);
+            }
+
+            start += lengths[octet] + 1;
+        }
+    }
+
+    return table;
+}();
+
+// Parses a well-formed dotted-quad (`d{1,3}.d{1,3}.d{1,3}.d{1,3}`, every octet <= 255) with one 16-byte
+// register. Anything else is rejected so that the scalar parser can report the precise error.
+__attribute__((target("sse4.1"))) VIOLET_NET_INLINE auto ParseDottedQuadSse41(Str input, UInt32& out) noexcept -> bool
+{
+    const UInt size = input.size();
+    if (size < 7 || size > 15) {
+        return false;
+    }
+
+    alignas(16) Array<char, 16> buf{ };
+    std::memcpy(buf.data(), input.data(), size);
+
+    const __m128i chars = _mm_load_si128(reinterpret_cast<const __m128i*>(buf.data()));
+    const UInt32 used = (1U << size) - 1;
+    const auto dots = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('.')))) & used;
+
+    // bytes >= 0x80 compare as negative, so they're also caught by the `< '0'` check.
+    const __m128i nonDigits
+        = _mm_or_si128(_mm_cmplt_epi8(chars, _mm_set1_epi8('0')), _mm_cmpgt_epi8(chars, _mm_set1_epi8('9')));
+
+    if ((static_cast<UInt32>(_mm_movemask_epi8(nonDigits)) & used) != dots || __builtin_popcount(dots) != 3) {
+        return false;
+    }
+
+    const auto first = static_cast<UInt>(__builtin_ctz(dots));
+    const auto second = static_cast<UInt>(__builtin_ctz(dots & (dots - 1)));
+    const auto third = static_cast<UInt>(31 - __builtin_clz(dots));
+
+    const UInt len0 = first;
+    const UInt len1 = second - first - 1;
+    const UInt len2 = third - second - 1;
+    const UInt len3 = size - third - 1;
+    if (len0 - 1 > 2 || len1 - 1 > 2 || len2 - 1 > 2 || len3 - 1 > 2) {
+        return false;
+    }
+
+    const auto& pattern = kShuffleTable[((len0 - 1) * 27) + ((len1 - 1) * 9) + ((len2 - 1) * 3) + (len3 - 1)];
+    const __m128i digits = _mm_shuffle_epi8(_mm_sub_epi8(chars, _mm_set1_epi8('0')),
+        _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.data())));
+
+    // [0, h, t, o] * [0, 100, 10, 1] -> [100h, 10t + o] -> [100h + 10t + o]
+    const __m128i pairs = _mm_maddubs_epi16(digits, _mm_set1_epi32(0x010A6400));
+    const __m128i octets = _mm_madd_epi16(pairs, _mm_set1_epi16(1));
+    if (_mm_movemask_epi8(_mm_cmpgt_epi32(octets, _mm_set1_epi32(255))) != 0) {
+        return false;
+    }
+
+    const __m128i packed = _mm_packus_epi16(_mm_packus_epi32(octets, octets), octets);
+    out = __builtin_bswap32(static_cast<UInt32>(_mm_cvtsi128_si32(packed)));
+
+    return true;
+}
+
+#endif
+
+VIOLET_NET_INLINE auto HasFastParserV4() noexcept -> bool
+{
+#if VIOLET_NET_IPV4_SSE41 && defined(__SSE4_1__)
+    // the whole program targets SSE4.1 already; no need to ask the CPU
+    return true;
+#elif VIOLET_NET_IPV4_SSE41
+    static const bool kHasSse41 = []() -> bool {
+        // may run during static initialization of another TU, before libgcc's own CPU probe
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.1");
+    }();
+
+    return kHasSse41;
+#else
+    return false;
+#endif
+}
+
+// Only called after `HasFastParserV4()` returned **true**.
+VIOLET_NET_INLINE auto ParseDottedQuadSimd(Str input, UInt32& out) noexcept -> bool
+{
+#if VIOLET_NET_IPV4_SSE41
+    return ParseDottedQuadSse41(input, out);
+#else
+    (void)input;
+    (void)out;
+
+    return false;
+#endif
+}
+
+VIOLET_NET_INLINE auto ParseDottedQuadFast(Str input, UInt32& out) noexcept -> bool
+{
+    return HasFastParserV4() && ParseDottedQuadSimd(input, out);
+}
+
+#if VIOLET_NET_IPV4_CLASSIFY_SSE2 || VIOLET_NET_IPV4_CLASSIFY_NEON
+
+static_assert(sizeof(AddrV4) == 4 && sizeof(AddrClassSet) == 4, "batch classification loads four of each per vector");
+
+// `kClassRangesV4` with the prefixes and masks in network byte order, so that four addresses can be
+// loaded straight from memory into one vector without swapping each lane first.
+struct class_range_v4_be_t final {
+    UInt32 Prefix;
+    UInt32 Mask;
+    UInt32 Class;
+};
+
+constexpr auto kClassRangesV4BE = []() constexpr -> Array<class_range_v4_be_t, kClassRangesV4.size()> {
+    Array<class_range_v4_be_t, kClassRangesV4.size()> table{ };
+    for (UInt i = 0; i < table.size(); ++i) {
+        const auto& range = kClassRangesV4[i];
+        table[i] = { __builtin_bswap32(range.Prefix), __builtin_bswap32(range.Mask),
+            static_cast<UInt32>(range.Class) };
+    }
+
+    return table;
+}();
+
+#endif
+
+} // namespace detail
+
+VIOLET_NET_INLINE auto InvalidV4AddressError::ToString() const noexcept -> String
+{
+    String suffix;
+    switch (this->Kind()) {
+    case AddrV4::ParseStatus::kExceededOctetLimit:
+        suffix = "exceeded number of octets needed";
+        break;
+
+    case AddrV4::ParseStatus::kInvalidIntegral:
+        suffix = std::format(
+            "failed to parse integral value: {}", std::make_error_code(std::errc::invalid_argument).message());
+        break;
+
+    case AddrV4::ParseStatus::kIntegralOutOfRange:
+        suffix = std::format(
+            "failed to parse integral value: {}", std::make_error_code(std::errc::result_out_of_range).message());
+        break;
+
+    case AddrV4::ParseStatus::kMaxOctetNumber:
+        suffix = "max octet number (>255)";
+        break;
+
+    case AddrV4::ParseStatus::kNotAtleast4Octets:
+        suffix = "4 octets are required to be a valid address";
+        break;
+
+    default:
+        VIOLET_UNREACHABLE();
+    }
+
+    return std::format("invalid IPv4 address: {}", suffix);
+}
+
+VIOLET_NET_INLINE auto AddrV4::FromStr(Str input) noexcept -> Result<AddrV4, InvalidV4AddressError>
+{
+    // Well-formed addresses are handled by the vectorized parser (if the CPU supports it). It never
+    // reports errors itself: anything it can't handle goes through the scalar parser, which is the one
+    // that decides between accepting the input and which error to return.
+    if (UInt32 addr = 0; detail::ParseDottedQuadFast(input, addr)) {
+        return AddrV4::FromUInt32(addr);
+    }
+
+    return AddrV4::fromStrSlow(input);
+}
+
+// Split from `FromStr` so that its fast path reads on its own; whether this is inlined into it is left to
+// the compiler, since forcing it out of line made `FromStr` slower.
+VIOLET_NET_INLINE auto AddrV4::fromStrSlow(Str input) noexcept -> Result<AddrV4, InvalidV4AddressError>
+{
+    UInt32 addr = 0;
+    UInt offset = 0;
+    if (auto status = detail::ParseV4(input, addr, offset); status != ParseStatus::kOk) {
+        return Err(InvalidV4AddressError(status, offset));
+    }
+
+    return AddrV4::FromUInt32(addr);
+}
+
+VIOLET_NET_INLINE auto AddrV4::ParseMany(
+    Span<const Str> inputs, Span<AddrV4> out, Span<ParseStatus> status) noexcept -> UInt
+{
+    VIOLET_DEBUG_ASSERT(out.size() >= inputs.size() && status.size() >= inputs.size(),
+        "output spans are smaller than the input");
+
+    UInt parsed = 0;
+    const bool fast = detail::HasFastParserV4();
+
+    for (UInt i = 0; i < inputs.size(); ++i) {
+        UInt32 addr = 0;
+        ParseStatus result = ParseStatus::kOk;
+        if (!fast || !detail::ParseDottedQuadSimd(inputs[i], addr)) {
+            result = detail::ParseV4(inputs[i], addr);
+        }
+
+        // failed items are zeroed rather than left untouched so that `out` never holds stale data
+        out[i] = AddrV4::FromUInt32(result == ParseStatus::kOk ? addr : 0);
+        status[i] = result;
+        parsed += static_cast<UInt>(result == ParseStatus::kOk);
+    }
+
+    return parsed;
+}
+
+VIOLET_NET_INLINE void AddrV4::Classify(Span<const AddrV4> addrs, Span<AddrClassSet> out) noexcept
+{
+    VIOLET_DEBUG_ASSERT(out.size() >= addrs.size(), "output span is smaller than the input");
+
+    UInt i = 0;
+
+#if VIOLET_NET_IPV4_CLASSIFY_SSE2
+    for (; i + 4 <= addrs.size(); i += 4) {
+        const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(addrs.data() + i));
+
+        __m128i bits = _mm_setzero_si128();
+        for (const auto& range: detail::kClassRangesV4BE) {
+            const __m128i masked = _mm_and_si128(lanes, _mm_set1_epi32(static_cast<Int32>(range.Mask)));
+            const __m128i matches = _mm_cmpeq_epi32(masked, _mm_set1_epi32(static_cast<Int32>(range.Prefix)));
+            bits = _mm_or_si128(bits, _mm_and_si128(matches, _mm_set1_epi32(static_cast<Int32>(range.Class))));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), bits);
+    }
+#elif VIOLET_NET_IPV4_CLASSIFY_NEON
+    for (; i + 4 <= addrs.size(); i += 4) {
+        const uint32x4_t lanes = vld1q_u32(reinterpret_cast<const uint32_t*>(addrs.data() + i));
+
+        uint32x4_t bits = vdupq_n_u32(0);
+        for (const auto& range: detail::kClassRangesV4BE) {
+            const uint32x4_t matches = vceqq_u32(vandq_u32(lanes, vdupq_n_u32(range.Mask)), vdupq_n_u32(range.Prefix));
+            bits = vorrq_u32(bits, vandq_u32(matches, vdupq_n_u32(range.Class)));
+        }
+
+        vst1q_u32(reinterpret_cast<uint32_t*>(out.data() + i), bits);
+    }
+#endif
+
+    for (; i < addrs.size(); ++i) {
+        out[i] = addrs[i].Classify();
+    }
+}
+
+VIOLET_NET_INLINE auto AddrV4::ToChars(char* first, char* last) const noexcept -> std::to_chars_result
+{
+    return detail::WriteBounded<kMaxStringLength>(first, last, [this](char* out) -> char* {
+        out = detail::WriteOctet(out, this->n_bytes[0]);
+        *out++ = '.';
+        out = detail::WriteOctet(out, this->n_bytes[1]);
+        *out++ = '.';
+        out = detail::WriteOctet(out, this->n_bytes[2]);
+        *out++ = '.';
+
+        return detail::WriteOctet(out, this->n_bytes[3]);
+    });
+}
+
+VIOLET_NET_INLINE auto AddrV4::ToString() const noexcept -> String
+{
+    Array<char, kMaxStringLength> buf;
+    auto [end, _] = this->ToChars(buf.data(), buf.data() + buf.size());
+
+    return { buf.data(), end };
+}
+
+} // namespace violet::net::ip
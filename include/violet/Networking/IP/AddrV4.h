@@ -23,8 +23,15 @@
 
 #include <violet/Container/Optional.h>
 #include <violet/Container/Result.h>
+#include <violet/Networking/Inline.h>
+#include <violet/Networking/IP/AddrClass.h>
+#include <violet/Networking/IP/FixedHash.h>
+#include <violet/Networking/IP/Parsing.h>
 
+#include <algorithm>
+#include <charconv>
 #include <functional>
+#include <utility>
 
 namespace violet::net::ip {
 
@@ -33,6 +40,20 @@ struct InvalidV4AddressError;
 /// Representation of Internet Protocol Version 4 addresses specified in [IETF
 /// RFC791](https://tools.ietf.org/html/rfc791) in network-byte order.
 struct VIOLET_API AddrV4 final {
+    /// Maximum length of the string representation of an IPv4 address (`255.255.255.255`).
+    constexpr static UInt kMaxStringLength = 15;
+
+    /// Outcome of parsing a single input with `ParseMany`. Every error kind corresponds to the
+    /// [`InvalidV4AddressError`] that `FromStr` would return for the same input.
+    enum struct ParseStatus : UInt8 {
+        kOk = 0,
+        kExceededOctetLimit = 1, ///< more than 4 octets
+        kInvalidIntegral = 2, ///< an octet is empty or isn't a number
+        kIntegralOutOfRange = 3, ///< an octet doesn't even fit in 32 bits
+        kMaxOctetNumber = 4, ///< an octet is larger than `255`
+        kNotAtleast4Octets = 5 ///< fewer than 4 octets
+    };
+
     /// Constructs a unspecified IPv4 address (`0.0.0.0`).
     constexpr VIOLET_IMPLICIT AddrV4() noexcept = default;
 
@@ -69,6 +90,45 @@ struct VIOLET_API AddrV4 final {
     /// @param input the input to parse
     static auto FromStr(Str input) noexcept -> Result<AddrV4, InvalidV4AddressError>;
 
+    /// Parses an IPv4 address like `FromStr`, but returns **Nothing** instead of an error so that it can
+    /// be used in constant expressions. At runtime, prefer `FromStr` which has a vectorized fast path.
+    ///
+    /// ## Example
+    /// ```cpp
+    /// #include <violet/Networking/IP/AddrV4.h>
+    ///
+    /// using violet::net::ip::AddrV4;
+    ///
+    /// static_assert(AddrV4::Parse("10.0.0.1").Unwrap() == AddrV4(10, 0, 0, 1));
+    /// static_assert(!AddrV4::Parse("10.0.0"));
+    /// ```
+    constexpr static auto Parse(Str input) noexcept -> Optional<AddrV4>;
+
+    /// Parses every string in `inputs`, writing the address for `inputs[i]` to `out[i]` and its outcome to
+    /// `status[i]`. Inputs that fail to parse are written as `0.0.0.0`.
+    ///
+    /// This accepts exactly what `FromStr` accepts, but without building a `Result` per input and with
+    /// the CPU feature dispatch done once per call, which is what dominates when bulk-loading addresses.
+    ///
+    /// `out` and `status` must be at least as large as `inputs`.
+    ///
+    /// ## Example
+    /// ```cpp
+    /// #include <violet/Networking/IP/AddrV4.h>
+    ///
+    /// using violet::net::ip::AddrV4;
+    ///
+    /// violet::Array<violet::Str, 2> inputs = { "10.0.0.1", "10.0.0" };
+    /// violet::Array<AddrV4, 2> addrs;
+    /// violet::Array<AddrV4::ParseStatus, 2> status;
+    ///
+    /// auto parsed = AddrV4::ParseMany(inputs, addrs, status); // => 1
+    /// // status[1] == AddrV4::ParseStatus::kNotAtleast4Octets
+    /// ```
+    ///
+    /// @returns the number of inputs that were parsed successfully.
+    static auto ParseMany(Span<const Str> inputs, Span<AddrV4> out, Span<ParseStatus> status) noexcept -> UInt;
+
     /// Returns **true** if this is a broadcast address (`255.255.255.255`).
     ///
     /// A broadcast address has all octets set to `255` as defined in [IETF RFC919](https://tools.ietf.org/html/rfc919).
@@ -135,22 +195,23 @@ struct VIOLET_API AddrV4 final {
         return (this->AsUInt32() >> 16) == 0xA9FE;
     }
 
+    /// Returns **true** if this address isn't in any of the special-purpose ranges that are never globally
+    /// reachable (see `kNonGlobalClasses`). The PCP and TURN anycast addresses, `192.0.0.9` and `192.0.0.10`,
+    /// are global even though the rest of `192.0.0.0/24` isn't.
     [[nodiscard]] constexpr auto Global() const noexcept -> bool
     {
-        return !(Unspecified() && Loopback() && Private() && LinkLocal() && Multicast() && IsBroadcast() && Shared()
-            && Benchmarking() && Reserved());
+        const UInt32 ip = this->AsUInt32();
+        return !this->Classify().Any(kNonGlobalClasses) || ip == 0xC0000009 || ip == 0xC000000A;
     }
 
     [[nodiscard]] constexpr auto Shared() const noexcept -> bool
     {
-        auto ip = this->AsUInt32();
-        return (ip >> 24) == 100 && ((ip >> 16) & 0xF) >= 64 && ((ip >> 16) & 0xF) <= 127; // 100.64.0.0/10
+        return (this->AsUInt32() >> 22) == (0x64400000 >> 22); // 100.64.0.0/10
     }
 
     [[nodiscard]] constexpr auto Benchmarking() const noexcept -> bool
     {
-        auto ip = this->AsUInt32();
-        return (ip >> 24) == 198 && ((ip >> 16) & 0xFF) == 18; // 198.18.0.0/15
+        return (this->AsUInt32() >> 17) == (0xC6120000 >> 17); // 198.18.0.0/15
     }
 
     [[nodiscard]] constexpr auto Reserved() const noexcept -> bool
@@ -167,10 +228,37 @@ struct VIOLET_API AddrV4 final {
 
     [[nodiscard]] constexpr auto Documentation() const noexcept -> bool
     {
-        auto ip = this->AsUInt32();
-        return (ip >> 24) == 192 && ((ip >> 16) & 0xFF) == 0x0D; // 192.0.2.0/24
+        // 192.0.2.0/24 (TEST-NET-1), 198.51.100.0/24 (TEST-NET-2) and 203.0.113.0/24 (TEST-NET-3)
+        auto net = this->AsUInt32() >> 8;
+        return net == 0xC00002 || net == 0xC63364 || net == 0xCB0071;
     }
 
+    /// Returns every special-purpose category this address belongs to in a single pass.
+    ///
+    /// This is cheaper than calling several of the predicates above as each range is tested without
+    /// branching, which matters when classifying untrusted peers where the outcome is unpredictable.
+    ///
+    /// ## Example
+    /// ```cpp
+    /// #include <violet/Networking/IP/AddrV4.h>
+    ///
+    /// using violet::net::ip::AddrClass;
+    /// using violet::net::ip::AddrV4;
+    ///
+    /// static_assert(AddrV4(0, 0, 0, 0).Classify() == (AddrClass::kUnspecified | AddrClass::kThisNetwork));
+    /// static_assert(AddrV4(8, 8, 8, 8).Classify().Empty());
+    /// ```
+    [[nodiscard]] constexpr auto Classify() const noexcept -> AddrClassSet
+    {
+        return detail::ClassifyV4(this->AsUInt32());
+    }
+
+    /// Classifies every address in `addrs`, writing the result for `addrs[i]` to `out[i]`. Several
+    /// addresses are classified at once with SIMD where available.
+    ///
+    /// `out` must be at least as large as `addrs`.
+    static void Classify(Span<const AddrV4> addrs, Span<AddrClassSet> out) noexcept;
+
     [[nodiscard]] constexpr auto AsUInt32() const noexcept -> UInt32
     {
         auto octets = this->Octets();
@@ -183,6 +271,24 @@ struct VIOLET_API AddrV4 final {
         return this->n_bytes;
     }
 
+    /// Writes the dotted-quad representation of this address into `[first, last)` without allocating.
+    ///
+    /// On success, the returned `ptr` points one past the last character written; the output is **not**
+    /// NUL-terminated. If the range can't hold the address, `ec` is `std::errc::value_too_large` and
+    /// `ptr` is `last`, just like [`std::to_chars`](https://en.cppreference.com/w/cpp/utility/to_chars).
+    ///
+    /// ## Example
+    /// ```cpp
+    /// #include <violet/Networking/IP/AddrV4.h>
+    ///
+    /// using IPAddrV4 = violet::net::ip::AddrV4;
+    ///
+    /// violet::Array<char, IPAddrV4::kMaxStringLength> buf;
+    /// auto [end, ec] = IPAddrV4(192, 168, 1, 1).ToChars(buf.data(), buf.data() + buf.size());
+    /// // violet::Str(buf.data(), end) == "192.168.1.1"
+    /// ```
+    auto ToChars(char* first, char* last) const noexcept -> std::to_chars_result;
+
     [[nodiscard]] auto ToString() const noexcept -> String;
     friend auto operator<<(std::ostream& os, const AddrV4& self) noexcept -> std::ostream&
     {
@@ -277,81 +383,188 @@ struct VIOLET_API AddrV4 final {
         return lhs;
     }
 
+    template<typename H>
+    friend auto AbslHashValue(H state, const AddrV4& addr) -> H
+    {
+        return H::combine(std::move(state), addr.AsUInt32());
+    }
+
 private:
+    static auto fromStrSlow(Str input) noexcept -> Result<AddrV4, InvalidV4AddressError>;
+
     Array<UInt8, 4> n_bytes;
 };
 
 static_assert(sizeof(AddrV4) == 4);
 static_assert(std::is_trivially_copyable_v<AddrV4>);
 
-/// Represents an error returned when parsing an invalid IPv4 address.
-struct VIOLET_API InvalidV4AddressError final {
-    /// Returns a string description of the error.
-    [[nodiscard]] auto ToString() const noexcept -> String;
-    friend auto operator<<(std::ostream& os, const InvalidV4AddressError& self) noexcept -> std::ostream&
-    {
-        return os << self.ToString();
+/// Returns the 64-bit hash of `address` that never changes; see `<violet/Networking/IP/FixedHash.h>`.
+constexpr auto FixedHash(AddrV4 address, UInt64 seed = 0) noexcept -> UInt64
+{
+    return detail::Mix64(UInt64(address.AsUInt32()) ^ (seed * detail::kSeedMultiplier));
+}
+
+namespace detail {
+
+/// The reference IPv4 parser behind `AddrV4::FromStr`, `AddrV4::Parse` and `AddrV4::ParseMany`; on
+/// success the address is written to `out` in host byte order, otherwise `offset` is set to the byte
+/// where the offending octet starts (or to the end of the input if there are too few octets).
+constexpr auto ParseV4(Str input, UInt32& out, UInt& offset) noexcept -> AddrV4::ParseStatus
+{
+    using ParseStatus = AddrV4::ParseStatus;
+
+    UInt32 addr = 0;
+    UInt octetIndex = 0;
+    UInt start = 0;
+
+    for (UInt i = 0; i <= input.size(); ++i) {
+        if (i == input.size() || input[i] == '.') {
+            offset = start;
+            if (octetIndex >= 4) {
+                return ParseStatus::kExceededOctetLimit;
+            }
+
+            UInt64 value = 0;
+            auto ec = ParseDecimal(input.substr(start, i - start), std::numeric_limits<UInt32>::max(), value);
+            if (ec != std::errc{ }) {
+                return ec == std::errc::result_out_of_range ? ParseStatus::kIntegralOutOfRange
+                                                            : ParseStatus::kInvalidIntegral;
+            }
+
+            if (value > 255) {
+                return ParseStatus::kMaxOctetNumber;
+            }
+
+            addr = (addr << 8) | static_cast<UInt32>(value);
+            octetIndex++;
+            start = i + 1;
+        }
     }
 
-private:
-    friend auto AddrV4::FromStr(Str input) noexcept -> Result<AddrV4, InvalidV4AddressError>;
-    constexpr VIOLET_IMPLICIT InvalidV4AddressError() noexcept = default;
+    if (octetIndex != 4) {
+        offset = input.size();
+        return ParseStatus::kNotAtleast4Octets;
+    }
 
-    enum struct kind_t : violet::UInt8 {
-        kExceededOctetLimit = 0,
-        kFailedIntegralParsing = 1,
-        kMaxOctetNumber = 2,
-        kNotAtleast4Octets = 3,
+    out = addr;
+    return ParseStatus::kOk;
+}
 
-        kMax = std::numeric_limits<std::underlying_type_t<kind_t>>::max()
-    };
+constexpr auto ParseV4(Str input, UInt32& out) noexcept -> AddrV4::ParseStatus
+{
+    UInt offset = 0;
+    return ParseV4(input, out, offset);
+}
 
-    static auto exceededOctetLimit() noexcept -> InvalidV4AddressError
-    {
-        InvalidV4AddressError error;
-        error.n_kind = kind_t::kExceededOctetLimit;
+/// The SIMD fast path of `AddrV4::FromStr`, which writes a plain dotted quad to `out` in host byte order.
+/// @returns **false** if the CPU can't run it or `input` needs the full parser, i.e. `ParseV4`
+VIOLET_NET_INLINE auto ParseDottedQuadFast(Str input, UInt32& out) noexcept -> bool;
 
-        return error;
+} // namespace detail
+
+constexpr auto AddrV4::Parse(Str input) noexcept -> Optional<AddrV4>
+{
+    if (UInt32 addr = 0; detail::ParseV4(input, addr) == ParseStatus::kOk) {
+        return AddrV4::FromUInt32(addr);
     }
 
-    static auto failedIntegralParsing(std::errc code) noexcept -> InvalidV4AddressError
-    {
-        InvalidV4AddressError error;
-        error.n_kind = kind_t::kFailedIntegralParsing;
-        error.n_errorCode = Some<std::error_code>(static_cast<Int32>(code), std::generic_category());
+    return Nothing;
+}
 
-        return error;
+/// Represents an error returned when parsing an invalid IPv4 address.
+///
+/// The error is only the [`AddrV4::ParseStatus`] and the byte offset where parsing failed, so that
+/// rejecting garbage costs about as much as accepting an address; the message (and the
+/// `std::error_code` behind integral errors) is only built by `ToString`.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/AddrV4.h>
+///
+/// using violet::net::ip::AddrV4;
+///
+/// auto error = AddrV4::FromStr("10.0.300.1").Error();
+/// // error.Kind() == AddrV4::ParseStatus::kMaxOctetNumber
+/// // error.Offset() == 5
+/// ```
+struct VIOLET_API InvalidV4AddressError final {
+    /// Creates an error of the given kind; `kind` can't be [`AddrV4::ParseStatus::kOk`]. Offsets that
+    /// don't fit in 24 bits are clamped.
+    constexpr InvalidV4AddressError(AddrV4::ParseStatus kind, UInt offset) noexcept
+        : n_bits(static_cast<UInt32>(kind) | (static_cast<UInt32>(std::min<UInt>(offset, 0xFFFFFF)) << 8))
+    {
     }
 
-    static auto maxOctetNumber() noexcept -> InvalidV4AddressError
+    /// Returns why the input was rejected.
+    [[nodiscard]] constexpr auto Kind() const noexcept -> AddrV4::ParseStatus
     {
-        InvalidV4AddressError error;
-        error.n_kind = kind_t::kMaxOctetNumber;
-
-        return error;
+        return static_cast<AddrV4::ParseStatus>(this->n_bits & 0xFF);
     }
 
-    static auto notAtleast4Octets() noexcept -> InvalidV4AddressError
+    /// Returns the byte offset into the input where the offending octet starts.
+    [[nodiscard]] constexpr auto Offset() const noexcept -> UInt
     {
-        InvalidV4AddressError error;
-        error.n_kind = kind_t::kNotAtleast4Octets;
+        return this->n_bits >> 8;
+    }
 
-        return error;
+    /// Returns a string description of the error.
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const InvalidV4AddressError& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
     }
 
-    Optional<std::error_code> n_errorCode;
-    kind_t n_kind = kind_t::kMax;
+    constexpr auto operator==(const InvalidV4AddressError&) const noexcept -> bool = default;
+
+private:
+    // The `ParseStatus` in the low byte and the offset above it. Keeping it a single word (rather than two
+    // fields) lets compilers build and copy the `Result` it's returned in with whole-register moves;
+    // GCC otherwise assembles it piecewise on the stack and stalls on the reload.
+    UInt32 n_bits;
 };
 
+static_assert(sizeof(InvalidV4AddressError) == 4);
+static_assert(std::is_trivially_copyable_v<InvalidV4AddressError>);
+
 } // namespace violet::net::ip
 
+namespace violet::net::literals {
+
+/// Parses an IPv4 address at compile time; invalid text is a compile error.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/AddrV4.h>
+///
+/// using namespace violet::net::literals;
+///
+/// constexpr auto gateway = "10.0.0.1"_ipv4;
+/// ```
+consteval auto operator""_ipv4(const char* str, UInt size) noexcept -> ip::AddrV4
+{
+    auto addr = ip::AddrV4::Parse(Str(str, size));
+    if (!addr) {
+        ip::detail::InvalidAddressLiteral();
+    }
+
+    return addr.Unwrap();
+}
+
+} // namespace violet::net::literals
+
 VIOLET_FORMATTER(violet::net::ip::InvalidV4AddressError);
 VIOLET_FORMATTER(violet::net::ip::AddrV4);
 
+// unlike `std::hash<UInt32>`, which is the identity, this spreads the addresses of a subnet over every bit,
+// so that tables which pick a bucket by the low or the high bits both work
 template<>
 struct std::hash<violet::net::ip::AddrV4> final {
     auto operator()(const violet::net::ip::AddrV4& addr) const noexcept -> violet::UInt
     {
-        return std::hash<violet::UInt32>{ }(addr.AsUInt32());
+        return FixedHash(addr);
     }
 };
+
+#if defined(VIOLET_NET_HEADER_ONLY) && VIOLET_NET_HEADER_ONLY
+    #include <violet/Networking/IP/AddrV4-inl.h> // IWYU pragma: export
+#endif
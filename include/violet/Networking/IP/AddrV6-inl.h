@@ -0,0 +1,190 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/AddrV6.h>
+#include <violet/Networking/IP/Tables.h>
+#include <violet/Networking/Inline.h>
+
+#include <algorithm>
+#include <charconv>
+
+namespace violet::net::ip {
+
+VIOLET_NET_INLINE auto InvalidV6AddressError::ToString() const noexcept -> String
+{
+    String suffix;
+    switch (this->Kind()) {
+    case AddrV6::ParseStatus::kInvalidNumberOfParts:
+        suffix = "invalid number of parts";
+        break;
+
+    case AddrV6::ParseStatus::kInvalidIntegral:
+        suffix = std::format(
+            "failed to parse integral value: {}", std::make_error_code(std::errc::invalid_argument).message());
+        break;
+
+    case AddrV6::ParseStatus::kIntegralOutOfRange:
+        suffix = std::format(
+            "failed to parse integral value: {}", std::make_error_code(std::errc::result_out_of_range).message());
+        break;
+
+    case AddrV6::ParseStatus::kMultipleColon:
+        suffix = "multiple `::` was found";
+        break;
+
+    default:
+        VIOLET_UNREACHABLE();
+    }
+
+    return std::format("invalid IPv6 address: {}", suffix);
+}
+
+VIOLET_NET_INLINE auto AddrV6::FromStr(Str input) noexcept -> Result<AddrV6, InvalidV6AddressError>
+{
+    AddrV6 addr;
+    UInt offset = 0;
+    if (auto status = detail::ParseV6(input, addr, offset); status != ParseStatus::kOk) {
+        return Err(InvalidV6AddressError(status, offset));
+    }
+
+    return addr;
+}
+
+VIOLET_NET_INLINE auto AddrV6::ParseMany(
+    Span<const Str> inputs, Span<AddrV6> out, Span<ParseStatus> status) noexcept -> UInt
+{
+    VIOLET_DEBUG_ASSERT(out.size() >= inputs.size() && status.size() >= inputs.size(),
+        "output spans are smaller than the input");
+
+    UInt parsed = 0;
+    for (UInt i = 0; i < inputs.size(); ++i) {
+        AddrV6 addr;
+        const ParseStatus result = detail::ParseV6(inputs[i], addr);
+
+        out[i] = addr; // left as `::` on failure
+        status[i] = result;
+        parsed += static_cast<UInt>(result == ParseStatus::kOk);
+    }
+
+    return parsed;
+}
+
+VIOLET_NET_INLINE void AddrV6::Classify(Span<const AddrV6> addrs, Span<AddrClassSet> out) noexcept
+{
+    VIOLET_DEBUG_ASSERT(out.size() >= addrs.size(), "output span is smaller than the input");
+
+    // Each address is already two 64-bit words, so the scalar word compares in `ClassifyV6` are as
+    // wide as a 128-bit lane would be; the loop is left to the compiler to unroll.
+    for (UInt i = 0; i < addrs.size(); ++i) {
+        out[i] = addrs[i].Classify();
+    }
+}
+
+VIOLET_NET_INLINE auto AddrV6::ToChars(char* first, char* last) const noexcept -> std::to_chars_result
+{
+    // fast path: if a v6 address is ipv4-mapped (`::ffff:a.b.c.d`)
+    if (this->IPv4Mapped()) {
+        return detail::WriteBounded<kMaxStringLength>(first, last, [this](char* out) -> char* {
+            constexpr Str kPrefix = "::ffff:";
+            std::memcpy(out, kPrefix.data(), kPrefix.size());
+
+            out = detail::WriteOctet(out + kPrefix.size(), static_cast<UInt8>(this->n_low >> 24));
+            *out++ = '.';
+            out = detail::WriteOctet(out, static_cast<UInt8>(this->n_low >> 16));
+            *out++ = '.';
+            out = detail::WriteOctet(out, static_cast<UInt8>(this->n_low >> 8));
+            *out++ = '.';
+
+            return detail::WriteOctet(out, static_cast<UInt8>(this->n_low));
+        });
+    }
+
+    Array<UInt16, 8> hextets{ };
+    for (Int32 i = 0; i < 4; ++i) {
+        hextets[i] = static_cast<UInt16>(this->n_high >> ((3 - i) * 16));
+        hextets[i + 4] = static_cast<UInt16>(this->n_low >> ((3 - i) * 16));
+    }
+
+    Int32 bestStart = -1;
+    Int32 bestLength = 0;
+
+    Int32 currStart = -1;
+    Int32 currLength = 0;
+
+    for (Int32 i = 0; i < 8; ++i) {
+        if (hextets[i] == 0) {
+            if (currStart == -1) {
+                currStart = i;
+            }
+
+            currLength++;
+        } else {
+            if (currLength > bestLength) {
+                bestStart = currStart;
+                bestLength = currLength;
+            }
+
+            currStart = -1;
+            currLength = 0;
+        }
+    }
+
+    if (currLength > bestLength) {
+        bestStart = currStart;
+        bestLength = currLength;
+    }
+
+    if (bestLength < 2) {
+        bestStart = -1;
+    }
+
+    return detail::WriteBounded<kMaxStringLength>(first, last, [&](char* out) -> char* {
+        for (Int32 i = 0; i < 8; ++i) {
+            if (i == bestStart) {
+                *out++ = ':';
+                *out++ = ':';
+                i += bestLength - 1;
+
+                continue;
+            }
+
+            if (i != 0 && i != bestStart + bestLength) {
+                *out++ = ':';
+            }
+
+            out = detail::WriteHextet(out, hextets[i]);
+        }
+
+        return out;
+    });
+}
+
+VIOLET_NET_INLINE auto AddrV6::ToString() const noexcept -> String
+{
+    Array<char, kMaxStringLength> buf;
+    auto [end, _] = this->ToChars(buf.data(), buf.data() + buf.size());
+
+    return { buf.data(), end };
+}
+
+} // namespace violet::net::ip
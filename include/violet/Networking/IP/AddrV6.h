@@ -23,54 +23,69 @@
 
 #include <violet/Container/Optional.h>
 #include <violet/Container/Result.h>
+#include <violet/Networking/IP/AddrClass.h>
+#include <violet/Networking/IP/FixedHash.h>
+#include <violet/Networking/IP/Parsing.h>
 
 #include "absl/numeric/int128.h"
 
+#include <algorithm>
+#include <charconv>
 #include <functional>
+#include <utility>
 
 namespace violet::net::ip {
 
 struct InvalidV6AddressError;
 
 struct VIOLET_API AddrV6 final {
-    constexpr VIOLET_IMPLICIT AddrV6() noexcept
-        : AddrV6(0, 0, 0, 0, 0, 0, 0, 0)
-    {
-    }
+    /// Maximum length of the string representation of an IPv6 address
+    /// (`ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255`).
+    constexpr static UInt kMaxStringLength = 45;
+
+    /// Outcome of parsing a single input with `ParseMany`. Every error kind corresponds to the
+    /// [`InvalidV6AddressError`] that `FromStr` would return for the same input.
+    enum struct ParseStatus : UInt8 {
+        kOk = 0,
+        kInvalidNumberOfParts = 1, ///< too many or too few hextets, or an empty one
+        kInvalidIntegral = 2, ///< a hextet or embedded IPv4 octet isn't a number
+        kIntegralOutOfRange = 3, ///< an embedded IPv4 octet is larger than `255`
+        kMultipleColon = 4 ///< more than one `::`
+    };
+
+    constexpr VIOLET_IMPLICIT AddrV6() noexcept = default;
 
     constexpr VIOLET_IMPLICIT AddrV6(Array<UInt8, 16> bytes)
-        : n_bytes(bytes)
     {
+        for (Int32 i = 0; i < 8; ++i) {
+            this->n_high = (this->n_high << 8) | bytes[i];
+            this->n_low = (this->n_low << 8) | bytes[i + 8];
+        }
     }
 
     constexpr VIOLET_IMPLICIT AddrV6(absl::uint128 value) noexcept
+        : n_high(absl::Uint128High64(value))
+        , n_low(absl::Uint128Low64(value))
     {
-        for (Int32 i = 0; i < 16; ++i) {
-            this->n_bytes[i] = static_cast<UInt8>((value >> ((15 - i) * 8)) & 0xFF);
-        }
     }
 
     constexpr VIOLET_IMPLICIT AddrV6(UInt16 first, UInt16 second, UInt16 third, UInt16 fourth, UInt16 fifth,
         UInt16 sixth, UInt16 seventh, UInt16 eighth) noexcept
-        : n_bytes({
-              static_cast<UInt8>((first >> 8) & 0xFF),
-              static_cast<UInt8>(first & 0xFF),
-              static_cast<UInt8>((second >> 8) & 0xFF),
-              static_cast<UInt8>(second & 0xFF),
-              static_cast<UInt8>((third >> 8) & 0xFF),
-              static_cast<UInt8>(third & 0xFF),
-              static_cast<UInt8>((fourth >> 8) & 0xFF),
-              static_cast<UInt8>(fourth & 0xFF),
-              static_cast<UInt8>((fifth >> 8) & 0xFF),
-              static_cast<UInt8>(fifth & 0xFF),
-              static_cast<UInt8>((sixth >> 8) & 0xFF),
-              static_cast<UInt8>(sixth & 0xFF),
-              static_cast<UInt8>((seventh >> 8) & 0xFF),
-              static_cast<UInt8>(seventh & 0xFF),
-              static_cast<UInt8>((eighth >> 8) & 0xFF),
-              static_cast<UInt8>(eighth & 0xFF),
-          })
+        : n_high((static_cast<UInt64>(first) << 48) | (static_cast<UInt64>(second) << 32)
+              | (static_cast<UInt64>(third) << 16) | static_cast<UInt64>(fourth))
+        , n_low((static_cast<UInt64>(fifth) << 48) | (static_cast<UInt64>(sixth) << 32)
+              | (static_cast<UInt64>(seventh) << 16) | static_cast<UInt64>(eighth))
+    {
+    }
+
+    /// Constructs an IPv6 address from its most and least significant 64 bits.
+    constexpr static auto FromWords(UInt64 high, UInt64 low) noexcept -> AddrV6
     {
+        AddrV6 addr;
+        addr.n_high = high;
+        addr.n_low = low;
+
+        return addr;
     }
 
     constexpr static auto Localhost() noexcept -> AddrV6
@@ -80,31 +95,31 @@ struct VIOLET_API AddrV6 final {
 
     static auto FromStr(Str input) noexcept -> Result<AddrV6, InvalidV6AddressError>;
 
+    /// Parses an IPv6 address like `FromStr`, but returns **Nothing** instead of an error so that it can
+    /// be used in constant expressions; see `AddrV4::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<AddrV6>;
+
+    /// Parses every string in `inputs`, writing the address for `inputs[i]` to `out[i]` and its outcome to
+    /// `status[i]`; see `AddrV4::ParseMany`. Inputs that fail to parse are written as `::`.
+    ///
+    /// `out` and `status` must be at least as large as `inputs`.
+    ///
+    /// @returns the number of inputs that were parsed successfully.
+    static auto ParseMany(Span<const Str> inputs, Span<AddrV6> out, Span<ParseStatus> status) noexcept -> UInt;
+
     [[nodiscard]] constexpr auto Loopback() const noexcept -> bool
     {
-        for (Int32 i = 0; i < 15; ++i) {
-            if (this->n_bytes[i] != 0) {
-                return false;
-            }
-        }
-
-        return this->n_bytes[15] == 1;
+        return this->n_high == 0 && this->n_low == 1;
     }
 
     [[nodiscard]] constexpr auto Unspecified() const noexcept -> bool
     {
-        for (auto byte: this->n_bytes) {
-            if (byte != 0) {
-                return false;
-            }
-        }
-
-        return true;
+        return (this->n_high | this->n_low) == 0;
     }
 
     [[nodiscard]] constexpr auto Multicast() const noexcept -> bool
     {
-        return this->n_bytes[0] == 0xFF;
+        return (this->n_high >> 56) == 0xFF;
     }
 
     [[nodiscard]] constexpr auto Unicast() const noexcept -> bool
@@ -119,54 +134,78 @@ struct VIOLET_API AddrV6 final {
 
     [[nodiscard]] constexpr auto LinkLocal() const noexcept -> bool
     {
-        return (this->n_bytes[0] == 0xFE) && ((this->n_bytes[1] & 0xC0) == 0x80);
+        return (this->n_high >> 54) == (0xFE80 >> 6); // fe80::/10
     }
 
     [[nodiscard]] constexpr auto UniqueLocal() const noexcept -> bool
     {
-        return (this->n_bytes[0] & 0xFE) == 0xFC;
+        return (this->n_high >> 57) == (0xFC >> 1); // fc00::/7
     }
 
     [[nodiscard]] constexpr auto IPv4Mapped() const noexcept -> bool
     {
-        for (Int32 i = 0; i < 10; ++i) {
-            if (this->n_bytes[i] != 0) {
-                return false;
-            }
-        }
-
-        return this->n_bytes[10] == 0xFF && this->n_bytes[11] == 0xFF;
+        return this->n_high == 0 && (this->n_low >> 32) == 0xFFFF; // ::ffff:0:0/96
     }
 
     [[nodiscard]] constexpr auto Documentation() const noexcept -> bool
     {
-        return this->n_bytes[0] == 0x20 && this->n_bytes[1] == 0x01 && this->n_bytes[2] == 0x0d
-            && this->n_bytes[3] == 0xb8;
+        return (this->n_high >> 32) == 0x20010DB8; // 2001:db8::/32
     }
 
     [[nodiscard]] constexpr auto Benchmarking() const noexcept -> bool
     {
-        return this->n_bytes[0] == 0x20 && this->n_bytes[1] == 0x01 && this->n_bytes[2] == 0x00
-            && this->n_bytes[3] == 0x02;
+        return (this->n_high >> 16) == 0x200100020000; // 2001:2::/48
     }
 
+    /// Returns every special-purpose category this address belongs to in a single pass; see
+    /// `AddrV4::Classify()`.
+    [[nodiscard]] constexpr auto Classify() const noexcept -> AddrClassSet
+    {
+        return detail::ClassifyV6(this->n_high, this->n_low);
+    }
+
+    /// Classifies every address in `addrs`, writing the result for `addrs[i]` to `out[i]`.
+    ///
+    /// `out` must be at least as large as `addrs`.
+    static void Classify(Span<const AddrV6> addrs, Span<AddrClassSet> out) noexcept;
+
     [[nodiscard]] constexpr auto AsUInt128() const noexcept -> absl::uint128
     {
-        absl::uint128 result = 0;
-        auto octets = this->Hextets();
+        return absl::MakeUint128(this->n_high, this->n_low);
+    }
 
-        for (Int32 i = 0; i < 16; ++i) {
-            result |= absl::uint128(octets[i]) << ((15 - i) * 8);
-        }
+    /// Returns the most significant 64 bits (the first four hextets).
+    [[nodiscard]] constexpr auto High64() const noexcept -> UInt64
+    {
+        return this->n_high;
+    }
 
-        return result;
+    /// Returns the least significant 64 bits (the last four hextets).
+    [[nodiscard]] constexpr auto Low64() const noexcept -> UInt64
+    {
+        return this->n_low;
     }
 
+    /// Returns the 16 bytes of this address in network-byte order.
     [[nodiscard]] constexpr auto Hextets() const noexcept -> Array<UInt8, 16>
     {
-        return this->n_bytes;
+        Array<UInt8, 16> bytes{ };
+        for (Int32 i = 0; i < 8; ++i) {
+            bytes[i] = static_cast<UInt8>(this->n_high >> ((7 - i) * 8));
+            bytes[i + 8] = static_cast<UInt8>(this->n_low >> ((7 - i) * 8));
+        }
+
+        return bytes;
     }
 
+    /// Writes the [RFC 5952](https://tools.ietf.org/html/rfc5952) representation of this address into
+    /// `[first, last)` without allocating.
+    ///
+    /// On success, the returned `ptr` points one past the last character written; the output is **not**
+    /// NUL-terminated. If the range can't hold the address, `ec` is `std::errc::value_too_large` and
+    /// `ptr` is `last`, just like [`std::to_chars`](https://en.cppreference.com/w/cpp/utility/to_chars).
+    auto ToChars(char* first, char* last) const noexcept -> std::to_chars_result;
+
     [[nodiscard]] auto ToString() const noexcept -> String;
     friend auto operator<<(std::ostream& os, const AddrV6& self) noexcept -> std::ostream&
     {
@@ -185,7 +224,7 @@ struct VIOLET_API AddrV6 final {
 
     constexpr friend auto operator==(const AddrV6& lhs, const AddrV6& rhs) noexcept -> bool
     {
-        return lhs.AsUInt128() == rhs.AsUInt128();
+        return ((lhs.n_high ^ rhs.n_high) | (lhs.n_low ^ rhs.n_low)) == 0;
     }
 
     constexpr friend auto operator!=(const AddrV6& lhs, const AddrV6& rhs) noexcept -> bool
@@ -195,121 +234,343 @@ struct VIOLET_API AddrV6 final {
 
     constexpr friend auto operator<=>(const AddrV6& lhs, const AddrV6& rhs) noexcept -> std::strong_ordering
     {
-        return lhs.AsUInt128() <=> rhs.AsUInt128();
+        if (lhs.n_high != rhs.n_high) {
+            return lhs.n_high <=> rhs.n_high;
+        }
+
+        return lhs.n_low <=> rhs.n_low;
     }
 
     constexpr friend auto operator&(const AddrV6& lhs, const AddrV6& rhs) noexcept -> AddrV6
     {
-        return lhs.AsUInt128() & rhs.AsUInt128();
+        return AddrV6::FromWords(lhs.n_high & rhs.n_high, lhs.n_low & rhs.n_low);
     }
 
     constexpr friend auto operator|(const AddrV6& lhs, const AddrV6& rhs) noexcept -> AddrV6
     {
-        return lhs.AsUInt128() | rhs.AsUInt128();
+        return AddrV6::FromWords(lhs.n_high | rhs.n_high, lhs.n_low | rhs.n_low);
     }
 
     constexpr friend auto operator^(const AddrV6& lhs, const AddrV6& rhs) noexcept -> AddrV6
     {
-        return lhs.AsUInt128() ^ rhs.AsUInt128();
+        return AddrV6::FromWords(lhs.n_high ^ rhs.n_high, lhs.n_low ^ rhs.n_low);
     }
 
     constexpr friend auto operator~(const AddrV6& ip) noexcept -> AddrV6
     {
-        return ~ip.AsUInt128();
+        return AddrV6::FromWords(~ip.n_high, ~ip.n_low);
     }
 
     constexpr friend auto operator&=(AddrV6& lhs, const AddrV6& rhs) noexcept -> AddrV6&
     {
-        lhs = lhs.AsUInt128() & rhs.AsUInt128();
+        lhs.n_high &= rhs.n_high;
+        lhs.n_low &= rhs.n_low;
+
         return lhs;
     }
 
     constexpr friend auto operator|=(AddrV6& lhs, const AddrV6& rhs) noexcept -> AddrV6&
     {
-        lhs = lhs.AsUInt128() | rhs.AsUInt128();
+        lhs.n_high |= rhs.n_high;
+        lhs.n_low |= rhs.n_low;
+
         return lhs;
     }
 
     constexpr friend auto operator^=(AddrV6& lhs, const AddrV6& rhs) noexcept -> AddrV6&
     {
-        lhs = lhs.AsUInt128() ^ rhs.AsUInt128();
+        lhs.n_high ^= rhs.n_high;
+        lhs.n_low ^= rhs.n_low;
+
         return lhs;
     }
 
-private:
-    Array<UInt8, 16> n_bytes{ };
-};
-
-/// Represents an error returned when parsing an invalid IPv4 address.
-struct VIOLET_API InvalidV6AddressError final {
-    /// Returns a string description of the error.
-    [[nodiscard]] auto ToString() const noexcept -> String;
-    friend auto operator<<(std::ostream& os, const InvalidV6AddressError& self) noexcept -> std::ostream&
+    template<typename H>
+    friend auto AbslHashValue(H state, const AddrV6& addr) -> H
     {
-        return os << self.ToString();
+        return H::combine(std::move(state), addr.n_high, addr.n_low);
     }
 
 private:
-    friend auto AddrV6::FromStr(Str input) noexcept -> Result<AddrV6, InvalidV6AddressError>;
-    constexpr VIOLET_IMPLICIT InvalidV6AddressError() noexcept = default;
+    // Both words are host-endian integers holding the address in network order, i.e. `n_high` is
+    // hextets 0..3 and `n_low` hextets 4..7; comparing them as integers is the address order.
+    UInt64 n_high = 0;
+    UInt64 n_low = 0;
+};
+
+static_assert(sizeof(AddrV6) == 16);
+static_assert(std::is_trivially_copyable_v<AddrV6>);
+
+/// Returns the 64-bit hash of `address` that never changes; see `<violet/Networking/IP/FixedHash.h>`. An
+/// IPv4 address and the IPv6 address with the same bits hash differently.
+constexpr auto FixedHash(const AddrV6& address, UInt64 seed = 0) noexcept -> UInt64
+{
+    const UInt64 high = detail::Mix64(address.High64() ^ (seed * detail::kSeedMultiplier) ^ 0x6A09E667F3BCC909);
+    return detail::Mix64(high ^ address.Low64());
+}
 
-    enum struct kind_t : violet::UInt8 {
-        kInvalidNumberOfParts = 0,
-        kFailedIntegralParsing = 1,
-        kPartTooLarge = 2,
-        kMultipleColon = 3,
+namespace detail {
 
-        kMax = std::numeric_limits<std::underlying_type_t<kind_t>>::max()
+/// The reference IPv6 parser behind `AddrV6::FromStr`, `AddrV6::Parse` and `AddrV6::ParseMany`; on
+/// success the address is written to `out`, otherwise `offset` is set to the byte where parsing failed.
+constexpr auto ParseV6(Str input, AddrV6& out, UInt& offset) noexcept -> AddrV6::ParseStatus
+{
+    using ParseStatus = AddrV6::ParseStatus;
+
+    const auto fail = [&offset](ParseStatus status, UInt at) -> ParseStatus {
+        offset = at;
+        return status;
     };
 
-    static auto invalidNumberOfParts() noexcept -> InvalidV6AddressError
-    {
-        InvalidV6AddressError error;
-        error.n_kind = kind_t::kInvalidNumberOfParts;
+    if (input.empty()) {
+        return fail(ParseStatus::kInvalidNumberOfParts, 0);
+    }
+
+    const UInt size = input.size();
+    const auto byteAt = [input](UInt idx) -> UInt8 { return static_cast<UInt8>(input[idx]); };
 
-        return error;
+    // Hextets are parsed left to right into `hextets`; if a `::` was seen, everything parsed after it
+    // is moved to the end of the array once the whole input has been consumed.
+    Array<UInt16, 8> hextets{ };
+    UInt count = 0;
+    UInt pos = 0;
+
+    bool compressed = false;
+    UInt gap = 0; // number of hextets in front of the `::`
+
+    if (byteAt(0) == ':') {
+        if (size == 1 || byteAt(1) != ':') {
+            return fail(ParseStatus::kInvalidNumberOfParts, 0);
+        }
+
+        compressed = true;
+        pos = 2;
     }
 
-    static auto invalidIntegral(std::errc code) noexcept -> InvalidV6AddressError
-    {
-        InvalidV6AddressError error;
-        error.n_kind = kind_t::kFailedIntegralParsing;
-        error.n_errorCode = std::make_error_code(code);
+    while (pos < size) {
+        const UInt start = pos;
+
+        UInt32 value = 0;
+        while (pos < size && kHexValues[byteAt(pos)] != kNotHex) {
+            value = (value << 4) | kHexValues[byteAt(pos)];
+            ++pos;
+        }
+
+        // an embedded IPv4 address (`::ffff:192.168.0.1`), which has to be the last part
+        if (pos < size && byteAt(pos) == '.') {
+            if (count > 6) {
+                return fail(ParseStatus::kInvalidNumberOfParts, start);
+            }
+
+            pos = start;
+
+            UInt32 address = 0;
+            for (UInt octet = 0; octet < 4; ++octet) {
+                if (octet != 0) {
+                    if (pos >= size || byteAt(pos) != '.') {
+                        return fail(ParseStatus::kInvalidIntegral, pos);
+                    }
+
+                    ++pos;
+                }
+
+                const UInt digitsStart = pos;
+                UInt32 octetValue = 0;
+                while (pos < size && static_cast<UInt8>(byteAt(pos) - '0') <= 9) {
+                    octetValue = (octetValue * 10) + (byteAt(pos) - '0');
+                    if (octetValue > 255) {
+                        return fail(ParseStatus::kIntegralOutOfRange, digitsStart);
+                    }
+
+                    ++pos;
+                }
+
+                if (pos == digitsStart) {
+                    return fail(ParseStatus::kInvalidIntegral, pos);
+                }
+
+                address = (address << 8) | octetValue;
+            }
 
-        return error;
+            if (pos != size) {
+                if (byteAt(pos) == '.' || byteAt(pos) == ':') {
+                    return fail(ParseStatus::kInvalidNumberOfParts, pos);
+                }
+
+                return fail(ParseStatus::kInvalidIntegral, pos);
+            }
+
+            hextets[count++] = static_cast<UInt16>(address >> 16);
+            hextets[count++] = static_cast<UInt16>(address & 0xFFFF);
+            break;
+        }
+
+        const UInt length = pos - start;
+        if (length == 0) {
+            // `:::`, `1::2:`, ... are empty parts; anything else is a character that isn't a hex digit
+            if (pos == size || byteAt(pos) == ':') {
+                return fail(ParseStatus::kInvalidNumberOfParts, pos);
+            }
+
+            return fail(ParseStatus::kInvalidIntegral, pos);
+        }
+
+        if (length > 4) {
+            return fail(ParseStatus::kInvalidIntegral, start);
+        }
+
+        if (count == 8) {
+            return fail(ParseStatus::kInvalidNumberOfParts, start);
+        }
+
+        hextets[count++] = static_cast<UInt16>(value);
+        if (pos == size) {
+            break;
+        }
+
+        if (byteAt(pos) != ':') {
+            return fail(ParseStatus::kInvalidIntegral, pos);
+        }
+
+        if (++pos == size) {
+            return fail(ParseStatus::kInvalidNumberOfParts, pos);
+        }
+
+        if (byteAt(pos) == ':') {
+            if (compressed) {
+                return fail(ParseStatus::kMultipleColon, pos - 1);
+            }
+
+            compressed = true;
+            gap = count;
+            ++pos;
+        }
     }
 
-    static auto partTooLarge() noexcept -> InvalidV6AddressError
+    if (!compressed) {
+        if (count != 8) {
+            return fail(ParseStatus::kInvalidNumberOfParts, size);
+        }
+    } else {
+        const UInt tail = count - gap;
+        std::copy_backward(hextets.begin() + static_cast<std::ptrdiff_t>(gap),
+            hextets.begin() + static_cast<std::ptrdiff_t>(count), hextets.end());
+        std::fill(hextets.begin() + static_cast<std::ptrdiff_t>(gap), hextets.end() - static_cast<std::ptrdiff_t>(tail),
+            static_cast<UInt16>(0));
+    }
+
+    out = AddrV6(hextets[0], hextets[1], hextets[2], hextets[3], hextets[4], hextets[5], hextets[6], hextets[7]);
+    return ParseStatus::kOk;
+}
+
+constexpr auto ParseV6(Str input, AddrV6& out) noexcept -> AddrV6::ParseStatus
+{
+    UInt offset = 0;
+    return ParseV6(input, out, offset);
+}
+
+} // namespace detail
+
+constexpr auto AddrV6::Parse(Str input) noexcept -> Optional<AddrV6>
+{
+    if (AddrV6 addr; detail::ParseV6(input, addr) == ParseStatus::kOk) {
+        return addr;
+    }
+
+    return Nothing;
+}
+
+/// Represents an error returned when parsing an invalid IPv6 address.
+///
+/// Like [`InvalidV4AddressError`], this is only the [`AddrV6::ParseStatus`] and the byte offset where
+/// parsing failed; the message is built by `ToString`.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/AddrV6.h>
+///
+/// using violet::net::ip::AddrV6;
+///
+/// auto error = AddrV6::FromStr("2001:db8::1::2").Error();
+/// // error.Kind() == AddrV6::ParseStatus::kMultipleColon
+/// // error.Offset() == 11
+/// ```
+struct VIOLET_API InvalidV6AddressError final {
+    /// Creates an error of the given kind; `kind` can't be [`AddrV6::ParseStatus::kOk`]. Offsets that
+    /// don't fit in 24 bits are clamped.
+    constexpr InvalidV6AddressError(AddrV6::ParseStatus kind, UInt offset) noexcept
+        : n_bits(static_cast<UInt32>(kind) | (static_cast<UInt32>(std::min<UInt>(offset, 0xFFFFFF)) << 8))
     {
-        InvalidV6AddressError error;
-        error.n_kind = kind_t::kPartTooLarge;
+    }
 
-        return error;
+    /// Returns why the input was rejected.
+    [[nodiscard]] constexpr auto Kind() const noexcept -> AddrV6::ParseStatus
+    {
+        return static_cast<AddrV6::ParseStatus>(this->n_bits & 0xFF);
     }
 
-    static auto multipleDoubleColon() noexcept -> InvalidV6AddressError
+    /// Returns the byte offset into the input where parsing failed.
+    [[nodiscard]] constexpr auto Offset() const noexcept -> UInt
     {
-        InvalidV6AddressError error;
-        error.n_kind = kind_t::kMultipleColon;
+        return this->n_bits >> 8;
+    }
 
-        return error;
+    /// Returns a string description of the error.
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const InvalidV6AddressError& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
     }
 
-    Optional<std::error_code> n_errorCode;
-    kind_t n_kind = kind_t::kMax;
+    constexpr auto operator==(const InvalidV6AddressError&) const noexcept -> bool = default;
+
+private:
+    // same layout as `InvalidV4AddressError::n_bits`
+    UInt32 n_bits;
 };
 
+static_assert(sizeof(InvalidV6AddressError) == 4);
+static_assert(std::is_trivially_copyable_v<InvalidV6AddressError>);
+
 } // namespace violet::net::ip
 
+namespace violet::net::literals {
+
+/// Parses an IPv6 address at compile time; invalid text is a compile error.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/AddrV6.h>
+///
+/// using namespace violet::net::literals;
+///
+/// constexpr auto router = "fe80::1"_ipv6;
+/// ```
+consteval auto operator""_ipv6(const char* str, UInt size) noexcept -> ip::AddrV6
+{
+    auto addr = ip::AddrV6::Parse(Str(str, size));
+    if (!addr) {
+        ip::detail::InvalidAddressLiteral();
+    }
+
+    return addr.Unwrap();
+}
+
+} // namespace violet::net::literals
+
 // VIOLET_FORMATTER(violet::net::ip::InvalidV6AddressError);
 VIOLET_FORMATTER(violet::net::ip::AddrV6);
 
+// both words are mixed in turn: combining their hashes with a shift and a xor made the hosts of
+// neighbouring subnets collide, e.g. `2001:db8:0:2::1` with `2001:db8::`
 template<>
 struct std::hash<violet::net::ip::AddrV6> final {
     auto operator()(const violet::net::ip::AddrV6& addr) const noexcept -> violet::UInt
     {
-        auto value = addr.AsUInt128();
-        return std::hash<violet::UInt64>{ }(absl::Uint128High64(value))
-            ^ (std::hash<violet::UInt64>{ }(absl::Uint128Low64(value)) << 1);
+        return FixedHash(addr);
     }
 };
+
+#if defined(VIOLET_NET_HEADER_ONLY) && VIOLET_NET_HEADER_ONLY
+    #include <violet/Networking/IP/AddrV6-inl.h> // IWYU pragma: export
+#endif
@@ -0,0 +1,154 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/FixedHash.h>
+
+#include <algorithm>
+
+namespace violet::net::ip {
+
+/// An approximate set of addresses that never forgets an address it was given but may claim to have
+/// others: a split-block Bloom filter, as used by Parquet and Impala. With the default of 12 bits per
+/// address, about 0.5% of the addresses that were never inserted are reported as possibly there.
+///
+/// `Key` is [`AddrV4`], [`AddrV6`] or [`IPAddress`]; it's hashed with [`FixedHash`], which is found by
+/// argument-dependent lookup, so other keys only need an overload of it.
+///
+/// The filter is an array of 32-byte blocks of eight 32-bit words. An address picks a block with its
+/// hash, and sets or tests one bit in each of its eight words, so a query is a single memory access
+/// whose eight tests are independent of each other and compile to a few vector instructions. Queries
+/// for addresses that aren't in the filter usually stop being expensive there: that's the point of
+/// putting one in front of a slower lookup.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/BloomFilter.h>
+///
+/// using namespace violet::net::ip;
+///
+/// BloomFilter<AddrV4> blocklist(reputation.Size());
+/// for (const auto& [address, _]: reputation) {
+///     blocklist.Insert(address);
+/// }
+///
+/// if (blocklist.MayContain(source) && reputation.Lookup(source) == Reputation::kBad) {
+///     return Verdict::kDrop;
+/// }
+/// ```
+template<typename Key>
+struct BloomFilter final {
+    /// The number of bits of the filter per address that the default constructor aims for.
+    constexpr static UInt kDefaultBitsPerEntry = 12;
+
+    /// Constructs an empty filter for about `capacity` addresses, with `bitsPerEntry` bits for each;
+    /// more addresses can be inserted, at the cost of more false positives.
+    explicit BloomFilter(UInt capacity, UInt bitsPerEntry = kDefaultBitsPerEntry)
+        : n_blocks(std::max<UInt>(1, ((capacity * bitsPerEntry) + kBitsPerBlock - 1) / kBitsPerBlock))
+    {
+    }
+
+    /// Adds `key` to the filter.
+    void Insert(const Key& key) noexcept
+    {
+        const UInt64 hash = FixedHash(key, kSeed);
+        Block& block = this->blockOf(hash);
+
+        for (UInt i = 0; i < kWordsPerBlock; i++) {
+            block.Words[i] |= bitOf(static_cast<UInt32>(hash), i);
+        }
+    }
+
+    /// Returns **false** if `key` was never inserted, or **true** if it might have been.
+    [[nodiscard]] auto MayContain(const Key& key) const noexcept -> bool
+    {
+        const UInt64 hash = FixedHash(key, kSeed);
+        const Block& block = this->blockOf(hash);
+
+        // no early exit, so that the loop is vectorized
+        UInt32 missing = 0;
+        for (UInt i = 0; i < kWordsPerBlock; i++) {
+            missing |= bitOf(static_cast<UInt32>(hash), i) & ~block.Words[i];
+        }
+
+        return missing == 0;
+    }
+
+    /// Adds every address of `other` to this filter, which must have been constructed with the same
+    /// capacity and bits per address.
+    void Merge(const BloomFilter& other) noexcept
+    {
+        VIOLET_DEBUG_ASSERT(this->n_blocks.size() == other.n_blocks.size(), "filters have different sizes");
+
+        for (UInt i = 0; i < this->n_blocks.size(); i++) {
+            for (UInt j = 0; j < kWordsPerBlock; j++) {
+                this->n_blocks[i].Words[j] |= other.n_blocks[i].Words[j];
+            }
+        }
+    }
+
+    /// Removes every address.
+    void Clear() noexcept
+    {
+        std::ranges::fill(this->n_blocks, Block{ });
+    }
+
+    /// Returns the number of bytes used by the filter.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        return this->n_blocks.size() * sizeof(Block);
+    }
+
+private:
+    constexpr static UInt kWordsPerBlock = 8;
+    constexpr static UInt kBitsPerBlock = kWordsPerBlock * 32;
+    constexpr static UInt64 kSeed = 0xB100F11E;
+
+    // odd multipliers that pick the bit of each word from the low half of the hash, from the
+    // Parquet specification
+    constexpr static Array<UInt32, kWordsPerBlock> kSalts{ 0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D,
+        0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31 };
+
+    struct alignas(32) Block final {
+        Array<UInt32, kWordsPerBlock> Words{ };
+    };
+
+    constexpr static auto bitOf(UInt32 hash, UInt word) noexcept -> UInt32
+    {
+        return UInt32(1) << ((hash * kSalts[word]) >> 27);
+    }
+
+    // the high half of the hash picks the block, scaled rather than reduced modulo the block count
+    [[nodiscard]] auto blockOf(UInt64 hash) const noexcept -> const Block&
+    {
+        return this->n_blocks[((hash >> 32) * this->n_blocks.size()) >> 32];
+    }
+
+    [[nodiscard]] auto blockOf(UInt64 hash) noexcept -> Block&
+    {
+        return this->n_blocks[((hash >> 32) * this->n_blocks.size()) >> 32];
+    }
+
+    Vec<Block> n_blocks;
+};
+
+} // namespace violet::net::ip
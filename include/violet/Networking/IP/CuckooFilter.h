@@ -0,0 +1,286 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/FixedHash.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace violet::net::ip {
+
+/// An approximate set of addresses like [`BloomFilter`], that also supports removing them: a cuckoo
+/// filter (Fan et al., 2014) with four 16-bit fingerprints per bucket. At most about 0.012% of the
+/// addresses that were never inserted are reported as possibly there, which takes about 17 bits per
+/// address when the filter is as full as its capacity.
+///
+/// `Key` is [`AddrV4`], [`AddrV6`] or [`IPAddress`], hashed with [`FixedHash`] like for `BloomFilter`.
+///
+/// An address is stored as a fingerprint of its hash in one of two buckets, both of which a query
+/// checks. A bucket is one 64-bit word, and its four fingerprints are compared at once with a few
+/// integer instructions, so a query is two independent memory accesses and no branches.
+///
+/// Since only fingerprints are stored, inserting an address twice stores it twice, and removing an
+/// address that was never inserted may remove another one that has the same fingerprint. Only remove
+/// addresses that were inserted.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/CuckooFilter.h>
+///
+/// using namespace violet::net::ip;
+///
+/// CuckooFilter<AddrV6> quarantined(100'000);
+/// quarantined.Insert(AddrV6::FromStr("2001:db8::1").Unwrap());
+///
+/// if (quarantined.MayContain(source) && ...) { ... }
+/// quarantined.Remove(AddrV6::FromStr("2001:db8::1").Unwrap());
+/// ```
+template<typename Key>
+struct CuckooFilter final {
+    /// The number of fingerprints in a bucket.
+    constexpr static UInt kSlotsPerBucket = 4;
+
+    /// How many fingerprints `Insert` moves around before it gives up on a full filter.
+    constexpr static UInt kMaxKicks = 500;
+
+    /// Constructs an empty filter with room for at least `capacity` addresses.
+    explicit CuckooFilter(UInt capacity)
+        : n_buckets(bucketsFor(capacity), 0)
+    {
+    }
+
+    /// Adds `key` to the filter.
+    /// @returns **false** if the filter is full, in which case it's left as it was
+    auto Insert(const Key& key) noexcept -> bool
+    {
+        if (this->n_victim.Used) {
+            return false;
+        }
+
+        const UInt64 hash = FixedHash(key, kSeed);
+        this->insert(this->bucketOf(hash), fingerprintOf(hash));
+        this->n_size++;
+
+        return true;
+    }
+
+    /// Returns **false** if `key` isn't in the filter, or **true** if it might be.
+    [[nodiscard]] auto MayContain(const Key& key) const noexcept -> bool
+    {
+        const UInt64 hash = FixedHash(key, kSeed);
+        const UInt16 fingerprint = fingerprintOf(hash);
+        const UInt64 first = this->bucketOf(hash);
+        const UInt64 second = this->alternate(first, fingerprint);
+
+        const UInt64 found = matches(this->n_buckets[first], fingerprint)
+            | matches(this->n_buckets[second], fingerprint);
+
+        return found != 0
+            || (this->n_victim.Used && this->n_victim.Fingerprint == fingerprint
+                && (this->n_victim.Bucket == first || this->n_victim.Bucket == second));
+    }
+
+    /// Removes one copy of `key`, which must have been inserted.
+    /// @returns **true** if a fingerprint of `key` was removed
+    auto Remove(const Key& key) noexcept -> bool
+    {
+        const UInt64 hash = FixedHash(key, kSeed);
+        const UInt16 fingerprint = fingerprintOf(hash);
+        const UInt64 first = this->bucketOf(hash);
+        const UInt64 second = this->alternate(first, fingerprint);
+
+        if (this->n_victim.Used && this->n_victim.Fingerprint == fingerprint
+            && (this->n_victim.Bucket == first || this->n_victim.Bucket == second)) {
+            this->n_victim.Used = false;
+            this->n_size--;
+            return true;
+        }
+
+        if (!this->erase(first, fingerprint) && !this->erase(second, fingerprint)) {
+            return false;
+        }
+
+        this->n_size--;
+
+        // there's room again for the fingerprint that was kept aside
+        if (this->n_victim.Used) {
+            this->n_victim.Used = false;
+            this->insert(this->n_victim.Bucket, this->n_victim.Fingerprint);
+        }
+
+        return true;
+    }
+
+    /// Returns the number of addresses in the filter.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    /// Returns **true** if the filter has no addresses.
+    [[nodiscard]] auto Empty() const noexcept -> bool
+    {
+        return this->n_size == 0;
+    }
+
+    /// Returns the number of fingerprints the filter has room for; inserts start failing a bit before
+    /// it's full.
+    [[nodiscard]] auto Capacity() const noexcept -> UInt
+    {
+        return this->n_buckets.size() * kSlotsPerBucket;
+    }
+
+    /// Removes every address.
+    void Clear() noexcept
+    {
+        std::ranges::fill(this->n_buckets, 0);
+        this->n_victim = { };
+        this->n_size = 0;
+    }
+
+    /// Returns the number of bytes used by the filter.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        return this->n_buckets.size() * sizeof(UInt64);
+    }
+
+private:
+    constexpr static UInt64 kSeed = 0xC0C0F11E;
+
+    // enough buckets that `capacity` is 95% of the fingerprints, which is about how full four-slot
+    // buckets get before inserts start failing
+    constexpr static auto bucketsFor(UInt capacity) noexcept -> UInt
+    {
+        return std::max<UInt>(2, ((capacity * 100) + (kSlotsPerBucket * 95) - 1) / (kSlotsPerBucket * 95));
+    }
+
+    // scales the low half of the hash to the bucket count rather than reducing it modulo the count,
+    // which isn't a power of two so that the filter can be sized to its addresses
+    [[nodiscard]] auto bucketOf(UInt64 hash) const noexcept -> UInt64
+    {
+        return ((hash & 0xFFFFFFFF) * this->n_buckets.size()) >> 32;
+    }
+
+    // the high bits of the hash, since the low ones pick the bucket; `0` marks an empty slot
+    constexpr static auto fingerprintOf(UInt64 hash) noexcept -> UInt16
+    {
+        const auto fingerprint = static_cast<UInt16>(hash >> 48);
+        return fingerprint == 0 ? 1 : fingerprint;
+    }
+
+    // the lanes that hold `fingerprint` have their high bit set; only the lowest one is exact, which is
+    // all that's needed
+    constexpr static auto matches(UInt64 bucket, UInt16 fingerprint) noexcept -> UInt64
+    {
+        constexpr UInt64 kLow = 0x0001000100010001;
+        constexpr UInt64 kHigh = 0x8000800080008000;
+
+        const UInt64 difference = bucket ^ (fingerprint * kLow);
+        return (difference - kLow) & ~difference & kHigh;
+    }
+
+    // the other bucket of a fingerprint in `bucket`, `(h - bucket) mod n` for a hash `h` of the
+    // fingerprint; the same function takes it back
+    [[nodiscard]] auto alternate(UInt64 bucket, UInt16 fingerprint) const noexcept -> UInt64
+    {
+        const UInt64 offset = this->bucketOf(detail::Mix64(fingerprint));
+        return offset >= bucket ? offset - bucket : offset + this->n_buckets.size() - bucket;
+    }
+
+    auto place(UInt64 bucket, UInt16 fingerprint) noexcept -> bool
+    {
+        const UInt64 empty = matches(this->n_buckets[bucket], 0);
+        if (empty == 0) {
+            return false;
+        }
+
+        this->n_buckets[bucket] |= UInt64(fingerprint) << (std::countr_zero(empty) - 15);
+        return true;
+    }
+
+    auto erase(UInt64 bucket, UInt16 fingerprint) noexcept -> bool
+    {
+        const UInt64 found = matches(this->n_buckets[bucket], fingerprint);
+        if (found == 0) {
+            return false;
+        }
+
+        this->n_buckets[bucket] &= ~(UInt64(0xFFFF) << (std::countr_zero(found) - 15));
+        return true;
+    }
+
+    auto swap(UInt64 bucket, UInt slot, UInt16 fingerprint) noexcept -> UInt16
+    {
+        const UInt shift = slot * 16;
+        const auto previous = static_cast<UInt16>(this->n_buckets[bucket] >> shift);
+
+        this->n_buckets[bucket] &= ~(UInt64(0xFFFF) << shift);
+        this->n_buckets[bucket] |= UInt64(fingerprint) << shift;
+        return previous;
+    }
+
+    // stores `fingerprint` in `bucket` or its alternate. If both are full, fingerprints are moved to
+    // their other bucket until one has room; if none does, the last one is kept aside so that nothing
+    // is lost, and the next `Insert` reports the filter as full.
+    void insert(UInt64 bucket, UInt16 fingerprint) noexcept
+    {
+        const UInt64 other = this->alternate(bucket, fingerprint);
+        if (this->place(bucket, fingerprint) || this->place(other, fingerprint)) {
+            return;
+        }
+
+        bucket = (this->nextRandom() & 1) != 0 ? bucket : other;
+        for (UInt kick = 0; kick < kMaxKicks; kick++) {
+            fingerprint = this->swap(bucket, this->nextRandom() % kSlotsPerBucket, fingerprint);
+            bucket = this->alternate(bucket, fingerprint);
+
+            if (this->place(bucket, fingerprint)) {
+                return;
+            }
+        }
+
+        this->n_victim = { bucket, fingerprint, true };
+    }
+
+    // xorshift64, which only has to pick which fingerprint to move
+    auto nextRandom() noexcept -> UInt64
+    {
+        this->n_random ^= this->n_random << 13;
+        this->n_random ^= this->n_random >> 7;
+        this->n_random ^= this->n_random << 17;
+        return this->n_random;
+    }
+
+    struct Victim final {
+        UInt64 Bucket = 0;
+        UInt16 Fingerprint = 0;
+        bool Used = false;
+    };
+
+    Vec<UInt64> n_buckets;
+    UInt n_size = 0;
+    Victim n_victim;
+    UInt64 n_random = 0x2545F4914F6CDD1D;
+};
+
+} // namespace violet::net::ip
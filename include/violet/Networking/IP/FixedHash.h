@@ -0,0 +1,47 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Violet.h>
+
+/// `FixedHash` is a 64-bit hash that is the same on every platform, in every process and in every
+/// version of this library, unlike `std::hash` and `absl::Hash`. It's meant for data structures that are
+/// sized for their hash, like [`BloomFilter`] and [`CuckooFilter`], or that outlive the process.
+///
+/// Every address type has an overload next to its definition, found by argument-dependent lookup:
+/// `FixedHash(address, seed)`. None of them is a keyed hash: anyone who knows the seed can find
+/// addresses that collide.
+namespace violet::net::ip::detail {
+
+/// Mixes the bits of `value` so that every input bit affects every output bit; this is the finalizer
+/// of SplitMix64, which is a bijection.
+constexpr auto Mix64(UInt64 value) noexcept -> UInt64
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+    return value ^ (value >> 31);
+}
+
+// spreads a seed over all 64 bits, so that small seeds make unrelated hashes
+constexpr UInt64 kSeedMultiplier = 0x9E3779B97F4A7C15;
+
+} // namespace violet::net::ip::detail
@@ -0,0 +1,74 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/IntervalSet.h>
+#include <violet/Networking/IP/NetworkV4.h>
+
+namespace violet::net::ip {
+
+namespace detail {
+
+/// Orders IPv4 addresses by their value in host byte order; see [`IntervalSet`].
+struct IntervalTraitsV4 final {
+    using Address = AddrV4;
+    using Network = NetworkV4;
+    using Key = UInt32;
+
+    constexpr static auto KeyOf(AddrV4 address) noexcept -> UInt32
+    {
+        return address.AsUInt32();
+    }
+
+    constexpr static auto AddressOf(UInt32 key) noexcept -> AddrV4
+    {
+        return AddrV4::FromUInt32(key);
+    }
+};
+
+} // namespace detail
+
+/// An immutable set of IPv4 addresses, like a blocklist, built from any mix of addresses, ranges and
+/// networks.
+///
+/// The set keeps the disjoint ranges that cover its addresses in 8 bytes each, however many were added
+/// to get them. `Contains` is a branch-free binary search over them; unions, intersections and
+/// differences of whole sets take time linear in their sizes. See [`detail::IntervalSet`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/IPSetV4.h>
+///
+/// using namespace violet::net::ip;
+///
+/// IPSetV4 blocked = IPSetV4::Builder()
+///     .Add(NetworkV4::Parse("10.0.0.0/8").Unwrap())
+///     .Add(AddrV4(192, 168, 0, 1), AddrV4(192, 168, 0, 99))
+///     .Add(AddrV4(203, 0, 113, 7))
+///     .Build();
+///
+/// blocked.Contains(AddrV4(10, 1, 2, 3)); // => true
+/// blocked.Contains(AddrV4(192, 168, 0, 100)); // => false
+/// ```
+using IPSetV4 = detail::IntervalSet<detail::IntervalTraitsV4>;
+
+} // namespace violet::net::ip
@@ -0,0 +1,75 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/IntervalSet.h>
+#include <violet/Networking/IP/NetworkV6.h>
+
+#include <absl/numeric/int128.h>
+
+namespace violet::net::ip {
+
+namespace detail {
+
+/// Orders IPv6 addresses by their 128-bit value; see [`IntervalSet`].
+struct IntervalTraitsV6 final {
+    using Address = AddrV6;
+    using Network = NetworkV6;
+    using Key = absl::uint128;
+
+    constexpr static auto KeyOf(const AddrV6& address) noexcept -> absl::uint128
+    {
+        return address.AsUInt128();
+    }
+
+    constexpr static auto AddressOf(absl::uint128 key) noexcept -> AddrV6
+    {
+        return key;
+    }
+};
+
+} // namespace detail
+
+/// An immutable set of IPv6 addresses, like a blocklist, built from any mix of addresses, ranges and
+/// networks.
+///
+/// The set keeps the disjoint ranges that cover its addresses in 32 bytes each, however many were added
+/// to get them. `Contains` is a branch-free binary search over them; unions, intersections and
+/// differences of whole sets take time linear in their sizes. See [`detail::IntervalSet`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/IPSetV6.h>
+///
+/// using namespace violet::net::ip;
+///
+/// IPSetV6 blocked = IPSetV6::Builder()
+///     .Add(NetworkV6::Parse("2001:db8::/32").Unwrap())
+///     .Add(AddrV6::Localhost())
+///     .Build();
+///
+/// blocked.Contains(AddrV6::Parse("2001:db8::1").Unwrap()); // => true
+/// blocked.Contains(AddrV6::Parse("2001:db9::1").Unwrap()); // => false
+/// ```
+using IPSetV6 = detail::IntervalSet<detail::IntervalTraitsV6>;
+
+} // namespace violet::net::ip
@@ -0,0 +1,498 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Violet.h>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <limits>
+
+namespace violet::net::ip::detail {
+
+/// Returns the first index of an in-order walk over an Eytzinger tree of `size` nodes (indexed from
+/// `1`), or `0` if it's empty.
+constexpr auto EytzingerFirst(UInt size) noexcept -> UInt
+{
+    return size == 0 ? 0 : std::bit_floor(size);
+}
+
+/// Returns the index after `index` in an in-order walk over an Eytzinger tree of `size` nodes, or `0`
+/// after the last one.
+constexpr auto EytzingerNext(UInt index, UInt size) noexcept -> UInt
+{
+    if ((2 * index) + 1 <= size) {
+        index = (2 * index) + 1;
+        while (2 * index <= size) {
+            index *= 2;
+        }
+
+        return index;
+    }
+
+    // climb while `index` is a right child; its parent is next once it's a left one
+    while ((index & 1) != 0) {
+        index >>= 1;
+    }
+
+    return index >> 1;
+}
+
+/// An immutable set of addresses, stored as the sorted, disjoint and non-adjacent ranges that cover
+/// them; this is the implementation of [`IPSetV4`] and [`IPSetV6`].
+///
+/// `Traits` maps the family's addresses to an unsigned `Key` that sorts like them: `UInt32` for IPv4
+/// and `absl::uint128` for IPv6, so a range costs 8 or 32 bytes.
+///
+/// The ranges are laid out in Eytzinger order, i.e. as an implicit binary search tree stored
+/// breadth-first with the children of `k` at `2k` and `2k + 1`. A search takes `log2(n)` steps whose
+/// only branch is the loop itself, and since the descendants of a node a few levels down are next to
+/// each other, they can be prefetched long before they are compared against.
+///
+/// Lookups only need the array of ranges, so they're implemented by [`View`], which can also look into
+/// ranges that were mapped from a [`TableImage`].
+template<typename Traits>
+struct IntervalSet final {
+    using Address = typename Traits::Address;
+    using Network = typename Traits::Network;
+    using Key = typename Traits::Key;
+
+    /// An inclusive range of addresses.
+    struct Range final {
+        Address First;
+        Address Last;
+
+        constexpr friend auto operator==(const Range& lhs, const Range& rhs) noexcept -> bool = default;
+    };
+
+    /// A range as it's stored, both in memory and in a [`TableImage`].
+    struct Interval final {
+        Key First;
+        Key Last;
+
+        constexpr friend auto operator==(const Interval& lhs, const Interval& rhs) noexcept -> bool = default;
+    };
+
+    /// The interval at index `0` of every layout; it contains nothing (`[max, 0]`), and is what a search
+    /// returns when every range ends before the key.
+    constexpr static Interval kSentinel{ std::numeric_limits<Key>::max(), Key(0) };
+
+    struct View;
+    struct Builder;
+    struct Iterator;
+
+    /// Constructs an empty set.
+    IntervalSet() = default;
+
+    /// Returns a view of the ranges of this set, which is valid until the set is destroyed.
+    [[nodiscard]] auto AsView() const noexcept -> View
+    {
+        return View(this->ranges());
+    }
+
+    /// Returns **true** if `address` is in the set.
+    [[nodiscard]] auto Contains(const Address& address) const noexcept -> bool
+    {
+        return this->AsView().Contains(address);
+    }
+
+    /// Returns **true** if every address of `network` is in the set; since the ranges are
+    /// non-adjacent, they all have to be in a single one.
+    [[nodiscard]] auto Contains(const Network& network) const noexcept -> bool
+    {
+        return this->AsView().Contains(network);
+    }
+
+    /// Returns the set of the addresses that are in this set or in `other`.
+    [[nodiscard]] auto Union(const IntervalSet& other) const -> IntervalSet
+    {
+        const auto lhs = this->intervals();
+        const auto rhs = other.intervals();
+
+        Vec<Interval> merged;
+        merged.reserve(lhs.size() + rhs.size());
+        std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(merged),
+            [](const Interval& a, const Interval& b) -> bool { return a.First < b.First; });
+
+        return fromSorted(coalesce(merged));
+    }
+
+    /// Returns the set of the addresses that are in both this set and `other`.
+    [[nodiscard]] auto Intersection(const IntervalSet& other) const -> IntervalSet
+    {
+        const auto lhs = this->intervals();
+        const auto rhs = other.intervals();
+
+        Vec<Interval> result;
+        for (UInt i = 0, j = 0; i < lhs.size() && j < rhs.size();) {
+            const Key first = std::max(lhs[i].First, rhs[j].First);
+            const Key last = std::min(lhs[i].Last, rhs[j].Last);
+            if (first <= last) {
+                result.push_back({ first, last });
+            }
+
+            // whichever ends first can't overlap anything further in the other set
+            if (lhs[i].Last < rhs[j].Last) {
+                i++;
+            } else {
+                j++;
+            }
+        }
+
+        return fromSorted(result);
+    }
+
+    /// Returns the set of the addresses that are in this set but not in `other`.
+    [[nodiscard]] auto Difference(const IntervalSet& other) const -> IntervalSet
+    {
+        const auto lhs = this->intervals();
+        const auto rhs = other.intervals();
+
+        Vec<Interval> result;
+        UInt j = 0;
+        for (const auto& [first, last]: lhs) {
+            while (j < rhs.size() && rhs[j].Last < first) {
+                j++;
+            }
+
+            // cut the holes of every range of `other` that starts within this one; the last of them can
+            // reach into the next range, so it's only skipped once it ends here
+            Key start = first;
+            bool covered = false;
+            for (; j < rhs.size() && rhs[j].First <= last; j++) {
+                if (rhs[j].First > start) {
+                    result.push_back({ start, rhs[j].First - 1 });
+                }
+
+                if (rhs[j].Last >= last) {
+                    covered = true;
+                    break;
+                }
+
+                start = rhs[j].Last + 1;
+            }
+
+            if (!covered) {
+                result.push_back({ start, last });
+            }
+        }
+
+        return fromSorted(result);
+    }
+
+    /// Returns the number of ranges, which can be less than the number of ranges that were added
+    /// since the overlapping and adjacent ones are merged.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->ranges().size() - 1;
+    }
+
+    /// Returns **true** if the set has no addresses.
+    [[nodiscard]] auto Empty() const noexcept -> bool
+    {
+        return this->Size() == 0;
+    }
+
+    /// Returns the number of bytes used by the ranges.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        return this->n_ranges.capacity() * sizeof(Interval);
+    }
+
+    /// Iterates over the ranges in ascending order.
+    [[nodiscard]] auto begin() const noexcept -> Iterator
+    {
+        return this->AsView().begin();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> Iterator
+    {
+        return this->AsView().end();
+    }
+
+    friend auto operator==(const IntervalSet& lhs, const IntervalSet& rhs) noexcept -> bool
+    {
+        // the layout only depends on the ranges
+        return std::ranges::equal(lhs.ranges(), rhs.ranges());
+    }
+
+private:
+    // the layout of the ranges; a set that was moved from has none at all, not even the sentinel, and
+    // is viewed as the empty set
+    [[nodiscard]] auto ranges() const noexcept -> Span<const Interval>
+    {
+        if (this->n_ranges.empty()) {
+            return { &kSentinel, 1 };
+        }
+
+        return this->n_ranges;
+    }
+
+    // the ranges in ascending order
+    [[nodiscard]] auto intervals() const -> Vec<Interval>
+    {
+        const auto ranges = this->ranges();
+
+        Vec<Interval> result;
+        result.reserve(this->Size());
+        for (UInt index = EytzingerFirst(this->Size()); index != 0; index = EytzingerNext(index, this->Size())) {
+            result.push_back(ranges[index]);
+        }
+
+        return result;
+    }
+
+    // merges the overlapping and adjacent intervals of `intervals`, which are sorted by `First`
+    static auto coalesce(const Vec<Interval>& intervals) -> Vec<Interval>
+    {
+        Vec<Interval> result;
+        for (const Interval& interval: intervals) {
+            // `First - 1` can't wrap: it's only evaluated if `First` is larger than a `Last`
+            if (!result.empty()
+                && (interval.First <= result.back().Last || interval.First - 1 == result.back().Last)) {
+                result.back().Last = std::max(result.back().Last, interval.Last);
+            } else {
+                result.push_back(interval);
+            }
+        }
+
+        return result;
+    }
+
+    // lays out `intervals`, which are sorted, disjoint and non-adjacent, in Eytzinger order
+    static auto fromSorted(const Vec<Interval>& intervals) -> IntervalSet
+    {
+        IntervalSet set;
+        set.n_ranges.resize(intervals.size() + 1);
+
+        UInt index = EytzingerFirst(intervals.size());
+        for (const Interval& interval: intervals) {
+            set.n_ranges[index] = interval;
+            index = EytzingerNext(index, intervals.size());
+        }
+
+        return set;
+    }
+
+    Vec<Interval> n_ranges{ kSentinel };
+};
+
+/// A read-only view of the ranges of an [`IntervalSet`], which does all of its lookups; it doesn't own
+/// the ranges, so it can also look into a set that was mapped from a [`TableImage`].
+template<typename Traits>
+struct IntervalSet<Traits>::View final {
+    /// Constructs a view of the empty set.
+    constexpr View() noexcept = default;
+
+    /// Views `ranges`, which must be laid out like the ranges of an [`IntervalSet`]: [`kSentinel`] at
+    /// index `0`, followed by the sorted, disjoint and non-adjacent ranges in Eytzinger order. Nothing
+    /// is checked, but lookups never read outside of `ranges` either way.
+    constexpr explicit View(Span<const Interval> ranges) noexcept
+        : n_ranges(ranges)
+    {
+        VIOLET_DEBUG_ASSERT(!ranges.empty() && ranges[0] == kSentinel, "ranges don't start with the sentinel");
+    }
+
+    /// Returns **true** if `address` is in the set.
+    [[nodiscard]] auto Contains(const Address& address) const noexcept -> bool
+    {
+        const Key key = Traits::KeyOf(address);
+        const Interval& range = this->n_ranges[this->find(key)];
+
+        // `&` rather than `&&`: both are cheap once the range is loaded, and a miss is unpredictable
+        return (range.First <= key) & (key <= range.Last);
+    }
+
+    /// Returns **true** if every address of `network` is in the set.
+    [[nodiscard]] auto Contains(const Network& network) const noexcept -> bool
+    {
+        const Key first = Traits::KeyOf(network.Address());
+        const Interval& range = this->n_ranges[this->find(first)];
+
+        return (range.First <= first) & (Traits::KeyOf(network.Last()) <= range.Last);
+    }
+
+    /// Returns the number of ranges.
+    [[nodiscard]] constexpr auto Size() const noexcept -> UInt
+    {
+        return this->n_ranges.size() - 1;
+    }
+
+    /// Returns **true** if the set has no addresses.
+    [[nodiscard]] constexpr auto Empty() const noexcept -> bool
+    {
+        return this->Size() == 0;
+    }
+
+    /// Returns the ranges in their stored layout, sentinel included.
+    [[nodiscard]] constexpr auto Data() const noexcept -> Span<const Interval>
+    {
+        return this->n_ranges;
+    }
+
+    /// Iterates over the ranges in ascending order.
+    [[nodiscard]] auto begin() const noexcept -> Iterator
+    {
+        return { this->n_ranges, EytzingerFirst(this->Size()) };
+    }
+
+    [[nodiscard]] auto end() const noexcept -> Iterator
+    {
+        return { this->n_ranges, 0 };
+    }
+
+private:
+    // A search prefetches the 16 descendants of a node four levels down, which are next to each other;
+    // that's one or two cache lines for IPv4 but eight for IPv6, which still beats waiting on each.
+    constexpr static UInt kPrefetchWidth = 16;
+    constexpr static UInt kRangesPerLine = 64 / sizeof(Interval);
+
+    // the index of the first range that ends at or after `key`, or `0`
+    [[nodiscard]] auto find(Key key) const noexcept -> UInt
+    {
+        const Interval* ranges = this->n_ranges.data();
+        const UInt size = this->Size();
+
+        UInt index = 1;
+        while (index <= size) {
+            // prefetching is only a hint, so it can point past the end
+            const Interval* descendants = ranges + std::min(index * kPrefetchWidth, size);
+            for (UInt line = 0; line < kPrefetchWidth / kRangesPerLine; line++) {
+                __builtin_prefetch(descendants + (line * kRangesPerLine));
+            }
+
+            index = (2 * index) + static_cast<UInt>(ranges[index].Last < key);
+        }
+
+        // the path went right after every node that ended too early, and left at the answer; undo the
+        // right turns after it and then that left turn
+        return index >> (std::countr_one(index) + 1);
+    }
+
+    Span<const Interval> n_ranges{ &kSentinel, 1 };
+};
+
+/// Collects addresses, ranges and networks in any order, and builds the [`IntervalSet`] of all of them.
+template<typename Traits>
+struct IntervalSet<Traits>::Builder final {
+    /// Constructs an empty builder.
+    Builder() = default;
+
+    /// Adds a single address.
+    auto Add(const Address& address) -> Builder&
+    {
+        const Key key = Traits::KeyOf(address);
+        this->n_intervals.push_back({ key, key });
+
+        return *this;
+    }
+
+    /// Adds the addresses from `first` to `last`, inclusive; `first` can't be larger than `last`.
+    auto Add(const Address& first, const Address& last) -> Builder&
+    {
+        VIOLET_DEBUG_ASSERT(first <= last, "range ends before it starts");
+
+        this->n_intervals.push_back({ Traits::KeyOf(first), Traits::KeyOf(last) });
+        return *this;
+    }
+
+    /// Adds every address of `network`.
+    auto Add(const Network& network) -> Builder&
+    {
+        return this->Add(network.Address(), network.Last());
+    }
+
+    /// Adds every address of `set`.
+    auto Add(const IntervalSet& set) -> Builder&
+    {
+        const auto intervals = set.intervals();
+        this->n_intervals.insert(this->n_intervals.end(), intervals.begin(), intervals.end());
+
+        return *this;
+    }
+
+    /// Builds the set of everything that was added so far, in `O(n log n)` for `n` additions. The
+    /// builder can be reused afterwards.
+    [[nodiscard]] auto Build() -> IntervalSet
+    {
+        std::ranges::sort(this->n_intervals, [](const Interval& a, const Interval& b) -> bool {
+            return a.First < b.First;
+        });
+
+        return IntervalSet::fromSorted(IntervalSet::coalesce(this->n_intervals));
+    }
+
+private:
+    Vec<Interval> n_intervals;
+};
+
+/// Iterates over the [`Range`]s of an [`IntervalSet`] in ascending order, by walking its tree in order.
+template<typename Traits>
+struct IntervalSet<Traits>::Iterator final {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Range;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Range;
+
+    Iterator() = default;
+
+    auto operator*() const noexcept -> Range
+    {
+        return { Traits::AddressOf(this->n_ranges[this->n_index].First),
+            Traits::AddressOf(this->n_ranges[this->n_index].Last) };
+    }
+
+    auto operator++() noexcept -> Iterator&
+    {
+        this->n_index = EytzingerNext(this->n_index, this->n_ranges.size() - 1);
+        return *this;
+    }
+
+    auto operator++(int) noexcept -> Iterator
+    {
+        Iterator previous = *this;
+        ++*this;
+
+        return previous;
+    }
+
+    friend auto operator==(const Iterator& lhs, const Iterator& rhs) noexcept -> bool
+    {
+        return lhs.n_index == rhs.n_index;
+    }
+
+private:
+    friend View;
+
+    Iterator(Span<const Interval> ranges, UInt index) noexcept
+        : n_ranges(ranges)
+        , n_index(index)
+    {
+    }
+
+    Span<const Interval> n_ranges;
+    UInt n_index = 0;
+};
+
+} // namespace violet::net::ip::detail
@@ -0,0 +1,296 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Container/Result.h>
+#include <violet/Networking/IP/AddrV4.h>
+#include <violet/Networking/IP/Subnets.h>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+
+namespace violet::net::ip {
+
+struct InvalidV4NetworkError;
+
+namespace detail {
+
+/// `kNetmasksV4[prefix]` is the netmask of a `/prefix` IPv4 network in host byte order; a table avoids
+/// the out-of-range `~0 << 32` for `/0`.
+constexpr auto kNetmasksV4 = []() constexpr -> Array<UInt32, 33> {
+    Array<UInt32, 33> masks{ };
+    for (UInt prefix = 1; prefix <= 32; ++prefix) {
+        masks[prefix] = ~UInt32(0) << (32 - prefix);
+    }
+
+    return masks;
+}();
+
+} // namespace detail
+
+/// An IPv4 network in CIDR notation (like `10.0.0.0/8`): an address prefix and its length.
+///
+/// The host bits of the address are always zero, e.g. `NetworkV4(AddrV4(10, 1, 2, 3), 8)` is
+/// `10.0.0.0/8`. All of the set operations are branchless, so they can be used on hot paths like ACL
+/// checks.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/NetworkV4.h>
+///
+/// using violet::net::ip::AddrV4;
+/// using violet::net::ip::NetworkV4;
+///
+/// constexpr auto privateNet = NetworkV4::Parse("10.0.0.0/8").Unwrap();
+/// static_assert(privateNet.Contains(AddrV4(10, 1, 2, 3)));
+/// static_assert(!privateNet.Contains(AddrV4(11, 0, 0, 1)));
+/// ```
+struct VIOLET_API NetworkV4 final {
+    /// Maximum length of the string representation of an IPv4 network (`255.255.255.255/32`).
+    constexpr static UInt kMaxStringLength = AddrV4::kMaxStringLength + 3;
+
+    /// Outcome of parsing a network; every error kind corresponds to an [`InvalidV4NetworkError`].
+    enum struct ParseStatus : UInt8 {
+        kOk = 0,
+        kInvalidAddress = 1, ///< the part before the `/` isn't an IPv4 address
+        kInvalidPrefix = 2, ///< the prefix length is empty or isn't a number
+        kPrefixOutOfRange = 3 ///< the prefix length is larger than `32`
+    };
+
+    /// Constructs the network that contains every IPv4 address (`0.0.0.0/0`).
+    constexpr VIOLET_IMPLICIT NetworkV4() noexcept = default;
+
+    /// Constructs the `/prefix` network that `address` is in; its host bits are cleared.
+    /// @param address any address within the network
+    /// @param prefix the prefix length, at most `32`
+    constexpr VIOLET_IMPLICIT NetworkV4(AddrV4 address, UInt8 prefix) noexcept
+        : n_addr(address.AsUInt32() & detail::kNetmasksV4[std::min<UInt8>(prefix, 32)])
+        , n_prefix(std::min<UInt8>(prefix, 32))
+    {
+        VIOLET_DEBUG_ASSERT(prefix <= 32, "IPv4 prefix length is larger than 32");
+    }
+
+    /// Parses a network from its CIDR notation like `"10.0.0.0/8"`. An address without a prefix length
+    /// is a `/32` network, and host bits are cleared like in the constructor (`"10.1.2.3/8"` is
+    /// `10.0.0.0/8`).
+    /// @param input the input to parse
+    static auto FromStr(Str input) noexcept -> Result<NetworkV4, InvalidV4NetworkError>;
+
+    /// Parses a network like `FromStr`, but returns **Nothing** instead of an error so that it can be
+    /// used in constant expressions; see `AddrV4::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<NetworkV4>;
+
+    /// Returns the network address, i.e. the first address in the network.
+    [[nodiscard]] constexpr auto Address() const noexcept -> AddrV4
+    {
+        return AddrV4::FromUInt32(this->n_addr);
+    }
+
+    /// Returns the last address in the network, which is the broadcast address for networks shorter
+    /// than `/31`.
+    [[nodiscard]] constexpr auto Last() const noexcept -> AddrV4
+    {
+        return AddrV4::FromUInt32(this->n_addr | ~detail::kNetmasksV4[this->n_prefix]);
+    }
+
+    [[nodiscard]] constexpr auto PrefixLength() const noexcept -> UInt8
+    {
+        return this->n_prefix;
+    }
+
+    /// Returns the netmask, like `255.0.0.0` for a `/8` network.
+    [[nodiscard]] constexpr auto Netmask() const noexcept -> AddrV4
+    {
+        return AddrV4::FromUInt32(detail::kNetmasksV4[this->n_prefix]);
+    }
+
+    /// Returns the hostmask, like `0.255.255.255` for a `/8` network.
+    [[nodiscard]] constexpr auto Hostmask() const noexcept -> AddrV4
+    {
+        return AddrV4::FromUInt32(~detail::kNetmasksV4[this->n_prefix]);
+    }
+
+    /// Returns **true** if `address` is in this network.
+    [[nodiscard]] constexpr auto Contains(AddrV4 address) const noexcept -> bool
+    {
+        return ((address.AsUInt32() ^ this->n_addr) & detail::kNetmasksV4[this->n_prefix]) == 0;
+    }
+
+    /// Returns **true** if every address of `other` is in this network, i.e. `other` is this network or
+    /// one of its subnets.
+    [[nodiscard]] constexpr auto Contains(const NetworkV4& other) const noexcept -> bool
+    {
+        // `&` rather than `&&` so that both sides are always evaluated, without a branch
+        return (other.n_prefix >= this->n_prefix)
+            & (((other.n_addr ^ this->n_addr) & detail::kNetmasksV4[this->n_prefix]) == 0);
+    }
+
+    /// Returns **true** if this network and `other` have any address in common, which is only the case if
+    /// one contains the other.
+    [[nodiscard]] constexpr auto Overlaps(const NetworkV4& other) const noexcept -> bool
+    {
+        const auto mask = detail::kNetmasksV4[std::min(this->n_prefix, other.n_prefix)];
+        return ((this->n_addr ^ other.n_addr) & mask) == 0;
+    }
+
+    /// Returns the network with a prefix that is one bit shorter, e.g. `10.0.0.0/7` for `10.1.0.0/8`. The
+    /// supernet of `0.0.0.0/0` is itself.
+    [[nodiscard]] constexpr auto Supernet() const noexcept -> NetworkV4
+    {
+        return this->Supernet(static_cast<UInt8>(this->n_prefix - static_cast<UInt8>(this->n_prefix != 0)));
+    }
+
+    /// Returns the `/prefix` network that contains this one; `prefix` must not be longer than
+    /// `PrefixLength()`.
+    [[nodiscard]] constexpr auto Supernet(UInt8 prefix) const noexcept -> NetworkV4
+    {
+        VIOLET_DEBUG_ASSERT(prefix <= this->n_prefix, "supernet has a longer prefix");
+        return { this->Address(), prefix };
+    }
+
+    /// Returns the subnets of this network with the (longer or equal) prefix length `prefix`; for example,
+    /// the `/10` subnets of `10.0.0.0/8` are `10.0.0.0/10`, `10.64.0.0/10`, `10.128.0.0/10` and
+    /// `10.192.0.0/10`.
+    [[nodiscard]] constexpr auto Subnets(UInt8 prefix) const noexcept -> SubnetRange<NetworkV4>
+    {
+        VIOLET_DEBUG_ASSERT(prefix >= this->n_prefix && prefix <= 32, "invalid subnet prefix length");
+        return { *this, prefix };
+    }
+
+    /// Returns the `index`th of the `/prefix` subnets of this network without creating the whole range;
+    /// see `Subnets`.
+    [[nodiscard]] constexpr auto Subnet(UInt8 prefix, UInt64 index) const noexcept -> NetworkV4
+    {
+        NetworkV4 subnet;
+        subnet.n_addr = this->n_addr | static_cast<UInt32>(index << (32 - prefix)); // 64-bit, so `/0` can shift by 32
+        subnet.n_prefix = prefix;
+
+        return subnet;
+    }
+
+    /// Writes the CIDR notation of this network (like `10.0.0.0/8`) into `[first, last)` without
+    /// allocating; see `AddrV4::ToChars`.
+    auto ToChars(char* first, char* last) const noexcept -> std::to_chars_result;
+
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const NetworkV4& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    constexpr friend auto operator==(const NetworkV4& lhs, const NetworkV4& rhs) noexcept -> bool = default;
+
+    /// Networks are ordered by their address first, so a network sorts right before its subnets.
+    constexpr friend auto operator<=>(const NetworkV4& lhs, const NetworkV4& rhs) noexcept -> std::strong_ordering
+    {
+        if (auto cmp = lhs.n_addr <=> rhs.n_addr; cmp != 0) {
+            return cmp;
+        }
+
+        return lhs.n_prefix <=> rhs.n_prefix;
+    }
+
+private:
+    UInt32 n_addr = 0; // host byte order
+    UInt8 n_prefix = 0;
+};
+
+static_assert(sizeof(NetworkV4) == 8);
+static_assert(std::is_trivially_copyable_v<NetworkV4>);
+
+/// Represents an error returned when parsing an invalid IPv4 network. Like
+/// [`InvalidV4AddressError`], it only records what went wrong and where; the message is built by
+/// `ToString`.
+struct VIOLET_API InvalidV4NetworkError final {
+    /// Creates an error of the given kind; `kind` can't be [`NetworkV4::ParseStatus::kOk`]. The
+    /// address error is only used for [`NetworkV4::ParseStatus::kInvalidAddress`].
+    constexpr InvalidV4NetworkError(
+        NetworkV4::ParseStatus kind, AddrV4::ParseStatus addressKind, UInt offset) noexcept
+        : n_bits(static_cast<UInt32>(kind) | (static_cast<UInt32>(addressKind) << 8)
+              | (static_cast<UInt32>(std::min<UInt>(offset, std::numeric_limits<UInt16>::max())) << 16))
+    {
+    }
+
+    /// Returns why the input was rejected.
+    [[nodiscard]] constexpr auto Kind() const noexcept -> NetworkV4::ParseStatus
+    {
+        return static_cast<NetworkV4::ParseStatus>(this->n_bits & 0xFF);
+    }
+
+    /// Returns the byte offset into the input where parsing failed.
+    [[nodiscard]] constexpr auto Offset() const noexcept -> UInt
+    {
+        return this->n_bits >> 16;
+    }
+
+    /// Returns the error for the address part, if that is what was rejected.
+    [[nodiscard]] constexpr auto Address() const noexcept -> Optional<InvalidV4AddressError>
+    {
+        if (this->Kind() != NetworkV4::ParseStatus::kInvalidAddress) {
+            return Nothing;
+        }
+
+        return Some<InvalidV4AddressError>(
+            static_cast<AddrV4::ParseStatus>((this->n_bits >> 8) & 0xFF), this->Offset());
+    }
+
+    /// Returns a string description of the error.
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const InvalidV4NetworkError& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    constexpr auto operator==(const InvalidV4NetworkError&) const noexcept -> bool = default;
+
+private:
+    // same layout as `socket::ParseV4Error::n_bits`
+    UInt32 n_bits;
+};
+
+constexpr auto NetworkV4::Parse(Str input) noexcept -> Optional<NetworkV4>
+{
+    const auto slash = input.find('/');
+
+    auto address = AddrV4::Parse(input.substr(0, slash));
+    if (!address) {
+        return Nothing;
+    }
+
+    if (slash == Str::npos) {
+        return NetworkV4(address.Unwrap(), 32);
+    }
+
+    UInt64 prefix = 0;
+    if (detail::ParseDecimal(input.substr(slash + 1), 32, prefix) != std::errc{ }) {
+        return Nothing;
+    }
+
+    return NetworkV4(address.Unwrap(), static_cast<UInt8>(prefix));
+}
+
+} // namespace violet::net::ip
+
+VIOLET_FORMATTER(violet::net::ip::InvalidV4NetworkError);
+VIOLET_FORMATTER(violet::net::ip::NetworkV4);
@@ -0,0 +1,307 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Container/Result.h>
+#include <violet/Networking/IP/AddrV6.h>
+#include <violet/Networking/IP/Subnets.h>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+
+namespace violet::net::ip {
+
+struct InvalidV6NetworkError;
+
+namespace detail {
+
+/// `kNetmasksV6[prefix]` is the netmask of a `/prefix` IPv6 network.
+constexpr auto kNetmasksV6 = []() constexpr -> Array<AddrV6, 129> {
+    Array<AddrV6, 129> masks{ };
+    for (UInt prefix = 1; prefix <= 128; ++prefix) {
+        const UInt64 high = prefix >= 64 ? ~UInt64(0) : ~UInt64(0) << (64 - prefix);
+        const UInt64 low = prefix <= 64 ? 0 : ~UInt64(0) << (128 - prefix);
+        masks[prefix] = AddrV6::FromWords(high, low);
+    }
+
+    return masks;
+}();
+
+/// Returns **true** if every bit of `addr` is zero, without the branch of `addr == AddrV6()`.
+constexpr auto IsZeroV6(const AddrV6& addr) noexcept -> bool
+{
+    return (addr.High64() | addr.Low64()) == 0;
+}
+
+} // namespace detail
+
+/// An IPv6 network in CIDR notation (like `2001:db8::/32`): an address prefix and its length.
+///
+/// This is the IPv6 counterpart of [`NetworkV4`]; see there for the semantics of each operation.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/NetworkV6.h>
+///
+/// using violet::net::ip::AddrV6;
+/// using violet::net::ip::NetworkV6;
+///
+/// constexpr auto documentation = NetworkV6::Parse("2001:db8::/32").Unwrap();
+/// static_assert(documentation.Contains(AddrV6::Parse("2001:db8::1").Unwrap()));
+/// ```
+struct VIOLET_API NetworkV6 final {
+    /// Maximum length of the string representation of an IPv6 network.
+    constexpr static UInt kMaxStringLength = AddrV6::kMaxStringLength + 4;
+
+    /// Outcome of parsing a network; every error kind corresponds to an [`InvalidV6NetworkError`].
+    enum struct ParseStatus : UInt8 {
+        kOk = 0,
+        kInvalidAddress = 1, ///< the part before the `/` isn't an IPv6 address
+        kInvalidPrefix = 2, ///< the prefix length is empty or isn't a number
+        kPrefixOutOfRange = 3 ///< the prefix length is larger than `128`
+    };
+
+    /// Constructs the network that contains every IPv6 address (`::/0`).
+    constexpr VIOLET_IMPLICIT NetworkV6() noexcept = default;
+
+    /// Constructs the `/prefix` network that `address` is in; its host bits are cleared.
+    /// @param address any address within the network
+    /// @param prefix the prefix length, at most `128`
+    constexpr VIOLET_IMPLICIT NetworkV6(const AddrV6& address, UInt8 prefix) noexcept
+        : n_addr(address & detail::kNetmasksV6[std::min<UInt8>(prefix, 128)])
+        , n_prefix(std::min<UInt8>(prefix, 128))
+    {
+        VIOLET_DEBUG_ASSERT(prefix <= 128, "IPv6 prefix length is larger than 128");
+    }
+
+    /// Parses a network from its CIDR notation like `"2001:db8::/32"`. An address without a prefix
+    /// length is a `/128` network, and host bits are cleared like in the constructor.
+    /// @param input the input to parse
+    static auto FromStr(Str input) noexcept -> Result<NetworkV6, InvalidV6NetworkError>;
+
+    /// Parses a network like `FromStr`, but returns **Nothing** instead of an error so that it can be
+    /// used in constant expressions; see `AddrV6::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<NetworkV6>;
+
+    /// Returns the network address, i.e. the first address in the network.
+    [[nodiscard]] constexpr auto Address() const noexcept -> AddrV6
+    {
+        return this->n_addr;
+    }
+
+    /// Returns the last address in the network.
+    [[nodiscard]] constexpr auto Last() const noexcept -> AddrV6
+    {
+        return this->n_addr | ~detail::kNetmasksV6[this->n_prefix];
+    }
+
+    [[nodiscard]] constexpr auto PrefixLength() const noexcept -> UInt8
+    {
+        return this->n_prefix;
+    }
+
+    /// Returns the netmask, like `ffff:ffff::` for a `/32` network.
+    [[nodiscard]] constexpr auto Netmask() const noexcept -> AddrV6
+    {
+        return detail::kNetmasksV6[this->n_prefix];
+    }
+
+    /// Returns the hostmask, like `::ffff:ffff:ffff:ffff:ffff:ffff` for a `/32` network.
+    [[nodiscard]] constexpr auto Hostmask() const noexcept -> AddrV6
+    {
+        return ~detail::kNetmasksV6[this->n_prefix];
+    }
+
+    /// Returns **true** if `address` is in this network.
+    [[nodiscard]] constexpr auto Contains(const AddrV6& address) const noexcept -> bool
+    {
+        return detail::IsZeroV6((address ^ this->n_addr) & detail::kNetmasksV6[this->n_prefix]);
+    }
+
+    /// Returns **true** if every address of `other` is in this network.
+    [[nodiscard]] constexpr auto Contains(const NetworkV6& other) const noexcept -> bool
+    {
+        return (other.n_prefix >= this->n_prefix) & this->Contains(other.n_addr);
+    }
+
+    /// Returns **true** if this network and `other` have any address in common.
+    [[nodiscard]] constexpr auto Overlaps(const NetworkV6& other) const noexcept -> bool
+    {
+        const auto& mask = detail::kNetmasksV6[std::min(this->n_prefix, other.n_prefix)];
+        return detail::IsZeroV6((this->n_addr ^ other.n_addr) & mask);
+    }
+
+    /// Returns the network with a prefix that is one bit shorter. The supernet of `::/0` is itself.
+    [[nodiscard]] constexpr auto Supernet() const noexcept -> NetworkV6
+    {
+        return this->Supernet(static_cast<UInt8>(this->n_prefix - static_cast<UInt8>(this->n_prefix != 0)));
+    }
+
+    /// Returns the `/prefix` network that contains this one; `prefix` must not be longer than
+    /// `PrefixLength()`.
+    [[nodiscard]] constexpr auto Supernet(UInt8 prefix) const noexcept -> NetworkV6
+    {
+        VIOLET_DEBUG_ASSERT(prefix <= this->n_prefix, "supernet has a longer prefix");
+        return { this->n_addr, prefix };
+    }
+
+    /// Returns the subnets of this network with the (longer or equal) prefix length `prefix`. There are
+    /// `2^(prefix - PrefixLength())` of them, so the difference must be less than 64.
+    [[nodiscard]] constexpr auto Subnets(UInt8 prefix) const noexcept -> SubnetRange<NetworkV6>
+    {
+        VIOLET_DEBUG_ASSERT(prefix >= this->n_prefix && prefix <= 128 && prefix - this->n_prefix < 64,
+            "invalid subnet prefix length");
+
+        return { *this, prefix };
+    }
+
+    /// Returns the `index`th of the `/prefix` subnets of this network without creating the whole range;
+    /// see `Subnets`.
+    [[nodiscard]] constexpr auto Subnet(UInt8 prefix, UInt64 index) const noexcept -> NetworkV6
+    {
+        // `index` ends right before the host bits, which can straddle both words; the shifts by 64 that
+        // the edge cases would need are undefined, hence the explicit checks
+        const UInt shift = 128U - prefix;
+
+        UInt64 high = 0;
+        UInt64 low = 0;
+        if (shift >= 64) {
+            high = shift == 128 ? 0 : index << (shift - 64);
+        } else {
+            low = index << shift;
+            high = shift == 0 ? 0 : index >> (64 - shift);
+        }
+
+        NetworkV6 subnet;
+        subnet.n_addr = this->n_addr | AddrV6::FromWords(high, low);
+        subnet.n_prefix = prefix;
+
+        return subnet;
+    }
+
+    /// Writes the CIDR notation of this network (like `2001:db8::/32`) into `[first, last)` without
+    /// allocating; see `AddrV6::ToChars`.
+    auto ToChars(char* first, char* last) const noexcept -> std::to_chars_result;
+
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const NetworkV6& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    constexpr friend auto operator==(const NetworkV6& lhs, const NetworkV6& rhs) noexcept -> bool
+    {
+        return lhs.n_addr == rhs.n_addr && lhs.n_prefix == rhs.n_prefix;
+    }
+
+    /// Networks are ordered by their address first, so a network sorts right before its subnets.
+    constexpr friend auto operator<=>(const NetworkV6& lhs, const NetworkV6& rhs) noexcept -> std::strong_ordering
+    {
+        if (auto cmp = lhs.n_addr <=> rhs.n_addr; cmp != 0) {
+            return cmp;
+        }
+
+        return lhs.n_prefix <=> rhs.n_prefix;
+    }
+
+private:
+    AddrV6 n_addr;
+    UInt8 n_prefix = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<NetworkV6>);
+
+/// Represents an error returned when parsing an invalid IPv6 network; see [`InvalidV4NetworkError`].
+struct VIOLET_API InvalidV6NetworkError final {
+    /// Creates an error of the given kind; `kind` can't be [`NetworkV6::ParseStatus::kOk`]. The
+    /// address error is only used for [`NetworkV6::ParseStatus::kInvalidAddress`].
+    constexpr InvalidV6NetworkError(
+        NetworkV6::ParseStatus kind, AddrV6::ParseStatus addressKind, UInt offset) noexcept
+        : n_bits(static_cast<UInt32>(kind) | (static_cast<UInt32>(addressKind) << 8)
+              | (static_cast<UInt32>(std::min<UInt>(offset, std::numeric_limits<UInt16>::max())) << 16))
+    {
+    }
+
+    /// Returns why the input was rejected.
+    [[nodiscard]] constexpr auto Kind() const noexcept -> NetworkV6::ParseStatus
+    {
+        return static_cast<NetworkV6::ParseStatus>(this->n_bits & 0xFF);
+    }
+
+    /// Returns the byte offset into the input where parsing failed.
+    [[nodiscard]] constexpr auto Offset() const noexcept -> UInt
+    {
+        return this->n_bits >> 16;
+    }
+
+    /// Returns the error for the address part, if that is what was rejected.
+    [[nodiscard]] constexpr auto Address() const noexcept -> Optional<InvalidV6AddressError>
+    {
+        if (this->Kind() != NetworkV6::ParseStatus::kInvalidAddress) {
+            return Nothing;
+        }
+
+        return Some<InvalidV6AddressError>(
+            static_cast<AddrV6::ParseStatus>((this->n_bits >> 8) & 0xFF), this->Offset());
+    }
+
+    /// Returns a string description of the error.
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const InvalidV6NetworkError& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    constexpr auto operator==(const InvalidV6NetworkError&) const noexcept -> bool = default;
+
+private:
+    // same layout as `InvalidV4NetworkError::n_bits`
+    UInt32 n_bits;
+};
+
+constexpr auto NetworkV6::Parse(Str input) noexcept -> Optional<NetworkV6>
+{
+    const auto slash = input.find('/');
+
+    auto address = AddrV6::Parse(input.substr(0, slash));
+    if (!address) {
+        return Nothing;
+    }
+
+    if (slash == Str::npos) {
+        return NetworkV6(address.Unwrap(), 128);
+    }
+
+    UInt64 prefix = 0;
+    if (detail::ParseDecimal(input.substr(slash + 1), 128, prefix) != std::errc{ }) {
+        return Nothing;
+    }
+
+    return NetworkV6(address.Unwrap(), static_cast<UInt8>(prefix));
+}
+
+} // namespace violet::net::ip
+
+VIOLET_FORMATTER(violet::net::ip::InvalidV6NetworkError);
+VIOLET_FORMATTER(violet::net::ip::NetworkV6);
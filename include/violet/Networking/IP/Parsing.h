@@ -0,0 +1,104 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Violet.h>
+
+#include <system_error>
+
+// Building blocks of the `ip::AddrV4`, `ip::AddrV6` and `socket` parsers. They live in a header (rather
+// than next to the parsers) so that the parsers can run in constant expressions; see `AddrV4::Parse`.
+namespace violet::net::ip::detail {
+
+/// Value of every hexadecimal digit (either case), or `kNotHex` for any other byte.
+constexpr UInt8 kNotHex = 0xFF;
+constexpr auto kHexValues = []() constexpr -> Array<UInt8, 256> {
+    Array<UInt8, 256> table{ };
+    for (UInt ch = 0; ch < 256; ++ch) {
+        if (ch >= '0' && ch <= '9') {
+            table[ch] = static_cast<UInt8>(ch - '0');
+        } else if (ch >= 'a' && ch <= 'f') {
+            table[ch] = static_cast<UInt8>(ch - 'a' + 10);
+        } else if (ch >= 'A' && ch <= 'F') {
+            table[ch] = static_cast<UInt8>(ch - 'A' + 10);
+        } else {
+            table[ch] = kNotHex;
+        }
+    }
+
+    return table;
+}();
+
+/// Parses `input` as an unsigned decimal number that is at most `max`.
+///
+/// This follows `std::from_chars` (which isn't `constexpr` until C++23): an input that doesn't start
+/// with a digit is `std::errc::invalid_argument` and one that doesn't fit in `max` is
+/// `std::errc::result_out_of_range`. Unlike `std::from_chars`, trailing characters after the digits are
+/// rejected with `std::errc::invalid_argument` instead of being silently ignored.
+constexpr auto ParseDecimal(Str input, UInt64 max, UInt64& out) noexcept -> std::errc
+{
+    UInt pos = 0;
+    UInt64 value = 0;
+    bool overflow = false;
+
+    for (; pos < input.size() && static_cast<UInt8>(input[pos] - '0') <= 9; ++pos) {
+        const auto digit = static_cast<UInt64>(input[pos] - '0');
+        if (value > (max - digit) / 10) {
+            overflow = true;
+        } else {
+            value = (value * 10) + digit;
+        }
+    }
+
+    if (pos == 0) {
+        return std::errc::invalid_argument;
+    }
+
+    if (overflow) {
+        return std::errc::result_out_of_range;
+    }
+
+    if (pos != input.size()) {
+        return std::errc::invalid_argument;
+    }
+
+    out = value;
+    return std::errc{ };
+}
+
+/// Base of the `socket` parsers' errors, whose only purpose is its user-provided copy constructor: that
+/// makes the errors non-trivially copyable, so that the ABI returns `Result<socket::AddrV4, ParseV4Error>`
+/// and its IPv6 counterpart through memory rather than in registers. Filling the registers needs the
+/// address stored piecewise and reloaded whole, which stalls store-to-load forwarding on every successful
+/// parse. The IPv6 result is too large for registers anyway; it gets the same base so that both errors
+/// behave alike.
+struct returned_in_memory_t {
+    constexpr returned_in_memory_t() noexcept = default;
+    constexpr returned_in_memory_t(const returned_in_memory_t&) noexcept { }
+    constexpr auto operator=(const returned_in_memory_t&) noexcept -> returned_in_memory_t& = default;
+};
+
+/// Deliberately not `constexpr`: the address literals call this on invalid input, which turns the bad
+/// literal into a compile error pointing here.
+inline void InvalidAddressLiteral() noexcept { }
+
+} // namespace violet::net::ip::detail
@@ -0,0 +1,226 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Violet.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace violet::net::ip::detail {
+
+/// A longest-prefix-match map from networks to values of type `T`, on top of a `Table` that maps
+/// networks to integer value ids; this is the implementation of [`PrefixMapV4`] and [`PrefixMapV6`].
+///
+/// The values live in a vector indexed by their id, and the ids of removed networks are reused, so a
+/// `Lookup` is the table's lookup plus one array access.
+template<typename Table, typename T>
+struct PrefixMap final {
+    using Network = typename Table::Network;
+    using Address = typename Table::Address;
+
+    struct Delta;
+
+    /// Constructs an empty map.
+    PrefixMap() = default;
+
+    /// Maps `network` to `value`, replacing the value that it was mapped to before.
+    /// @returns **true** if `network` wasn't in the map yet
+    auto Insert(const Network& network, T value) -> bool
+    {
+        if (auto id = this->n_table.Find(network)) {
+            this->n_values[*id] = std::move(value);
+            return false;
+        }
+
+        UInt32 id = 0;
+        if (this->n_free.empty()) {
+            VIOLET_DEBUG_ASSERT(this->n_values.size() <= Table::kMaxId, "too many networks");
+
+            id = static_cast<UInt32>(this->n_values.size());
+            this->n_values.push_back(std::move(value));
+        } else {
+            id = this->n_free.back();
+            this->n_free.pop_back();
+            this->n_values[id] = std::move(value);
+        }
+
+        this->n_table.Insert(network, id);
+        return true;
+    }
+
+    /// Removes `network` from the map; the networks within it are left as they are.
+    /// @returns the value `network` was mapped to, if it was in the map
+    auto Remove(const Network& network) -> Optional<T>
+    {
+        auto id = this->n_table.Remove(network);
+        if (!id) {
+            return Nothing;
+        }
+
+        // copied rather than moved out, as `Values()` keeps it for the views taken before
+        this->n_free.push_back(*id);
+        return Some<T>(this->n_values[*id]);
+    }
+
+    /// Applies the changes of `delta` in the order they were recorded. Like the `Insert`s and `Remove`s
+    /// that it's made of, this costs as much as the networks that change, whatever the size of the map.
+    void Apply(const Delta& delta)
+    {
+        for (const auto& change: delta.n_changes) {
+            if (change.Value) {
+                this->Insert(change.Target, *change.Value);
+            } else {
+                this->Remove(change.Target);
+            }
+        }
+    }
+
+    /// Returns the value that exactly `network` is mapped to, ignoring the networks that contain it.
+    [[nodiscard]] auto Get(const Network& network) const noexcept -> Optional<std::reference_wrapper<const T>>
+    {
+        if (auto id = this->n_table.Find(network)) {
+            return std::cref(this->n_values[*id]);
+        }
+
+        return Nothing;
+    }
+
+    /// Returns the value of the most specific network that contains `address`, if any.
+    [[nodiscard]] auto Lookup(const Address& address) const noexcept -> Optional<std::reference_wrapper<const T>>
+    {
+        const UInt32 id = this->n_table.Lookup(address);
+        if (id == Table::kNoMatch) {
+            return Nothing;
+        }
+
+        return std::cref(this->n_values[id]);
+    }
+
+    /// Looks up every address in `addresses` like `Lookup`, storing a pointer to the value (or
+    /// **nullptr**) in the same position of `values`, which must be at least as large. This is a lot
+    /// faster than a loop of `Lookup`s since the table accesses are prefetched in batches.
+    ///
+    /// @returns the number of addresses that were in a network
+    auto LookupMany(Span<const Address> addresses, Span<const T*> values) const noexcept -> UInt
+    {
+        VIOLET_DEBUG_ASSERT(values.size() >= addresses.size(), "output span is too small");
+
+        Array<UInt32, 64> ids;
+        UInt matched = 0;
+        for (UInt i = 0; i < addresses.size(); i += ids.size()) {
+            const UInt count = std::min<UInt>(ids.size(), addresses.size() - i);
+            matched += this->n_table.LookupMany(addresses.subspan(i, count), Span<UInt32>(ids.data(), count));
+
+            for (UInt j = 0; j < count; j++) {
+                values[i + j] = ids[j] == Table::kNoMatch ? nullptr : &this->n_values[ids[j]];
+            }
+        }
+
+        return matched;
+    }
+
+    /// Returns the number of networks in the map.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->n_table.Size();
+    }
+
+    /// Returns **true** if the map has no networks.
+    [[nodiscard]] auto Empty() const noexcept -> bool
+    {
+        return this->Size() == 0;
+    }
+
+    /// Returns the number of bytes used by the lookup table, excluding the values.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        return this->n_table.MemoryUsage();
+    }
+
+    /// Returns a view of the table, whose lookups return the id of the value rather than the value;
+    /// this is what a [`TableImage`] stores.
+    [[nodiscard]] auto AsView() const noexcept -> typename Table::View
+    {
+        return this->n_table.AsView();
+    }
+
+    /// Returns the values indexed by their id. The value of a removed network stays until its id is
+    /// reused.
+    [[nodiscard]] auto Values() const noexcept -> Span<const T>
+    {
+        return this->n_values;
+    }
+
+private:
+    Table n_table;
+    Vec<T> n_values;
+    Vec<UInt32> n_free;
+};
+
+/// A batch of inserts and removes to [`Apply`] to a map, such as the difference between two versions
+/// of a feed; a [`SnapshotCell`] can apply it to a map that's being read with `Modify`.
+template<typename Table, typename T>
+struct PrefixMap<Table, T>::Delta final {
+    /// Constructs an empty delta.
+    Delta() = default;
+
+    /// Records that `network` is mapped to `value`.
+    auto Insert(const Network& network, T value) -> Delta&
+    {
+        this->n_changes.push_back({ network, Some<T>(std::move(value)) });
+        return *this;
+    }
+
+    /// Records that `network` is removed.
+    auto Remove(const Network& network) -> Delta&
+    {
+        this->n_changes.push_back({ network, Nothing });
+        return *this;
+    }
+
+    /// Returns the number of changes.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->n_changes.size();
+    }
+
+    /// Returns **true** if there are no changes.
+    [[nodiscard]] auto Empty() const noexcept -> bool
+    {
+        return this->n_changes.empty();
+    }
+
+private:
+    friend PrefixMap;
+
+    struct Change final {
+        Network Target;
+        Optional<T> Value; // `Nothing` to remove `Target`
+    };
+
+    Vec<Change> n_changes;
+};
+
+} // namespace violet::net::ip::detail
@@ -0,0 +1,236 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Networking/IP/NetworkV4.h>
+#include <violet/Networking/IP/PrefixMap.h>
+
+#include <absl/container/flat_hash_map.h>
+
+namespace violet::net::ip {
+
+namespace detail {
+
+/// The untyped core of [`PrefixMapV4`]: a DIR-24-8 longest-prefix-match table that maps IPv4 prefixes to
+/// 24-bit value ids.
+///
+/// The first 24 bits of an address index `tbl24`, a flat array with an entry for every `/24`. Prefixes up
+/// to `/24` are expanded into all of the `tbl24` entries they cover, so most lookups are a single memory
+/// access. A `/24` that has longer prefixes in it points to a 256-entry group in `tbl8` instead, which is
+/// indexed by the last octet: the second and last access.
+///
+/// Every entry also records the length of the prefix it was expanded from, so that inserting doesn't
+/// overwrite more specific prefixes and removing can restore the covering one.
+struct VIOLET_API Dir24Table final {
+    using Network = NetworkV4;
+    using Address = AddrV4;
+
+    /// Returned by `Lookup` when no prefix contains the address.
+    constexpr static UInt32 kNoMatch = ~UInt32(0);
+
+    /// The largest value id, limited by the 24 bits that entries have for it.
+    constexpr static UInt32 kMaxId = (UInt32(1) << 24) - 1;
+
+    /// The number of entries in `tbl24`, one for every `/24`.
+    constexpr static UInt kTbl24Size = UInt(1) << 24;
+
+    /// The number of entries in a `tbl8` group, one for every address of a `/24`.
+    constexpr static UInt32 kGroupSize = 256;
+
+    struct View;
+
+    Dir24Table();
+
+    /// Maps `network` to `id`, and returns the id it was mapped to before, if any.
+    auto Insert(const NetworkV4& network, UInt32 id) -> Optional<UInt32>;
+
+    /// Removes `network` and returns the id it was mapped to, if any.
+    auto Remove(const NetworkV4& network) -> Optional<UInt32>;
+
+    /// Returns the id that `network` itself is mapped to, if any.
+    [[nodiscard]] auto Find(const NetworkV4& network) const noexcept -> Optional<UInt32>;
+
+    /// Returns a view of the lookup arrays, which is valid until the table is modified or destroyed.
+    [[nodiscard]] auto AsView() const noexcept -> View;
+
+    /// Returns the id of the longest prefix that contains `address`, or [`kNoMatch`].
+    [[nodiscard]] auto Lookup(AddrV4 address) const noexcept -> UInt32;
+
+    /// Looks up every address in `addresses` like `Lookup`; see [`View::LookupMany`].
+    auto LookupMany(Span<const AddrV4> addresses, Span<UInt32> ids) const noexcept -> UInt;
+
+    /// Returns the number of prefixes in the table.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->n_rules.size();
+    }
+
+    /// Returns the number of bytes used by the lookup arrays.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        return (this->n_tbl24.capacity() + this->n_tbl8.capacity()) * sizeof(UInt32);
+    }
+
+private:
+    // entry layout: bit 31 is set for a `tbl24` entry that points to a `tbl8` group; bit 30 is set
+    // if the entry matches a prefix, whose length is in bits 24..29 and whose id is in bits 0..23
+    constexpr static UInt32 kExtended = UInt32(1) << 31;
+    constexpr static UInt32 kValid = UInt32(1) << 30;
+    constexpr static UInt32 kIdMask = kMaxId;
+
+    constexpr static auto makeEntry(UInt8 prefix, UInt32 id) noexcept -> UInt32
+    {
+        return kValid | (static_cast<UInt32>(prefix) << 24) | id;
+    }
+
+    constexpr static auto prefixOf(UInt32 entry) noexcept -> UInt8
+    {
+        return static_cast<UInt8>((entry >> 24) & 0x3F);
+    }
+
+    // an entry expanded from a `/prefix` can be replaced by a `/prefix` or a longer one
+    constexpr static auto replaceable(UInt32 entry, UInt8 prefix) noexcept -> bool
+    {
+        return !(entry & kValid) || prefixOf(entry) <= prefix;
+    }
+
+    constexpr static auto ruleKey(const NetworkV4& network) noexcept -> UInt64
+    {
+        return (static_cast<UInt64>(network.Address().AsUInt32()) << 8) | network.PrefixLength();
+    }
+
+    // when inserting, a `/prefix` entry replaces the ones from shorter (or the same) prefixes; when
+    // removing, only the ones that were expanded from that prefix are restored
+    constexpr static auto matches(UInt32 entry, UInt8 prefix, bool removing) noexcept -> bool
+    {
+        return removing ? (entry & kValid) && prefixOf(entry) == prefix : replaceable(entry, prefix);
+    }
+
+    void update(const NetworkV4& network, UInt32 entry, bool removing);
+    void updateGroup(UInt32 group, UInt32 first, UInt32 count, UInt8 prefix, UInt32 entry, bool removing);
+    auto allocateGroup(UInt32 entry) -> UInt32;
+    void collapseGroup(UInt32 index);
+    [[nodiscard]] auto coveringEntry(const NetworkV4& network) const noexcept -> UInt32;
+
+    Vec<UInt32> n_tbl24;
+    Vec<UInt32> n_tbl8;
+    Vec<UInt32> n_freeGroups;
+    absl::flat_hash_map<UInt64, UInt32> n_rules;
+};
+
+/// A read-only view of the lookup arrays of a [`Dir24Table`], which does all of its lookups; it doesn't
+/// own the arrays, so it can also look into a table that was mapped from a [`TableImage`].
+struct VIOLET_API Dir24Table::View final {
+    /// Views `tbl24`, which has [`kTbl24Size`] entries, and `tbl8`, which has whole groups. Nothing is
+    /// checked: an entry that points to a group past the end of `tbl8` is read out of bounds.
+    constexpr View(Span<const UInt32> tbl24, Span<const UInt32> tbl8, UInt size) noexcept
+        : n_tbl24(tbl24)
+        , n_tbl8(tbl8)
+        , n_size(size)
+    {
+        VIOLET_DEBUG_ASSERT(tbl24.size() == kTbl24Size, "tbl24 doesn't have an entry for every /24");
+        VIOLET_DEBUG_ASSERT(tbl8.size() % kGroupSize == 0, "tbl8 has a partial group");
+    }
+
+    /// Returns the id of the longest prefix that contains `address`, or [`kNoMatch`].
+    [[nodiscard]] auto Lookup(AddrV4 address) const noexcept -> UInt32
+    {
+        const UInt32 addr = address.AsUInt32();
+
+        UInt32 entry = this->n_tbl24[addr >> 8];
+        if (entry & kExtended) [[unlikely]] {
+            entry = this->n_tbl8[((entry & kIdMask) << 8) | (addr & 0xFF)];
+        }
+
+        return (entry & kValid) ? (entry & kIdMask) : kNoMatch;
+    }
+
+    /// Looks up every address in `addresses` like `Lookup` and stores the ids in `ids`, which must be at
+    /// least as large. The addresses are processed in small batches whose table entries are prefetched
+    /// before they are read, so the memory accesses of a batch overlap instead of stalling one by one.
+    ///
+    /// @returns the number of addresses that matched a prefix
+    auto LookupMany(Span<const AddrV4> addresses, Span<UInt32> ids) const noexcept -> UInt;
+
+    /// Returns the number of prefixes in the table.
+    [[nodiscard]] constexpr auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    [[nodiscard]] constexpr auto Tbl24() const noexcept -> Span<const UInt32>
+    {
+        return this->n_tbl24;
+    }
+
+    [[nodiscard]] constexpr auto Tbl8() const noexcept -> Span<const UInt32>
+    {
+        return this->n_tbl8;
+    }
+
+private:
+    Span<const UInt32> n_tbl24;
+    Span<const UInt32> n_tbl8;
+    UInt n_size;
+};
+
+inline auto Dir24Table::AsView() const noexcept -> View
+{
+    return { this->n_tbl24, this->n_tbl8, this->Size() };
+}
+
+inline auto Dir24Table::Lookup(AddrV4 address) const noexcept -> UInt32
+{
+    return this->AsView().Lookup(address);
+}
+
+} // namespace detail
+
+/// A longest-prefix-match map from IPv4 networks to values of type `T`, like a routing table that
+/// maps destinations to next hops.
+///
+/// `Lookup` finds the value of the most specific network that contains an address in one memory
+/// access for networks up to `/24`, and two otherwise, whatever the number of networks; see
+/// [`detail::Dir24Table`] for the layout and [`detail::PrefixMap`] for the operations. The price is a
+/// fixed 64 MiB array for the `/24`s, plus 1 KiB for every `/24` that contains a longer network, so
+/// this is meant for large tables (up to 16 million networks) on hot paths. Updates that cover many
+/// `/24`s, like inserting a `/8`, are comparatively slow.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/PrefixMapV4.h>
+///
+/// using namespace violet::net::ip;
+///
+/// PrefixMapV4<violet::Str> routes;
+/// routes.Insert(NetworkV4::Parse("10.0.0.0/8").Unwrap(), "core");
+/// routes.Insert(NetworkV4::Parse("10.1.2.0/25").Unwrap(), "lab");
+///
+/// routes.Lookup(AddrV4(10, 1, 2, 3)); // => Some("lab")
+/// routes.Lookup(AddrV4(10, 1, 2, 200)); // => Some("core")
+/// routes.Lookup(AddrV4(192, 168, 1, 1)); // => Nothing
+/// ```
+template<typename T>
+using PrefixMapV4 = detail::PrefixMap<detail::Dir24Table, T>;
+
+} // namespace violet::net::ip
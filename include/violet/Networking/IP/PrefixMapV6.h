@@ -0,0 +1,210 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Networking/IP/NetworkV6.h>
+#include <violet/Networking/IP/PrefixMap.h>
+
+namespace violet::net::ip {
+
+namespace detail {
+
+/// The untyped core of [`PrefixMapV6`]: a tree bitmap, i.e. a multibit trie with 6-bit strides whose
+/// nodes are compressed with bitmaps, that maps IPv6 prefixes to value ids.
+///
+/// A node at depth `k` stands for the bits `6k..6k+5` of an address. It holds the prefixes that end
+/// within its stride (lengths `6k+1` to `6k+6`) in a 126-bit bitmap, and which of its 64 children exist
+/// in a single 64-bit word. The children of a node are next to each other, as are its ids, so both are
+/// found by counting the bits before their position; descending costs no memory access besides the
+/// child itself. A node fits in half a cache line, and a lookup visits at most 22 of them.
+///
+/// Updates only touch the nodes on the path of the prefix, so they take time proportional to the
+/// prefix length rather than to the size of the table.
+struct VIOLET_API TreeBitmapV6 final {
+    using Network = NetworkV6;
+    using Address = AddrV6;
+
+    /// Returned by `Lookup` when no prefix contains the address.
+    constexpr static UInt32 kNoMatch = ~UInt32(0);
+
+    /// The largest value id.
+    constexpr static UInt32 kMaxId = kNoMatch - 1;
+
+    /// The number of address bits that each level of the trie consumes.
+    constexpr static UInt kStride = 6;
+
+    /// The number of children a node can have.
+    constexpr static UInt kFanout = UInt(1) << kStride;
+
+    /// The maximum number of nodes a lookup visits.
+    constexpr static UInt kLevels = (128 + kStride - 1) / kStride;
+
+    /// A node of the trie. It's public so that the lookup can be compiled once per instruction set
+    /// outside of the class; nothing else should need it.
+    struct alignas(32) Node final {
+        /// The prefix of length `l` (1 to `kStride`) whose bits within the stride are `b` is bit
+        /// `(1 << l) - 2 + b`, so longer prefixes have higher bits.
+        Array<UInt64, ((2 * kFanout) - 2 + 63) / 64> Prefixes{ };
+
+        /// Which of the `kFanout` children exist; they're stored from `ChildBase` in slot order.
+        Array<UInt64, (kFanout + 63) / 64> Children{ };
+
+        /// Where the ids of `Prefixes` start, in bit order.
+        UInt32 ResultBase = 0;
+        UInt32 ChildBase = 0;
+    };
+
+    struct View;
+
+    TreeBitmapV6();
+
+    /// Maps `network` to `id`, and returns the id it was mapped to before, if any.
+    auto Insert(const NetworkV6& network, UInt32 id) -> Optional<UInt32>;
+
+    /// Removes `network` and returns the id it was mapped to, if any.
+    auto Remove(const NetworkV6& network) -> Optional<UInt32>;
+
+    /// Returns the id that `network` itself is mapped to, if any.
+    [[nodiscard]] auto Find(const NetworkV6& network) const noexcept -> Optional<UInt32>;
+
+    /// Returns a view of the nodes and ids, which is valid until the table is modified or destroyed.
+    [[nodiscard]] auto AsView() const noexcept -> View;
+
+    /// Returns the id of the longest prefix that contains `address`, or [`kNoMatch`].
+    [[nodiscard]] auto Lookup(const AddrV6& address) const noexcept -> UInt32;
+
+    /// Looks up every address in `addresses` like `Lookup`; see [`View::LookupMany`].
+    auto LookupMany(Span<const AddrV6> addresses, Span<UInt32> ids) const noexcept -> UInt;
+
+    /// Returns the number of prefixes in the table.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    /// Returns the number of bytes used by the nodes and ids.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        return (this->n_nodes.capacity() * sizeof(Node)) + (this->n_pool.capacity() * sizeof(UInt32));
+    }
+
+private:
+    [[nodiscard]] auto findNode(const NetworkV6& network) const noexcept -> UInt32;
+
+    // the child blocks in `n_nodes` and the id blocks in `n_pool`, both rounded up to a power of two
+    // and recycled through free lists by log2 of their size
+    Vec<Node> n_nodes;
+    Array<Vec<UInt32>, kStride + 1> n_freeNodes;
+    Vec<UInt32> n_pool;
+    Array<Vec<UInt32>, kStride + 2> n_freeIds;
+    UInt32 n_default = kNoMatch; // the id of `::/0`, which no node can hold
+    UInt n_size = 0;
+};
+
+static_assert(sizeof(TreeBitmapV6::Node) == 32);
+
+/// A read-only view of the nodes and ids of a [`TreeBitmapV6`], which does all of its lookups; it
+/// doesn't own them, so it can also look into a table that was mapped from a [`TableImage`].
+struct VIOLET_API TreeBitmapV6::View final {
+    /// Views `nodes`, whose first node is the root, `ids`, and the id of `::/0` (or [`kNoMatch`]).
+    /// Nothing is checked: a node that points past the end of `nodes` or `ids` is read out of bounds.
+    constexpr View(Span<const Node> nodes, Span<const UInt32> ids, UInt32 defaultId, UInt size) noexcept
+        : n_nodes(nodes)
+        , n_ids(ids)
+        , n_default(defaultId)
+        , n_size(size)
+    {
+        VIOLET_DEBUG_ASSERT(!nodes.empty(), "trie has no root");
+    }
+
+    /// Returns the id of the longest prefix that contains `address`, or [`kNoMatch`].
+    [[nodiscard]] auto Lookup(const AddrV6& address) const noexcept -> UInt32;
+
+    /// Looks up every address in `addresses` like `Lookup` and stores the ids in `ids`, which must be at
+    /// least as large. A batch of addresses walks down the trie together, and the nodes for the next
+    /// level are prefetched for the whole batch before any of them is read.
+    ///
+    /// @returns the number of addresses that matched a prefix
+    auto LookupMany(Span<const AddrV6> addresses, Span<UInt32> ids) const noexcept -> UInt;
+
+    /// Returns the number of prefixes in the table.
+    [[nodiscard]] constexpr auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    [[nodiscard]] constexpr auto Nodes() const noexcept -> Span<const Node>
+    {
+        return this->n_nodes;
+    }
+
+    [[nodiscard]] constexpr auto Ids() const noexcept -> Span<const UInt32>
+    {
+        return this->n_ids;
+    }
+
+    /// Returns the id of `::/0`, or [`kNoMatch`].
+    [[nodiscard]] constexpr auto Default() const noexcept -> UInt32
+    {
+        return this->n_default;
+    }
+
+private:
+    Span<const Node> n_nodes;
+    Span<const UInt32> n_ids;
+    UInt32 n_default;
+    UInt n_size;
+};
+
+inline auto TreeBitmapV6::AsView() const noexcept -> View
+{
+    return { this->n_nodes, this->n_pool, this->n_default, this->n_size };
+}
+
+} // namespace detail
+
+/// A longest-prefix-match map from IPv6 networks to values of type `T`, like a routing table that
+/// maps destinations to next hops.
+///
+/// `Lookup` visits at most one trie node per 6 bits of the address, whatever the number of networks;
+/// see [`detail::TreeBitmapV6`] for the layout and [`detail::PrefixMap`] for the operations. Unlike
+/// [`PrefixMapV4`], there is no up-front allocation, and memory grows with the number of networks.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/PrefixMapV6.h>
+///
+/// using namespace violet::net::ip;
+///
+/// PrefixMapV6<violet::Str> routes;
+/// routes.Insert(NetworkV6::Parse("2001:db8::/32").Unwrap(), "documentation");
+/// routes.Insert(NetworkV6::Parse("2001:db8:1::/48").Unwrap(), "lab");
+///
+/// routes.Lookup(AddrV6::Parse("2001:db8:1::1").Unwrap()); // => Some("lab")
+/// routes.Lookup(AddrV6::Parse("2001:db8:2::1").Unwrap()); // => Some("documentation")
+/// routes.Lookup(AddrV6::Localhost()); // => Nothing
+/// ```
+template<typename T>
+using PrefixMapV6 = detail::PrefixMap<detail::TreeBitmapV6, T>;
+
+} // namespace violet::net::ip
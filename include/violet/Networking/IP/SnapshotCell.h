@@ -0,0 +1,423 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Violet.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace violet::net::ip {
+
+/// Publishes immutable snapshots of a table, such as a [`PrefixMapV4`] or an [`IPSetV6`], to threads
+/// that look up into it while it's being replaced: read-copy-update with epoch-based reclamation.
+///
+/// Every reader thread registers a [`Reader`] once, and then reads through a [`ReadGuard`], which
+/// pins the snapshot that was current when it was taken. Taking and dropping a guard is a handful of
+/// loads and stores to memory that only that thread writes: it never waits, takes a lock, or touches a
+/// reference count that other threads write to, so readers don't contend with each other.
+///
+/// Writers build the next snapshot wherever they like and `Publish` it, which swaps it in with one
+/// atomic exchange. The snapshot that it replaces is retired rather than destroyed, since guards may
+/// still be reading it, and is destroyed by a later `Publish` or `Reclaim` once every guard that
+/// could see it is gone. Writers are serialized by a mutex that readers never take.
+///
+/// Small changes to a large snapshot, like a [`PrefixMap::Delta`], are better made with `Modify`,
+/// which applies them to a second copy of the snapshot instead of a new one (see there).
+///
+/// ## Epochs
+/// The cell counts publications in an epoch. A reader records the epoch when it takes a guard, before
+/// it loads the snapshot, and clears it when the guard is dropped; a snapshot retired in epoch `e` is
+/// destroyed once every reader is either outside a guard or recorded an epoch after `e`, since those
+/// readers loaded the snapshot that replaced it. A guard that's held forever therefore keeps every
+/// snapshot retired after it was taken alive, but doesn't block writers.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/PrefixMapV4.h>
+/// #include <violet/Networking/IP/SnapshotCell.h>
+///
+/// using namespace violet::net::ip;
+///
+/// SnapshotCell<PrefixMapV4<Action>> acl;
+///
+/// // on every worker thread
+/// auto reader = acl.Register();
+/// for (const Packet& packet: packets) {
+///     auto snapshot = reader.Read();
+///     auto action = snapshot->Lookup(packet.Source);
+/// }
+///
+/// // on the control thread, whenever the ACL changes
+/// PrefixMapV4<Action> next = BuildAcl(rules);
+/// acl.Publish(std::move(next));
+///
+/// // or, to change a few networks of a large table
+/// PrefixMapV4<Action>::Delta delta;
+/// delta.Insert(NetworkV4::Parse("192.0.2.0/24").Unwrap(), Action::kDrop);
+/// delta.Remove(NetworkV4::Parse("10.0.0.0/8").Unwrap());
+/// acl.Modify([delta](PrefixMapV4<Action>& map) { map.Apply(delta); });
+/// ```
+template<typename T>
+struct SnapshotCell final {
+    struct Reader;
+    struct ReadGuard;
+
+    /// Constructs a cell whose snapshot is a default-constructed `T`.
+    SnapshotCell()
+        : SnapshotCell(T())
+    {
+    }
+
+    /// Constructs a cell whose snapshot is `initial`.
+    explicit SnapshotCell(T initial)
+        : n_current(new T(std::move(initial)))
+    {
+    }
+
+    SnapshotCell(const SnapshotCell&) = delete;
+    auto operator=(const SnapshotCell&) -> SnapshotCell& = delete;
+
+    /// Destroys the current and every retired snapshot. No [`Reader`] may outlive the cell.
+    ~SnapshotCell()
+    {
+        VIOLET_DEBUG_ASSERT(this->readers() == 0, "a reader outlived its snapshot cell");
+
+        delete this->n_current.load(std::memory_order_relaxed);
+        delete this->n_spare;
+        for (const Retirement& retired: this->n_retired) {
+            delete retired.Snapshot;
+        }
+    }
+
+    /// Registers a reader for the calling thread. This takes the writers' lock, so it belongs at the
+    /// start of the thread rather than on its hot path.
+    [[nodiscard]] auto Register() -> Reader
+    {
+        const std::lock_guard lock(this->n_mutex);
+
+        for (const auto& slot: this->n_slots) {
+            if (!slot->Claimed) {
+                slot->Claimed = true;
+                return Reader(*this, *slot);
+            }
+        }
+
+        this->n_slots.push_back(std::make_unique<Slot>());
+        this->n_slots.back()->Claimed = true;
+        return Reader(*this, *this->n_slots.back());
+    }
+
+    /// Replaces the snapshot with `next`, and destroys the retired snapshots that no reader can see
+    /// anymore.
+    void Publish(T next)
+    {
+        auto* snapshot = new T(std::move(next));
+
+        const std::lock_guard lock(this->n_mutex);
+        this->publish(snapshot);
+    }
+
+    /// Replaces the snapshot with a copy of it that `update` modified, like `Publish`. `update` is
+    /// called with the writers' lock held, so updates don't race with each other.
+    template<typename F>
+    void Update(F&& update)
+    {
+        const std::lock_guard lock(this->n_mutex);
+
+        auto next = std::make_unique<T>(*this->n_current.load(std::memory_order_relaxed));
+        std::forward<F>(update)(*next);
+        this->publish(next.release());
+    }
+
+    /// Applies `change` to the snapshot in place of a copy of it, so that it costs as much as the change
+    /// rather than as the snapshot. Readers never see a partly applied change: it's applied to a spare
+    /// copy of the snapshot that no reader can see, which is then published like with `Publish`.
+    ///
+    /// The spare is the snapshot that the previous `Modify` replaced, and it's brought up to date by
+    /// calling the previous change on it again, so `change` has to be callable twice with the same
+    /// effect, like applying the same delta to two copies of a map. Before that, `Modify` waits for the
+    /// guards that can still see the spare to be dropped, which are those taken before the previous
+    /// `Modify`, so the calling thread mustn't hold a guard itself.
+    ///
+    /// The first `Modify`, and the first after a `Publish` or `Update`, copies the snapshot to make the
+    /// spare, which doubles the memory the cell uses from then on.
+    template<typename F>
+    void Modify(F change)
+    {
+        const std::lock_guard lock(this->n_mutex);
+
+        if (this->n_spare == nullptr) {
+            this->n_spare = new T(*this->n_current.load(std::memory_order_relaxed));
+        } else {
+            while (this->oldestEpoch() <= this->n_spareEpoch) {
+                std::this_thread::yield();
+            }
+
+            this->n_missed(*this->n_spare);
+        }
+
+        change(*this->n_spare);
+        this->n_missed = std::move(change);
+
+        T* old = this->n_current.exchange(this->n_spare, std::memory_order_seq_cst);
+        this->n_spareEpoch = this->n_epoch.fetch_add(1, std::memory_order_seq_cst);
+        this->n_spare = old;
+
+        this->reclaim();
+    }
+
+    /// Destroys the retired snapshots that no reader can see anymore.
+    /// @returns the number of snapshots that are still retired
+    auto Reclaim() -> UInt
+    {
+        const std::lock_guard lock(this->n_mutex);
+        return this->reclaim();
+    }
+
+    /// Waits until every snapshot retired so far is destroyed, i.e. until every guard that was taken
+    /// before the call is dropped. The calling thread must not hold a guard itself.
+    void Synchronize()
+    {
+        while (this->Reclaim() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    /// Returns the number of retired snapshots that aren't destroyed yet.
+    [[nodiscard]] auto Retired() const -> UInt
+    {
+        const std::lock_guard lock(this->n_mutex);
+        return this->n_retired.size();
+    }
+
+private:
+    // a reader's epoch, on its own cache line so that readers don't share lines with each other
+    struct alignas(64) Slot final {
+        std::atomic<UInt64> Epoch{ kQuiescent };
+        UInt Depth = 0; // of nested guards, only accessed by the reader
+        bool Claimed = false; // guarded by `n_mutex`
+    };
+
+    struct Retirement final {
+        T* Snapshot;
+        UInt64 Epoch;
+    };
+
+    // the epoch of a reader outside of any guard; the cell's epoch starts after it
+    constexpr static UInt64 kQuiescent = 0;
+
+    void publish(T* snapshot)
+    {
+        // a spare would miss this snapshot's changes, so it's retired with the snapshot it was
+        if (this->n_spare != nullptr) {
+            this->n_retired.push_back({ std::exchange(this->n_spare, nullptr), this->n_spareEpoch });
+            this->n_missed = nullptr;
+        }
+
+        // the exchange has to come before the increment: a reader that sees the new epoch is then
+        // guaranteed to load the new snapshot
+        T* old = this->n_current.exchange(snapshot, std::memory_order_seq_cst);
+        const UInt64 epoch = this->n_epoch.fetch_add(1, std::memory_order_seq_cst);
+
+        this->n_retired.push_back({ old, epoch });
+        this->reclaim();
+    }
+
+    auto reclaim() -> UInt
+    {
+        if (this->n_retired.empty()) {
+            return 0;
+        }
+
+        const UInt64 oldest = this->oldestEpoch();
+
+        // readers that recorded an epoch after a snapshot was retired can't have loaded it
+        std::erase_if(this->n_retired, [oldest](const Retirement& retired) -> bool {
+            if (retired.Epoch >= oldest) {
+                return false;
+            }
+
+            delete retired.Snapshot;
+            return true;
+        });
+
+        return this->n_retired.size();
+    }
+
+    // the oldest epoch that a reader in a guard recorded, or the maximum if there is none
+    [[nodiscard]] auto oldestEpoch() const noexcept -> UInt64
+    {
+        UInt64 oldest = std::numeric_limits<UInt64>::max();
+        for (const auto& slot: this->n_slots) {
+            const UInt64 epoch = slot->Epoch.load(std::memory_order_seq_cst);
+            if (epoch != kQuiescent) {
+                oldest = std::min(oldest, epoch);
+            }
+        }
+
+        return oldest;
+    }
+
+    [[nodiscard]] auto readers() const -> UInt
+    {
+        const std::lock_guard lock(this->n_mutex);
+        return static_cast<UInt>(
+            std::ranges::count_if(this->n_slots, [](const auto& slot) -> bool { return slot->Claimed; }));
+    }
+
+    std::atomic<T*> n_current;
+    alignas(64) std::atomic<UInt64> n_epoch{ kQuiescent + 1 };
+
+    mutable std::mutex n_mutex;
+    Vec<std::unique_ptr<Slot>> n_slots; // never shrinks, so that slots stay where readers point
+    Vec<Retirement> n_retired;
+
+    // the snapshot that the last `Modify` replaced, the epoch it was replaced in, and the change it missed
+    T* n_spare = nullptr;
+    UInt64 n_spareEpoch = 0;
+    std::function<void(T&)> n_missed;
+};
+
+/// A thread's registration with a [`SnapshotCell`], which can only be used by one thread at a time.
+template<typename T>
+struct SnapshotCell<T>::Reader final {
+    Reader(const Reader&) = delete;
+    auto operator=(const Reader&) -> Reader& = delete;
+
+    Reader(Reader&& other) noexcept
+        : n_cell(std::exchange(other.n_cell, nullptr))
+        , n_slot(std::exchange(other.n_slot, nullptr))
+    {
+    }
+
+    auto operator=(Reader&& other) noexcept -> Reader&
+    {
+        if (this != &other) {
+            this->release();
+            this->n_cell = std::exchange(other.n_cell, nullptr);
+            this->n_slot = std::exchange(other.n_slot, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~Reader()
+    {
+        this->release();
+    }
+
+    /// Pins the current snapshot until the guard is dropped. Guards can be nested, in which case the
+    /// inner ones may see newer snapshots than the outer ones.
+    [[nodiscard]] auto Read() noexcept -> ReadGuard
+    {
+        Slot& slot = *this->n_slot;
+        if (slot.Depth++ == 0) {
+            // the epoch has to be visible to writers before the snapshot is loaded, which is what makes
+            // this store sequentially consistent rather than a release
+            slot.Epoch.store(this->n_cell->n_epoch.load(std::memory_order_acquire), std::memory_order_seq_cst);
+        }
+
+        return ReadGuard(slot, this->n_cell->n_current.load(std::memory_order_seq_cst));
+    }
+
+private:
+    friend SnapshotCell;
+
+    Reader(SnapshotCell& cell, Slot& slot) noexcept
+        : n_cell(&cell)
+        , n_slot(&slot)
+    {
+    }
+
+    void release() noexcept
+    {
+        if (this->n_slot == nullptr) {
+            return;
+        }
+
+        VIOLET_DEBUG_ASSERT(this->n_slot->Depth == 0, "a reader was dropped while one of its guards is alive");
+
+        const std::lock_guard lock(this->n_cell->n_mutex);
+        this->n_slot->Claimed = false;
+    }
+
+    SnapshotCell* n_cell;
+    Slot* n_slot;
+};
+
+/// A snapshot pinned by [`Reader::Read`], which stays valid until the guard is dropped.
+template<typename T>
+struct SnapshotCell<T>::ReadGuard final {
+    ReadGuard(const ReadGuard&) = delete;
+    auto operator=(const ReadGuard&) -> ReadGuard& = delete;
+    auto operator=(ReadGuard&&) -> ReadGuard& = delete;
+
+    ReadGuard(ReadGuard&& other) noexcept
+        : n_slot(std::exchange(other.n_slot, nullptr))
+        , n_snapshot(other.n_snapshot)
+    {
+    }
+
+    ~ReadGuard()
+    {
+        if (this->n_slot != nullptr && --this->n_slot->Depth == 0) {
+            this->n_slot->Epoch.store(kQuiescent, std::memory_order_release);
+        }
+    }
+
+    /// Returns the snapshot.
+    [[nodiscard]] auto Get() const noexcept -> const T&
+    {
+        return *this->n_snapshot;
+    }
+
+    auto operator*() const noexcept -> const T&
+    {
+        return *this->n_snapshot;
+    }
+
+    auto operator->() const noexcept -> const T*
+    {
+        return this->n_snapshot;
+    }
+
+private:
+    friend Reader;
+
+    ReadGuard(Slot& slot, const T* snapshot) noexcept
+        : n_slot(&slot)
+        , n_snapshot(snapshot)
+    {
+    }
+
+    Slot* n_slot;
+    const T* n_snapshot;
+};
+
+} // namespace violet::net::ip
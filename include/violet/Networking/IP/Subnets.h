@@ -0,0 +1,177 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Violet.h>
+
+#include <compare>
+#include <iterator>
+
+namespace violet::net::ip {
+
+/// The subnets of a [`NetworkV4`] or [`NetworkV6`] with a longer prefix, as returned by their
+/// `Subnets(prefix)`. Nothing is materialized: every subnet is computed from its index when it's
+/// accessed, so this is cheap to create for any number of subnets.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/NetworkV4.h>
+///
+/// using violet::net::ip::NetworkV4;
+///
+/// constexpr auto subnets = NetworkV4::Parse("10.0.0.0/8").Unwrap().Subnets(10);
+/// static_assert(subnets.size() == 4);
+/// static_assert(subnets[1] == NetworkV4::Parse("10.64.0.0/10").Unwrap());
+/// ```
+template<typename Network>
+struct SubnetRange final {
+    struct iterator final {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Network;
+        using difference_type = Int64;
+        using pointer = void;
+        using reference = Network;
+
+        constexpr VIOLET_IMPLICIT iterator() noexcept = default;
+        constexpr VIOLET_IMPLICIT iterator(const SubnetRange* range, UInt64 index) noexcept
+            : n_range(range)
+            , n_index(index)
+        {
+        }
+
+        constexpr auto operator*() const noexcept -> Network
+        {
+            return (*this->n_range)[this->n_index];
+        }
+
+        constexpr auto operator[](difference_type offset) const noexcept -> Network
+        {
+            return (*this->n_range)[this->n_index + static_cast<UInt64>(offset)];
+        }
+
+        constexpr auto operator++() noexcept -> iterator&
+        {
+            ++this->n_index;
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> iterator
+        {
+            auto copy = *this;
+            ++this->n_index;
+            return copy;
+        }
+
+        constexpr auto operator--() noexcept -> iterator&
+        {
+            --this->n_index;
+            return *this;
+        }
+
+        constexpr auto operator--(int) noexcept -> iterator
+        {
+            auto copy = *this;
+            --this->n_index;
+            return copy;
+        }
+
+        constexpr auto operator+=(difference_type offset) noexcept -> iterator&
+        {
+            this->n_index += static_cast<UInt64>(offset);
+            return *this;
+        }
+
+        constexpr auto operator-=(difference_type offset) noexcept -> iterator&
+        {
+            this->n_index -= static_cast<UInt64>(offset);
+            return *this;
+        }
+
+        constexpr friend auto operator+(iterator it, difference_type offset) noexcept -> iterator
+        {
+            return it += offset;
+        }
+
+        constexpr friend auto operator+(difference_type offset, iterator it) noexcept -> iterator
+        {
+            return it += offset;
+        }
+
+        constexpr friend auto operator-(iterator it, difference_type offset) noexcept -> iterator
+        {
+            return it -= offset;
+        }
+
+        constexpr friend auto operator-(const iterator& lhs, const iterator& rhs) noexcept -> difference_type
+        {
+            return static_cast<difference_type>(lhs.n_index - rhs.n_index);
+        }
+
+        constexpr friend auto operator==(const iterator& lhs, const iterator& rhs) noexcept -> bool
+        {
+            return lhs.n_index == rhs.n_index;
+        }
+
+        constexpr friend auto operator<=>(const iterator& lhs, const iterator& rhs) noexcept -> std::strong_ordering
+        {
+            return lhs.n_index <=> rhs.n_index;
+        }
+
+    private:
+        const SubnetRange* n_range = nullptr;
+        UInt64 n_index = 0;
+    };
+
+    constexpr VIOLET_IMPLICIT SubnetRange(Network parent, UInt8 prefix) noexcept
+        : n_parent(parent)
+        , n_prefix(prefix)
+    {
+    }
+
+    /// Returns the number of subnets.
+    [[nodiscard]] constexpr auto size() const noexcept -> UInt64
+    {
+        return UInt64(1) << (this->n_prefix - this->n_parent.PrefixLength());
+    }
+
+    /// Returns the `index`th subnet; `index` must be less than `size()`.
+    [[nodiscard]] constexpr auto operator[](UInt64 index) const noexcept -> Network
+    {
+        return this->n_parent.Subnet(this->n_prefix, index);
+    }
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> iterator
+    {
+        return { this, 0 };
+    }
+
+    [[nodiscard]] constexpr auto end() const noexcept -> iterator
+    {
+        return { this, this->size() };
+    }
+
+private:
+    Network n_parent;
+    UInt8 n_prefix;
+};
+
+} // namespace violet::net::ip
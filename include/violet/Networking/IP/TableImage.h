@@ -0,0 +1,248 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Container/Result.h>
+#include <violet/Networking/IP/IPSetV4.h>
+#include <violet/Networking/IP/IPSetV6.h>
+#include <violet/Networking/IP/PrefixMapV4.h>
+#include <violet/Networking/IP/PrefixMapV6.h>
+
+namespace violet::net::ip {
+
+struct TableImageError;
+
+namespace detail {
+
+/// Returns the CRC-32C (Castagnoli) of `bytes`, continuing from the checksum `crc` of the bytes before
+/// them. The `crc32` instruction of SSE 4.2 is used if the CPU has it.
+VIOLET_API auto Crc32c(Span<const UInt8> bytes, UInt32 crc = 0) noexcept -> UInt32;
+
+} // namespace detail
+
+/// Address sets and longest-prefix-match tables in a binary format that is used as is, so that a
+/// process can map a file built ahead of time instead of building its tables at startup.
+///
+/// Opening an image only reads its header: the lookups of [`SetV4`], [`PrefixesV4`], etc. work
+/// directly on the mapped pages, which the kernel loads on first use and shares between every process
+/// that maps the same file. Whatever the size of the tables, opening takes constant time.
+///
+/// ## Format
+/// Every integer is little-endian. An image is a 64-byte header, a table of sections, and the
+/// sections, each of which starts at a multiple of 64 bytes so that it can be used in place:
+///
+/// | Offset | Size | Field                                                                  |
+/// | ------ | ---- | ---------------------------------------------------------------------- |
+/// | 0      | 8    | magic, `VIOLETIP`                                                      |
+/// | 8      | 4    | format version, [`kVersion`]                                           |
+/// | 12     | 4    | number of sections                                                     |
+/// | 16     | 8    | size of the image in bytes                                             |
+/// | 24     | 4    | CRC-32C of everything after the section table                          |
+/// | 28     | 32   | reserved, zero                                                         |
+/// | 60     | 4    | CRC-32C of the header before this field and of the section table       |
+///
+/// A section table entry is 32 bytes: its kind (4), 4 reserved bytes, its offset (8), size (8) and a
+/// kind-specific value (8). The sections are the arrays that the in-memory tables look up:
+///
+/// - `1`: the ranges of an [`IPSetV4`], as 8-byte `{first, last}` pairs laid out like
+///   [`detail::IntervalSet`]'s, including the sentinel.
+/// - `2`: the ranges of an [`IPSetV6`], the same with 16-byte keys whose low half comes first.
+/// - `3` and `4`: `tbl24` and `tbl8` of a [`detail::Dir24Table`]; `3` has the number of prefixes.
+/// - `5` and `6`: the nodes and ids of a [`detail::TreeBitmapV6`]; `5` has the number of prefixes and
+///   `6` the id of `::/0`.
+/// - `7` and `8`: optional labels for the ids of both prefix tables, as `n + 1` 4-byte offsets into
+///   the UTF-8 text in `8`.
+///
+/// Readers ignore the kinds that they don't know, so sections can be added without breaking them;
+/// [`kVersion`] only changes when an existing layout does.
+///
+/// Opening checks the header, its checksum, and that every section is in bounds, but the contents of
+/// the sections are only checked by [`Verify`], which reads all of them. A corrupted table can make a
+/// lookup read out of bounds, so `Verify` an image before trusting it if it was copied around.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IP/TableImage.h>
+///
+/// using namespace violet::net::ip;
+///
+/// // ahead of time, e.g. with `//tools/iptable`
+/// IPSetV4 blocked = IPSetV4::Builder().Add(NetworkV4::Parse("10.0.0.0/8").Unwrap()).Build();
+/// TableImageWriter().SetV4(blocked.AsView()).WriteTo("blocklist.vip");
+///
+/// // at startup
+/// auto image = TableImage::Open("blocklist.vip").Unwrap();
+/// image.SetV4()->Contains(AddrV4(10, 1, 2, 3)); // => true
+/// ```
+struct VIOLET_API TableImage final {
+    /// The version of the format that is written, and the only one that is read.
+    constexpr static UInt32 kVersion = 1;
+
+    /// The alignment of every section, and of the bytes given to `FromBytes`.
+    constexpr static UInt kAlignment = 64;
+
+    /// Maps the image in the file at `path`, read-only; the file can be replaced while it's mapped,
+    /// but not modified in place.
+    static auto Open(Str path) noexcept -> Result<TableImage, TableImageError>;
+
+    /// Uses the image in `bytes`, which must be aligned to [`kAlignment`] and outlive the image.
+    static auto FromBytes(Span<const UInt8> bytes) noexcept -> Result<TableImage, TableImageError>;
+
+    TableImage(const TableImage&) = delete;
+    auto operator=(const TableImage&) -> TableImage& = delete;
+
+    TableImage(TableImage&& other) noexcept;
+    auto operator=(TableImage&& other) noexcept -> TableImage&;
+
+    ~TableImage();
+
+    /// Checks the checksum of the sections, which reads all of them.
+    [[nodiscard]] auto Verify() const noexcept -> Result<void, TableImageError>;
+
+    /// Returns the IPv4 address set, if the image has one.
+    [[nodiscard]] auto SetV4() const noexcept -> Optional<IPSetV4::View>;
+
+    /// Returns the IPv6 address set, if the image has one.
+    [[nodiscard]] auto SetV6() const noexcept -> Optional<IPSetV6::View>;
+
+    /// Returns the IPv4 prefix table, if the image has one.
+    [[nodiscard]] auto PrefixesV4() const noexcept -> Optional<detail::Dir24Table::View>;
+
+    /// Returns the IPv6 prefix table, if the image has one.
+    [[nodiscard]] auto PrefixesV6() const noexcept -> Optional<detail::TreeBitmapV6::View>;
+
+    /// Returns the label of the prefix table value `id`, if the image has one.
+    [[nodiscard]] auto Label(UInt32 id) const noexcept -> Optional<Str>;
+
+    /// Returns the bytes of the whole image.
+    [[nodiscard]] auto Bytes() const noexcept -> Span<const UInt8>
+    {
+        return this->n_bytes;
+    }
+
+private:
+    // the number of section kinds that this version knows about
+    constexpr static UInt kSectionKinds = 8;
+
+    TableImage(Span<const UInt8> bytes, bool mapped) noexcept;
+
+    auto load() noexcept -> Result<void, TableImageError>;
+
+    template<typename T>
+    [[nodiscard]] auto section(UInt kind) const noexcept -> Span<const T>;
+
+    Span<const UInt8> n_bytes;
+    bool n_mapped;
+    UInt n_payload = 0; // where the checksummed part starts
+    Array<Span<const UInt8>, kSectionKinds + 1> n_sections{ }; // by kind
+    Array<UInt64, kSectionKinds + 1> n_extra{ };
+};
+
+/// Builds a [`TableImage`] from in-memory sets and tables.
+///
+/// Only views are kept, so the sets and tables have to outlive the writer and can't be modified until
+/// it has written them.
+struct VIOLET_API TableImageWriter final {
+    /// Constructs a writer for an empty image.
+    TableImageWriter() = default;
+
+    /// Adds the IPv4 address set, replacing any other.
+    auto SetV4(IPSetV4::View set) noexcept -> TableImageWriter&;
+
+    /// Adds the IPv6 address set, replacing any other.
+    auto SetV6(IPSetV6::View set) noexcept -> TableImageWriter&;
+
+    /// Adds the IPv4 prefix table, replacing any other.
+    auto PrefixesV4(detail::Dir24Table::View table) noexcept -> TableImageWriter&;
+
+    /// Adds the IPv6 prefix table, replacing any other.
+    auto PrefixesV6(detail::TreeBitmapV6::View table) noexcept -> TableImageWriter&;
+
+    /// Labels the prefix table value ids: `labels[id]` is the label of `id`.
+    auto Labels(Span<const Str> labels) -> TableImageWriter&;
+
+    /// Returns the image, aligned for [`TableImage::FromBytes`] only if the vector happens to be.
+    [[nodiscard]] auto Serialize() const -> Vec<UInt8>;
+
+    /// Writes the image to `path`. It's written to a temporary file next to it first, which then
+    /// replaces `path`, so processes that have the old image mapped keep using it until they reopen it.
+    auto WriteTo(Str path) const -> Result<void, TableImageError>;
+
+private:
+    Optional<IPSetV4::View> n_setV4;
+    Optional<IPSetV6::View> n_setV6;
+    Optional<detail::Dir24Table::View> n_prefixesV4;
+    Optional<detail::TreeBitmapV6::View> n_prefixesV6;
+    Vec<UInt32> n_labelOffsets;
+    String n_labels;
+};
+
+/// Represents an error returned when a [`TableImage`] can't be opened or written.
+struct VIOLET_API TableImageError final {
+    /// What went wrong.
+    enum struct Status : UInt8 {
+        kSystem = 0, ///< a system call failed; see `Errno`
+        kTruncated = 1, ///< the image is smaller than its header says
+        kBadMagic = 2, ///< the data isn't an image
+        kUnsupportedVersion = 3, ///< the image is from an incompatible version of the format
+        kCorruptHeader = 4, ///< the checksum of the header and section table doesn't match
+        kInvalidSection = 5, ///< a section is out of bounds, misaligned, duplicated or malformed
+        kMisaligned = 6, ///< the bytes given to `FromBytes` aren't aligned
+        kChecksumMismatch = 7 ///< the checksum of the sections doesn't match
+    };
+
+    /// Creates an error of the given kind; `error` is the `errno` of a [`Status::kSystem`] error.
+    constexpr TableImageError(Status kind, int error = 0) noexcept
+        : n_bits(static_cast<UInt32>(kind) | (static_cast<UInt32>(error) << 8))
+    {
+    }
+
+    /// Returns what went wrong.
+    [[nodiscard]] constexpr auto Kind() const noexcept -> Status
+    {
+        return static_cast<Status>(this->n_bits & 0xFF);
+    }
+
+    /// Returns the `errno` of the system call that failed, or `0`.
+    [[nodiscard]] constexpr auto Errno() const noexcept -> int
+    {
+        return static_cast<int>(this->n_bits >> 8);
+    }
+
+    /// Returns a string description of the error.
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const TableImageError& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    constexpr auto operator==(const TableImageError&) const noexcept -> bool = default;
+
+private:
+    // kind | errno << 8
+    UInt32 n_bits;
+};
+
+} // namespace violet::net::ip
+
+VIOLET_FORMATTER(violet::net::ip::TableImageError);
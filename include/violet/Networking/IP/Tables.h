@@ -0,0 +1,117 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Lookup tables shared by the `ip::AddrV4` and `ip::AddrV6` formatters. This is an implementation
+// detail of the `-inl.h` headers; it is only public so that the header-only targets can use it.
+
+#pragma once
+
+#include <violet/Violet.h>
+
+#include <charconv>
+#include <cstring>
+
+namespace violet::net::ip::detail {
+
+/// Decimal spelling of an octet, left-aligned in `Chars` with `Length` significant characters.
+struct octet_digits_t final {
+    Array<char, 3> Chars;
+    UInt8 Length;
+};
+
+constexpr auto kOctetDigits = []() constexpr -> Array<octet_digits_t, 256> {
+    Array<octet_digits_t, 256> table{ };
+    for (UInt value = 0; value < 256; ++value) {
+        auto& entry = table[value];
+        if (value >= 100) {
+            entry.Chars = { static_cast<char>('0' + (value / 100)), static_cast<char>('0' + ((value / 10) % 10)),
+                static_cast<char>('0' + (value % 10)) };
+            entry.Length = 3;
+        } else if (value >= 10) {
+            entry.Chars = { static_cast<char>('0' + (value / 10)), static_cast<char>('0' + (value % 10)), '\0' };
+            entry.Length = 2;
+        } else {
+            entry.Chars = { static_cast<char>('0' + value), '\0', '\0' };
+            entry.Length = 1;
+        }
+    }
+
+    return table;
+}();
+
+/// Lowercase hexadecimal spelling of every byte.
+constexpr auto kHexDigits = []() constexpr -> Array<Array<char, 2>, 256> {
+    constexpr Str kAlphabet = "0123456789abcdef";
+
+    Array<Array<char, 2>, 256> table{ };
+    for (UInt value = 0; value < 256; ++value) {
+        table[value] = { kAlphabet[value >> 4], kAlphabet[value & 0xF] };
+    }
+
+    return table;
+}();
+
+/// Writes the decimal spelling of `value` at `out` and returns the position past the last digit.
+///
+/// This always stores three bytes, so the caller must have that much room even for 1-digit octets.
+inline auto WriteOctet(char* out, UInt8 value) noexcept -> char*
+{
+    const auto& digits = kOctetDigits[value];
+    std::memcpy(out, digits.Chars.data(), 3);
+
+    return out + digits.Length;
+}
+
+/// Writes `value` as lowercase hex without leading zeros and returns the position past the last digit.
+inline auto WriteHextet(char* out, UInt16 value) noexcept -> char*
+{
+    const auto& high = kHexDigits[value >> 8];
+    const auto& low = kHexDigits[value & 0xFF];
+    const Array<char, 4> digits = { high[0], high[1], low[0], low[1] };
+
+    UInt significant = value >= 0x1000 ? 4 : value >= 0x100 ? 3 : value >= 0x10 ? 2 : 1;
+    std::memcpy(out, digits.data() + (4 - significant), significant);
+
+    return out + significant;
+}
+
+/// Runs `write(char*) -> char*`, which may store up to `MaxLength` bytes, against `[first, last)`.
+///
+/// The writers above store a few bytes of slack past what they report, so short destination ranges are
+/// formatted into a scratch buffer first and only copied over if the result fits.
+template<UInt MaxLength, typename Fn>
+auto WriteBounded(char* first, char* last, Fn&& write) noexcept -> std::to_chars_result
+{
+    if (last - first >= static_cast<std::ptrdiff_t>(MaxLength)) {
+        return { write(first), std::errc{ } };
+    }
+
+    Array<char, MaxLength> buf;
+    auto length = write(buf.data()) - buf.data();
+    if (length > last - first) {
+        return { last, std::errc::value_too_large };
+    }
+
+    std::memcpy(first, buf.data(), static_cast<UInt>(length));
+    return { first + length, std::errc{ } };
+}
+
+} // namespace violet::net::ip::detail
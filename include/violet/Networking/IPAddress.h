@@ -49,7 +49,13 @@ struct IPAddress final {
         V6
     };
 
-    static auto V4(ip::AddrV4 address) noexcept -> IPAddress
+    /// Outcome of parsing a single input with `ParseMany`.
+    enum struct ParseStatus : violet::UInt8 {
+        kOk = 0,
+        kInvalid = 1 ///< neither a valid IPv4 nor IPv6 address, i.e. `FromStr` returns a [`ParseIPAddressError`]
+    };
+
+    constexpr static auto V4(ip::AddrV4 address) noexcept -> IPAddress
     {
         IPAddress addr;
         addr.n_value = address;
@@ -57,7 +63,7 @@ struct IPAddress final {
         return addr;
     }
 
-    static auto V6(ip::AddrV6 address) noexcept -> IPAddress
+    constexpr static auto V6(ip::AddrV6 address) noexcept -> IPAddress
     {
         IPAddress addr;
         addr.n_value = address;
@@ -67,6 +73,37 @@ struct IPAddress final {
 
     static auto FromStr(Str input) noexcept -> Result<IPAddress, ParseIPAddressError>;
 
+    /// Parses an address of either family like `FromStr`, but returns **Nothing** instead of an error so
+    /// that it can be used in constant expressions; see `ip::AddrV4::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<IPAddress>
+    {
+        // an IPv6 address always has a `:` within its first 5 characters, an IPv4 one never has one
+        if (input.substr(0, 5).find(':') != Str::npos) {
+            if (auto v6 = ip::AddrV6::Parse(input)) {
+                return IPAddress::V6(v6.Unwrap());
+            }
+
+            return Nothing;
+        }
+
+        if (auto v4 = ip::AddrV4::Parse(input)) {
+            return IPAddress::V4(v4.Unwrap());
+        }
+
+        return Nothing;
+    }
+
+    /// Parses every string in `inputs`, which may mix both families, writing the address for `inputs[i]`
+    /// to `out[i]` and its outcome to `status[i]`. Inputs that fail to parse are written as `0.0.0.0`.
+    ///
+    /// Inputs are sorted by family in blocks and handed to `ip::AddrV4::ParseMany` and
+    /// `ip::AddrV6::ParseMany`, so each block is parsed without switching between the two parsers.
+    ///
+    /// `out` and `status` must be at least as large as `inputs`.
+    ///
+    /// @returns the number of inputs that were parsed successfully.
+    static auto ParseMany(Span<const Str> inputs, Span<IPAddress> out, Span<ParseStatus> status) noexcept -> UInt;
+
     [[nodiscard]] constexpr auto TypeOf() const noexcept -> Type
     {
         return this->n_value.Holds<ip::AddrV4>() ? Type::V4 : Type::V6;
@@ -120,6 +157,27 @@ struct IPAddress final {
         return !(self == other);
     }
 
+    /// Returns the [`ip::FixedHash`] of the address that this holds.
+    friend constexpr auto FixedHash(const IPAddress& address, UInt64 seed = 0) noexcept -> UInt64
+    {
+        if (address.TypeOf() == Type::V4) {
+            return ip::FixedHash(address.AsV4Unchecked(Unsafe("checked the type")), seed);
+        }
+
+        return ip::FixedHash(address.AsV6Unchecked(Unsafe("checked the type")), seed);
+    }
+
+    /// Hashes the family along with the address, so that `0.0.0.1` and `::1` don't collide.
+    template<typename H>
+    friend auto AbslHashValue(H state, const IPAddress& address) -> H
+    {
+        if (address.TypeOf() == Type::V4) {
+            return H::combine(std::move(state), Type::V4, address.AsV4Unchecked(Unsafe("checked the type")));
+        }
+
+        return H::combine(std::move(state), Type::V6, address.AsV6Unchecked(Unsafe("checked the type")));
+    }
+
     friend auto operator<=>(const IPAddress& self, const IPAddress& other) noexcept -> std::strong_ordering
     {
         if (auto cmp = self.n_value.Index() <=> other.n_value.Index(); cmp != 0) {
@@ -133,7 +191,7 @@ struct IPAddress final {
     }
 
 private:
-    VIOLET_IMPLICIT IPAddress() noexcept = default;
+    constexpr VIOLET_IMPLICIT IPAddress() noexcept = default;
 
     using variant_type = violet::experimental::OneOf<ip::AddrV4, ip::AddrV6>;
 
@@ -143,6 +201,15 @@ private:
 } // namespace violet::net
 
 VIOLET_FORMATTER(violet::net::IPAddress);
+
+template<>
+struct std::hash<violet::net::IPAddress> final {
+    auto operator()(const violet::net::IPAddress& addr) const noexcept -> violet::UInt
+    {
+        return FixedHash(addr);
+    }
+};
+
 VIOLET_TO_STRING(violet::net::IPAddress::Type, typ, {
     using T = violet::net::IPAddress::Type;
     switch (typ) {
@@ -0,0 +1,209 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Container/Result.h>
+#include <violet/Experimental/OneOf.h>
+#include <violet/Networking/IP/NetworkV4.h>
+#include <violet/Networking/IP/NetworkV6.h>
+#include <violet/Networking/IPAddress.h>
+
+namespace violet::net {
+
+struct ParseIPNetworkError final {
+    constexpr VIOLET_IMPLICIT ParseIPNetworkError() noexcept = default;
+
+    [[nodiscard]] auto ToString() const noexcept -> CStr
+    {
+        return "invalid ip network";
+    }
+
+    friend auto operator<<(std::ostream& os, const ParseIPNetworkError& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+};
+
+/// An IPv4 or IPv6 network; the network counterpart of [`IPAddress`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IPNetwork.h>
+///
+/// using violet::net::IPAddress;
+/// using violet::net::IPNetwork;
+///
+/// constexpr auto network = IPNetwork::Parse("fe80::/10").Unwrap();
+/// static_assert(network.Contains(IPAddress::Parse("fe80::1").Unwrap()));
+/// static_assert(!network.Contains(IPAddress::Parse("10.0.0.1").Unwrap())); // different families
+/// ```
+struct IPNetwork final {
+    using Type = IPAddress::Type;
+
+    constexpr static auto V4(ip::NetworkV4 network) noexcept -> IPNetwork
+    {
+        IPNetwork net;
+        net.n_value = network;
+
+        return net;
+    }
+
+    constexpr static auto V6(ip::NetworkV6 network) noexcept -> IPNetwork
+    {
+        IPNetwork net;
+        net.n_value = network;
+
+        return net;
+    }
+
+    static auto FromStr(Str input) noexcept -> Result<IPNetwork, ParseIPNetworkError>;
+
+    /// Parses a network of either family like `FromStr`, but returns **Nothing** instead of an error so
+    /// that it can be used in constant expressions; see `ip::AddrV4::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<IPNetwork>
+    {
+        // see `IPAddress::Parse`
+        if (input.substr(0, 5).find(':') != Str::npos) {
+            if (auto v6 = ip::NetworkV6::Parse(input)) {
+                return IPNetwork::V6(v6.Unwrap());
+            }
+
+            return Nothing;
+        }
+
+        if (auto v4 = ip::NetworkV4::Parse(input)) {
+            return IPNetwork::V4(v4.Unwrap());
+        }
+
+        return Nothing;
+    }
+
+    [[nodiscard]] constexpr auto TypeOf() const noexcept -> Type
+    {
+        return this->n_value.Holds<ip::NetworkV4>() ? Type::V4 : Type::V6;
+    }
+
+    [[nodiscard]] constexpr auto AsV4() const noexcept -> Optional<std::reference_wrapper<const ip::NetworkV4>>
+    {
+        return this->n_value.Get<ip::NetworkV4>();
+    }
+
+    [[nodiscard]] constexpr auto AsV6() const noexcept -> Optional<std::reference_wrapper<const ip::NetworkV6>>
+    {
+        return this->n_value.Get<ip::NetworkV6>();
+    }
+
+    /// Returns the network address, i.e. the first address in the network.
+    [[nodiscard]] constexpr auto Address() const noexcept -> IPAddress
+    {
+        if (auto v4 = this->AsV4()) {
+            return IPAddress::V4(v4->Address());
+        }
+
+        return IPAddress::V6(this->AsV6()->Address());
+    }
+
+    [[nodiscard]] constexpr auto PrefixLength() const noexcept -> UInt8
+    {
+        return this->n_value.Visit([](const auto& network) -> UInt8 { return network.PrefixLength(); });
+    }
+
+    /// Returns **true** if `address` is in this network; an address is never in a network of the other
+    /// family (an IPv4-mapped IPv6 address isn't in any IPv4 network either).
+    [[nodiscard]] constexpr auto Contains(const IPAddress& address) const noexcept -> bool
+    {
+        if (auto v4 = this->AsV4()) {
+            auto addr = address.AsV4();
+            return addr && v4->Contains(addr.Unwrap());
+        }
+
+        auto addr = address.AsV6();
+        return addr && this->AsV6()->Contains(addr.Unwrap());
+    }
+
+    /// Returns **true** if every address of `other` is in this network; networks of different families
+    /// never contain each other.
+    [[nodiscard]] constexpr auto Contains(const IPNetwork& other) const noexcept -> bool
+    {
+        if (auto v4 = this->AsV4()) {
+            auto net = other.AsV4();
+            return net && v4->Contains(net.Unwrap());
+        }
+
+        auto net = other.AsV6();
+        return net && this->AsV6()->Contains(net.Unwrap());
+    }
+
+    /// Returns **true** if this network and `other` have any address in common; networks of different
+    /// families never overlap.
+    [[nodiscard]] constexpr auto Overlaps(const IPNetwork& other) const noexcept -> bool
+    {
+        if (auto v4 = this->AsV4()) {
+            auto net = other.AsV4();
+            return net && v4->Overlaps(net.Unwrap());
+        }
+
+        auto net = other.AsV6();
+        return net && this->AsV6()->Overlaps(net.Unwrap());
+    }
+
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const IPNetwork& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    friend auto operator==(const IPNetwork& self, const IPNetwork& other) noexcept -> bool
+    {
+        return self.n_value == other.n_value;
+    }
+
+    friend auto operator!=(const IPNetwork& self, const IPNetwork& other) noexcept -> bool
+    {
+        return !(self == other);
+    }
+
+    /// IPv4 networks sort before IPv6 ones, like in [`IPAddress`].
+    friend auto operator<=>(const IPNetwork& self, const IPNetwork& other) noexcept -> std::strong_ordering
+    {
+        if (auto cmp = self.n_value.Index() <=> other.n_value.Index(); cmp != 0) {
+            return cmp;
+        }
+
+        return self.n_value.Visit([&other](auto& value) -> std::strong_ordering {
+            using type = std::remove_cvref_t<decltype(value)>;
+            return value <=> other.n_value.template Get<type>().Unwrap();
+        });
+    }
+
+private:
+    constexpr VIOLET_IMPLICIT IPNetwork() noexcept = default;
+
+    using variant_type = violet::experimental::OneOf<ip::NetworkV4, ip::NetworkV6>;
+
+    variant_type n_value;
+};
+
+} // namespace violet::net
+
+VIOLET_FORMATTER(violet::net::IPNetwork);
@@ -0,0 +1,210 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/IP/IPSetV4.h>
+#include <violet/Networking/IP/IPSetV6.h>
+#include <violet/Networking/IPAddress.h>
+#include <violet/Networking/IPNetwork.h>
+
+#include <utility>
+
+namespace violet::net {
+
+/// An immutable set of IPv4 and IPv6 addresses; the set counterpart of [`IPAddress`], made of an
+/// [`ip::IPSetV4`] and an [`ip::IPSetV6`].
+///
+/// An address is never in the set through the other family: an IPv4-mapped IPv6 address isn't
+/// contained by adding its IPv4 address, like in [`IPNetwork`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/IPSet.h>
+///
+/// using violet::net::IPAddress;
+/// using violet::net::IPNetwork;
+/// using violet::net::IPSet;
+///
+/// IPSet blocked = IPSet::Builder()
+///     .Add(IPNetwork::Parse("10.0.0.0/8").Unwrap())
+///     .Add(IPNetwork::Parse("2001:db8::/32").Unwrap())
+///     .Build();
+///
+/// blocked.Contains(IPAddress::Parse("10.1.2.3").Unwrap()); // => true
+/// blocked.Contains(IPAddress::Parse("::ffff:10.1.2.3").Unwrap()); // => false
+/// ```
+struct IPSet final {
+    struct Builder;
+
+    /// Constructs an empty set.
+    IPSet() = default;
+
+    /// Constructs a set from the addresses of each family.
+    IPSet(ip::IPSetV4 v4, ip::IPSetV6 v6) noexcept
+        : n_v4(std::move(v4))
+        , n_v6(std::move(v6))
+    {
+    }
+
+    /// Returns the IPv4 addresses of the set.
+    [[nodiscard]] auto V4() const noexcept -> const ip::IPSetV4&
+    {
+        return this->n_v4;
+    }
+
+    /// Returns the IPv6 addresses of the set.
+    [[nodiscard]] auto V6() const noexcept -> const ip::IPSetV6&
+    {
+        return this->n_v6;
+    }
+
+    /// Returns **true** if `address` is in the set.
+    [[nodiscard]] auto Contains(const IPAddress& address) const noexcept -> bool
+    {
+        if (auto v4 = address.AsV4()) {
+            return this->n_v4.Contains(v4.Unwrap());
+        }
+
+        return this->n_v6.Contains(address.AsV6().Unwrap());
+    }
+
+    /// Returns **true** if every address of `network` is in the set.
+    [[nodiscard]] auto Contains(const IPNetwork& network) const noexcept -> bool
+    {
+        if (auto v4 = network.AsV4()) {
+            return this->n_v4.Contains(v4.Unwrap());
+        }
+
+        return this->n_v6.Contains(network.AsV6().Unwrap());
+    }
+
+    /// Returns the set of the addresses that are in this set or in `other`.
+    [[nodiscard]] auto Union(const IPSet& other) const -> IPSet
+    {
+        return { this->n_v4.Union(other.n_v4), this->n_v6.Union(other.n_v6) };
+    }
+
+    /// Returns the set of the addresses that are in both this set and `other`.
+    [[nodiscard]] auto Intersection(const IPSet& other) const -> IPSet
+    {
+        return { this->n_v4.Intersection(other.n_v4), this->n_v6.Intersection(other.n_v6) };
+    }
+
+    /// Returns the set of the addresses that are in this set but not in `other`.
+    [[nodiscard]] auto Difference(const IPSet& other) const -> IPSet
+    {
+        return { this->n_v4.Difference(other.n_v4), this->n_v6.Difference(other.n_v6) };
+    }
+
+    /// Returns the number of ranges of both families.
+    [[nodiscard]] auto Size() const noexcept -> UInt
+    {
+        return this->n_v4.Size() + this->n_v6.Size();
+    }
+
+    /// Returns **true** if the set has no addresses.
+    [[nodiscard]] auto Empty() const noexcept -> bool
+    {
+        return this->n_v4.Empty() && this->n_v6.Empty();
+    }
+
+    /// Returns the number of bytes used by the ranges of both families.
+    [[nodiscard]] auto MemoryUsage() const noexcept -> UInt
+    {
+        return this->n_v4.MemoryUsage() + this->n_v6.MemoryUsage();
+    }
+
+    friend auto operator==(const IPSet& lhs, const IPSet& rhs) noexcept -> bool
+    {
+        return lhs.n_v4 == rhs.n_v4 && lhs.n_v6 == rhs.n_v6;
+    }
+
+private:
+    ip::IPSetV4 n_v4;
+    ip::IPSetV6 n_v6;
+};
+
+/// Collects addresses and networks of either family in any order, and builds the [`IPSet`] of all of
+/// them.
+struct IPSet::Builder final {
+    /// Constructs an empty builder.
+    Builder() = default;
+
+    /// Adds a single address.
+    auto Add(const IPAddress& address) -> Builder&
+    {
+        if (auto v4 = address.AsV4()) {
+            this->n_v4.Add(v4.Unwrap());
+        } else {
+            this->n_v6.Add(address.AsV6().Unwrap());
+        }
+
+        return *this;
+    }
+
+    /// Adds every address of `network`.
+    auto Add(const IPNetwork& network) -> Builder&
+    {
+        if (auto v4 = network.AsV4()) {
+            this->n_v4.Add(v4.Unwrap());
+        } else {
+            this->n_v6.Add(network.AsV6().Unwrap());
+        }
+
+        return *this;
+    }
+
+    /// Adds the IPv4 addresses from `first` to `last`, inclusive.
+    auto Add(ip::AddrV4 first, ip::AddrV4 last) -> Builder&
+    {
+        this->n_v4.Add(first, last);
+        return *this;
+    }
+
+    /// Adds the IPv6 addresses from `first` to `last`, inclusive.
+    auto Add(const ip::AddrV6& first, const ip::AddrV6& last) -> Builder&
+    {
+        this->n_v6.Add(first, last);
+        return *this;
+    }
+
+    /// Adds every address of `set`.
+    auto Add(const IPSet& set) -> Builder&
+    {
+        this->n_v4.Add(set.n_v4);
+        this->n_v6.Add(set.n_v6);
+
+        return *this;
+    }
+
+    /// Builds the set of everything that was added so far; the builder can be reused afterwards.
+    [[nodiscard]] auto Build() -> IPSet
+    {
+        return { this->n_v4.Build(), this->n_v6.Build() };
+    }
+
+private:
+    ip::IPSetV4::Builder n_v4;
+    ip::IPSetV6::Builder n_v6;
+};
+
+} // namespace violet::net
@@ -0,0 +1,35 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+/// Out-of-line definitions of the address types live in `-inl.h` headers next to their declarations
+/// (e.g. `IP/AddrV4-inl.h`), which are normally compiled once into the library. The header-only
+/// targets (`//net/ip:addr_v4_inline`, ...) define `VIOLET_NET_HEADER_ONLY` instead, which makes
+/// every public header pull in its `-inl.h` and marks those definitions `inline` so that they can be
+/// inlined into the caller.
+///
+/// A binary has to use either the compiled or the header-only targets for a given type, not both.
+#if defined(VIOLET_NET_HEADER_ONLY) && VIOLET_NET_HEADER_ONLY
+    #define VIOLET_NET_INLINE inline
+#else
+    #define VIOLET_NET_INLINE
+#endif
@@ -0,0 +1,82 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/Inline.h>
+#include <violet/Networking/Socket/AddrV4.h>
+
+#include <limits>
+
+namespace violet::net::socket {
+
+VIOLET_NET_INLINE auto AddrV4::FromStr(Str input) noexcept -> Result<AddrV4, ParseV4Error>
+{
+    const auto colon = input.find(':');
+    const Str host = input.substr(0, colon);
+
+    // the common case is parsed straight into an integer: going through `ip::AddrV4::FromStr` would
+    // return its `Result` in a register that has to be taken apart again
+    UInt32 address = 0;
+    if (!ip::detail::ParseDottedQuadFast(host, address)) {
+        auto parsed = ip::AddrV4::FromStr(host);
+        if (parsed.Err()) {
+            return Err(ParseV4Error::invalidAddress(parsed.Error()));
+        }
+
+        address = parsed.Value().AsUInt32();
+    }
+
+    if (colon == Str::npos) {
+        return AddrV4{ ip::AddrV4::FromUInt32(address), static_cast<UInt16>(0) };
+    }
+
+    UInt64 port = 0;
+    if (auto ec = ip::detail::ParseDecimal(input.substr(colon + 1), std::numeric_limits<UInt16>::max(), port);
+        ec != std::errc{ }) {
+        return Err(ParseV4Error::invalidPort(ec, colon + 1));
+    }
+
+    return AddrV4{ ip::AddrV4::FromUInt32(address), static_cast<UInt16>(port) };
+}
+
+VIOLET_NET_INLINE auto AddrV4::ToString() const noexcept -> String
+{
+    return std::format("{}:{}", this->Address, this->Port);
+}
+
+VIOLET_NET_INLINE auto ParseV4Error::ToString() const noexcept -> String
+{
+    switch (this->Kind()) {
+    case ErrorKind::kInvalidAddress:
+        return this->Address()->ToString();
+
+    case ErrorKind::kInvalidPort:
+        return std::make_error_code(std::errc::invalid_argument).message();
+
+    case ErrorKind::kPortOutOfRange:
+        return std::make_error_code(std::errc::result_out_of_range).message();
+    }
+
+    VIOLET_UNREACHABLE();
+}
+
+} // namespace violet::net::socket
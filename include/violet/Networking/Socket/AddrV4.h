@@ -24,9 +24,14 @@
 #include <functional> // IWYU pragma: export -- TODO(@auguwu/Noel): Add this header in `Result.h`
 
 #include <violet/Container/Result.h>
-#include <violet/Experimental/OneOf.h>
 #include <violet/Networking/IP/AddrV4.h>
 
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <bit>
+#include <cstring>
+
 namespace violet::net::socket {
 
 struct ParseV4Error;
@@ -54,23 +59,70 @@ struct AddrV4 final {
 
     static auto FromStr(Str input) noexcept -> Result<AddrV4, ParseV4Error>;
 
+    /// Parses a socket address like `FromStr`, but returns **Nothing** instead of an error so that it can
+    /// be used in constant expressions; see `ip::AddrV4::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<AddrV4>;
+
+    /// Reads the `sockaddr_in` at `address`, such as one filled in by `accept` or `recvfrom`; the address
+    /// and the port are copied as they are, since both are in network order already.
+    ///
+    /// @returns **Nothing** if `address` isn't an IPv4 address, or `length` is too short for one
+    static auto FromSockAddr(const sockaddr* address, socklen_t length) noexcept -> Optional<AddrV4>
+    {
+        if (address == nullptr || length < SockAddrLen() || address->sa_family != AF_INET) {
+            return Nothing;
+        }
+
+        sockaddr_in in; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        std::memcpy(&in, address, sizeof(in));
+
+        const auto octets = std::bit_cast<Array<UInt8, 4>>(in.sin_addr);
+        return AddrV4{ ip::AddrV4(octets[0], octets[1], octets[2], octets[3]), ntohs(in.sin_port) };
+    }
+
+    /// Writes this address to `out` as a `sockaddr_in`.
+    /// @returns the length to pass along with `out`, which is `SockAddrLen()`
+    auto ToSockAddr(sockaddr_in& out) const noexcept -> socklen_t
+    {
+        out = sockaddr_in{ };
+        out.sin_family = AF_INET;
+        out.sin_port = htons(this->Port);
+        out.sin_addr = std::bit_cast<in_addr>(this->Address.Octets());
+
+        return SockAddrLen();
+    }
+
+    /// Writes this address to the start of `out` as a `sockaddr_in`; the rest of `out` is left as it is.
+    /// @returns the length to pass along with `out`, which is `SockAddrLen()`
+    auto ToSockAddr(sockaddr_storage& out) const noexcept -> socklen_t
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): what `sockaddr_storage` is for
+        return this->ToSockAddr(reinterpret_cast<sockaddr_in&>(out));
+    }
+
+    /// Returns the size of the `sockaddr_in` that an IPv4 socket address is passed to the kernel as.
+    constexpr static auto SockAddrLen() noexcept -> socklen_t
+    {
+        return sizeof(sockaddr_in);
+    }
+
     [[nodiscard]] auto ToString() const noexcept -> String;
     friend auto operator<<(std::ostream& os, const AddrV4& self) noexcept -> std::ostream&
     {
         return os << self.ToString();
     }
 
-    friend auto operator==(const AddrV4& lhs, const AddrV4& rhs) noexcept -> bool
+    constexpr friend auto operator==(const AddrV4& lhs, const AddrV4& rhs) noexcept -> bool
     {
         return lhs.Address == rhs.Address && lhs.Port == rhs.Port;
     }
 
-    friend auto operator!=(const AddrV4& lhs, const AddrV4& rhs) noexcept -> bool
+    constexpr friend auto operator!=(const AddrV4& lhs, const AddrV4& rhs) noexcept -> bool
     {
         return !(lhs == rhs);
     }
 
-    friend auto operator<=>(const AddrV4& lhs, const AddrV4& rhs) noexcept -> std::strong_ordering
+    constexpr friend auto operator<=>(const AddrV4& lhs, const AddrV4& rhs) noexcept -> std::strong_ordering
     {
         if (auto cmp = lhs.Address <=> rhs.Address; cmp != 0) {
             return cmp;
@@ -78,9 +130,54 @@ struct AddrV4 final {
 
         return lhs.Port <=> rhs.Port;
     }
+
+    template<typename H>
+    friend auto AbslHashValue(H state, const AddrV4& addr) -> H
+    {
+        return H::combine(std::move(state), addr.Address, addr.Port);
+    }
 };
 
-struct ParseV4Error final {
+/// Returns the 64-bit hash of `address` that never changes, like [`ip::FixedHash`]; the port is mixed in
+/// through the seed.
+constexpr auto FixedHash(AddrV4 address, UInt64 seed = 0) noexcept -> UInt64
+{
+    return ip::FixedHash(address.Address, seed + address.Port);
+}
+
+/// Represents an error returned when parsing an invalid IPv4 socket address. Like
+/// [`ip::InvalidV4AddressError`], it only records what went wrong and where; the message is built by
+/// `ToString`.
+struct ParseV4Error final: ip::detail::returned_in_memory_t {
+    enum struct ErrorKind : UInt8 {
+        kInvalidAddress = 0, ///< the address part was rejected, see `Address()`
+        kInvalidPort = 1, ///< the port is empty or isn't a number
+        kPortOutOfRange = 2 ///< the port is larger than `65535`
+    };
+
+    /// Returns why the input was rejected.
+    [[nodiscard]] constexpr auto Kind() const noexcept -> ErrorKind
+    {
+        return static_cast<ErrorKind>(this->n_bits & 0xFF);
+    }
+
+    /// Returns the byte offset into the input where parsing failed.
+    [[nodiscard]] constexpr auto Offset() const noexcept -> UInt
+    {
+        return this->n_bits >> 16;
+    }
+
+    /// Returns the error for the address part, if that is what was rejected.
+    [[nodiscard]] constexpr auto Address() const noexcept -> Optional<ip::InvalidV4AddressError>
+    {
+        if (this->Kind() != ErrorKind::kInvalidAddress) {
+            return Nothing;
+        }
+
+        return Some<ip::InvalidV4AddressError>(
+            static_cast<ip::AddrV4::ParseStatus>((this->n_bits >> 8) & 0xFF), this->Offset());
+    }
+
     [[nodiscard]] auto ToString() const noexcept -> String;
     friend auto operator<<(std::ostream& os, const ParseV4Error& self) noexcept -> std::ostream&
     {
@@ -90,40 +187,65 @@ struct ParseV4Error final {
 private:
     friend auto AddrV4::FromStr(Str) noexcept -> Result<AddrV4, ParseV4Error>;
 
-    VIOLET_IMPLICIT ParseV4Error() noexcept = default;
-
-    struct invalid_integral_t final {
-        std::errc Code;
-
-        [[nodiscard]] auto ToString() const noexcept -> String
-        {
-            auto code = std::make_error_code(this->Code);
-            return code.message();
-        }
-    };
-
-    static auto invalidIntegral(std::errc code) noexcept -> ParseV4Error
+    constexpr ParseV4Error(ErrorKind kind, ip::AddrV4::ParseStatus addressKind, UInt offset) noexcept
+        : n_bits(static_cast<UInt32>(kind) | (static_cast<UInt32>(addressKind) << 8)
+              | (static_cast<UInt32>(std::min<UInt>(offset, std::numeric_limits<UInt16>::max())) << 16))
     {
-        ParseV4Error error;
-        error.n_value = invalid_integral_t{ .Code = code };
+    }
 
-        return error;
+    static auto invalidPort(std::errc code, UInt offset) noexcept -> ParseV4Error
+    {
+        return { code == std::errc::result_out_of_range ? ErrorKind::kPortOutOfRange : ErrorKind::kInvalidPort,
+            ip::AddrV4::ParseStatus::kOk, offset };
     }
 
-    static auto invalidAddress(ip::InvalidV4AddressError&& error) noexcept -> ParseV4Error
+    static auto invalidAddress(const ip::InvalidV4AddressError& error) noexcept -> ParseV4Error
     {
-        ParseV4Error err;
-        err.n_value = VIOLET_MOVE(error);
+        return { ErrorKind::kInvalidAddress, error.Kind(), error.Offset() };
+    }
+
+    // the kind in the low byte, then the address' `ParseStatus` and the offset in the upper 16 bits; see
+    // `ip::InvalidV4AddressError::n_bits` for why it's a single word
+    UInt32 n_bits;
+};
+
+static_assert(sizeof(ParseV4Error) == 4);
+static_assert(!std::is_trivially_copyable_v<ParseV4Error>, "see `ip::detail::returned_in_memory_t`");
 
-        return err;
+constexpr auto AddrV4::Parse(Str input) noexcept -> Optional<AddrV4>
+{
+    const auto colon = input.find(':');
+
+    auto address = ip::AddrV4::Parse(input.substr(0, colon));
+    if (!address) {
+        return Nothing;
     }
 
-    using variant_type = violet::experimental::OneOf<invalid_integral_t, ip::InvalidV4AddressError>;
+    if (colon == Str::npos) {
+        return AddrV4{ address.Unwrap(), 0 };
+    }
 
-    variant_type n_value;
-};
+    UInt64 port = 0;
+    if (ip::detail::ParseDecimal(input.substr(colon + 1), std::numeric_limits<UInt16>::max(), port) != std::errc{ }) {
+        return Nothing;
+    }
+
+    return AddrV4{ address.Unwrap(), static_cast<UInt16>(port) };
+}
 
 } // namespace violet::net::socket
 
 VIOLET_FORMATTER(violet::net::socket::AddrV4);
 VIOLET_FORMATTER(violet::net::socket::ParseV4Error);
+
+template<>
+struct std::hash<violet::net::socket::AddrV4> final {
+    auto operator()(const violet::net::socket::AddrV4& addr) const noexcept -> violet::UInt
+    {
+        return FixedHash(addr);
+    }
+};
+
+#if defined(VIOLET_NET_HEADER_ONLY) && VIOLET_NET_HEADER_ONLY
+    #include <violet/Networking/Socket/AddrV4-inl.h> // IWYU pragma: export
+#endif
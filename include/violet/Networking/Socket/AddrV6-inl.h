@@ -0,0 +1,113 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/Inline.h>
+#include <violet/Networking/Socket/AddrV6.h>
+
+#include <limits>
+
+namespace violet::net::socket {
+
+VIOLET_NET_INLINE auto AddrV6::FromStr(Str input) noexcept -> Result<AddrV6, ParseV6Error>
+{
+    if (input.empty() || input.front() != '[') {
+        return Err(ParseV6Error::invalidBracketPlacement(0));
+    }
+
+    const auto closeBracket = input.find(']');
+    if (closeBracket == Str::npos) {
+        return Err(ParseV6Error::invalidBracketPlacement(input.size()));
+    }
+
+    auto inside = input.substr(1, closeBracket - 1);
+    UInt64 scopeId = 0;
+    if (const auto percent = inside.find('%'); percent != Str::npos) {
+        if (ip::detail::ParseDecimal(inside.substr(percent + 1), std::numeric_limits<UInt32>::max(), scopeId)
+            != std::errc{ }) {
+            return Err(ParseV6Error::invalidScopeId(percent + 2));
+        }
+
+        inside = inside.substr(0, percent);
+    }
+
+    auto address = ip::AddrV6::FromStr(inside);
+    if (address.Err()) {
+        return Err(ParseV6Error::invalidAddress(address.Error(), 1));
+    }
+
+    const auto scope = static_cast<UInt32>(scopeId);
+
+    // `[::1]` and `[::1]:` both leave the port unset
+    if (closeBracket + 1 >= input.size()) {
+        return AddrV6{ address.Value(), 0, 0, scope };
+    }
+
+    if (input[closeBracket + 1] != ':') {
+        return Err(ParseV6Error::invalidBracketPlacement(closeBracket + 1));
+    }
+
+    auto port = input.substr(closeBracket + 2);
+    if (port.empty()) {
+        return AddrV6{ address.Value(), 0, 0, scope };
+    }
+
+    UInt64 thePort = 0;
+    if (auto ec = ip::detail::ParseDecimal(port, std::numeric_limits<UInt16>::max(), thePort); ec != std::errc{ }) {
+        return Err(ParseV6Error::invalidPort(ec, closeBracket + 2));
+    }
+
+    return AddrV6{ address.Value(), static_cast<UInt16>(thePort), 0, scope };
+}
+
+VIOLET_NET_INLINE auto AddrV6::ToString() const noexcept -> String
+{
+    if (this->ScopeId != 0) {
+        return std::format("[{}%{}]:{}", this->Address, this->ScopeId, this->Port);
+    }
+
+    return std::format("[{}]:{}", this->Address, this->Port);
+}
+
+VIOLET_NET_INLINE auto ParseV6Error::ToString() const noexcept -> String
+{
+    switch (this->Kind()) {
+    case ErrorKind::kInvalidAddress:
+        return this->Address()->ToString();
+
+    case ErrorKind::kInvalidPort:
+        return std::make_error_code(std::errc::invalid_argument).message();
+
+    case ErrorKind::kPortOutOfRange:
+        return std::make_error_code(std::errc::result_out_of_range).message();
+
+    case ErrorKind::kInvalidBracketPlacement:
+        return "invalid bracket placement";
+
+    case ErrorKind::kInvalidScopeId:
+        return "invalid scope id";
+    }
+
+    VIOLET_UNREACHABLE();
+}
+
+} // namespace violet::net::socket
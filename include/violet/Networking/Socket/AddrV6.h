@@ -21,9 +21,14 @@
 
 #pragma once
 
-#include <violet/Experimental/OneOf.h>
 #include <violet/Networking/IP/AddrV6.h>
 
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <bit>
+#include <cstring>
+
 namespace violet::net::socket {
 
 struct ParseV6Error;
@@ -32,6 +37,14 @@ struct AddrV6 final {
     ip::AddrV6 Address;
     UInt16 Port = 0;
 
+    /// The flow information of `sin6_flowinfo` in host order, of which the low 20 bits are the flow label.
+    /// It's carried along for `ToSockAddr`, but isn't part of the address: a peer can change its flow label
+    /// during a connection, so two addresses that only differ in it are equal and hash the same.
+    UInt32 FlowInfo = 0;
+
+    /// The interface that a link-local `Address` is on, or `0` if it isn't scoped.
+    UInt32 ScopeId = 0;
+
     constexpr VIOLET_IMPLICIT AddrV6() noexcept = default;
     constexpr VIOLET_IMPLICIT AddrV6(ip::AddrV6 address, UInt16 port) noexcept
         : Address(address)
@@ -39,6 +52,14 @@ struct AddrV6 final {
     {
     }
 
+    constexpr VIOLET_IMPLICIT AddrV6(ip::AddrV6 address, UInt16 port, UInt32 flowInfo, UInt32 scopeId) noexcept
+        : Address(address)
+        , Port(port)
+        , FlowInfo(flowInfo)
+        , ScopeId(scopeId)
+    {
+    }
+
     constexpr void SetAddress(ip::AddrV6 address) noexcept
     {
         this->Address = address;
@@ -49,35 +70,151 @@ struct AddrV6 final {
         this->Port = port;
     }
 
+    constexpr void SetFlowInfo(UInt32 flowInfo) noexcept
+    {
+        this->FlowInfo = flowInfo;
+    }
+
+    constexpr void SetScopeId(UInt32 scopeId) noexcept
+    {
+        this->ScopeId = scopeId;
+    }
+
+    /// Parses a socket address of the form `[address]:port`, where the port can be left out and the
+    /// address can be followed by a numeric scope id, like `[fe80::1%2]:80`.
     static auto FromStr(Str input) noexcept -> Result<AddrV6, ParseV6Error>;
 
+    /// Parses a socket address like `FromStr`, but returns **Nothing** instead of an error so that it can
+    /// be used in constant expressions; see `ip::AddrV4::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<AddrV6>;
+
+    /// Reads the `sockaddr_in6` at `address`, such as one filled in by `accept` or `recvfrom`. The
+    /// address bytes are copied as they are, the port and flow information are converted to host order,
+    /// and the scope id, which the kernel keeps in host order, is copied as it is.
+    ///
+    /// @returns **Nothing** if `address` isn't an IPv6 address, or `length` is too short for one
+    static auto FromSockAddr(const sockaddr* address, socklen_t length) noexcept -> Optional<AddrV6>
+    {
+        if (address == nullptr || length < SockAddrLen() || address->sa_family != AF_INET6) {
+            return Nothing;
+        }
+
+        sockaddr_in6 in6; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        std::memcpy(&in6, address, sizeof(in6));
+
+        return AddrV6{ ip::AddrV6(std::bit_cast<Array<UInt8, 16>>(in6.sin6_addr)), ntohs(in6.sin6_port),
+            ntohl(in6.sin6_flowinfo), in6.sin6_scope_id };
+    }
+
+    /// Writes this address to `out` as a `sockaddr_in6`.
+    /// @returns the length to pass along with `out`, which is `SockAddrLen()`
+    auto ToSockAddr(sockaddr_in6& out) const noexcept -> socklen_t
+    {
+        out = sockaddr_in6{ };
+        out.sin6_family = AF_INET6;
+        out.sin6_port = htons(this->Port);
+        out.sin6_flowinfo = htonl(this->FlowInfo);
+        out.sin6_addr = std::bit_cast<in6_addr>(this->Address.Hextets());
+        out.sin6_scope_id = this->ScopeId;
+
+        return SockAddrLen();
+    }
+
+    /// Writes this address to the start of `out` as a `sockaddr_in6`; the rest of `out` is left as it is.
+    /// @returns the length to pass along with `out`, which is `SockAddrLen()`
+    auto ToSockAddr(sockaddr_storage& out) const noexcept -> socklen_t
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): what `sockaddr_storage` is for
+        return this->ToSockAddr(reinterpret_cast<sockaddr_in6&>(out));
+    }
+
+    /// Returns the size of the `sockaddr_in6` that an IPv6 socket address is passed to the kernel as.
+    constexpr static auto SockAddrLen() noexcept -> socklen_t
+    {
+        return sizeof(sockaddr_in6);
+    }
+
+    /// Formats this address as `[address]:port`, or `[address%scope]:port` if it has a scope id; the flow
+    /// information isn't part of the text form.
     [[nodiscard]] auto ToString() const noexcept -> String;
     friend auto operator<<(std::ostream& os, const AddrV6& self) noexcept -> std::ostream&
     {
         return os << self.ToString();
     }
 
-    friend auto operator==(const AddrV6& lhs, const AddrV6& rhs) noexcept -> bool
+    constexpr friend auto operator==(const AddrV6& lhs, const AddrV6& rhs) noexcept -> bool
     {
-        return lhs.Address == rhs.Address && lhs.Port == rhs.Port;
+        return lhs.Address == rhs.Address && lhs.Port == rhs.Port && lhs.ScopeId == rhs.ScopeId;
     }
 
-    friend auto operator!=(const AddrV6& lhs, const AddrV6& rhs) noexcept -> bool
+    constexpr friend auto operator!=(const AddrV6& lhs, const AddrV6& rhs) noexcept -> bool
     {
         return !(lhs == rhs);
     }
 
-    friend auto operator<=>(const AddrV6& lhs, const AddrV6& rhs) noexcept -> std::strong_ordering
+    constexpr friend auto operator<=>(const AddrV6& lhs, const AddrV6& rhs) noexcept -> std::strong_ordering
     {
         if (auto cmp = lhs.Address <=> rhs.Address; cmp != 0) {
             return cmp;
         }
 
-        return lhs.Port <=> rhs.Port;
+        if (auto cmp = lhs.Port <=> rhs.Port; cmp != 0) {
+            return cmp;
+        }
+
+        return lhs.ScopeId <=> rhs.ScopeId;
+    }
+
+    template<typename H>
+    friend auto AbslHashValue(H state, const AddrV6& addr) -> H
+    {
+        return H::combine(std::move(state), addr.Address, addr.Port, addr.ScopeId);
     }
 };
 
-struct ParseV6Error final {
+/// Returns the 64-bit hash of `address` that never changes, like [`ip::FixedHash`]; the port and the scope
+/// id are mixed in through the seed, while the flow information is left out like it is from `==`.
+constexpr auto FixedHash(const AddrV6& address, UInt64 seed = 0) noexcept -> UInt64
+{
+    return ip::FixedHash(address.Address, seed + address.Port + (static_cast<UInt64>(address.ScopeId) << 16));
+}
+
+/// Represents an error returned when parsing an invalid IPv6 socket address. Like
+/// [`ip::InvalidV6AddressError`], it only records what went wrong and where; the message is built by
+/// `ToString`.
+struct ParseV6Error final: ip::detail::returned_in_memory_t {
+    enum struct ErrorKind : UInt8 {
+        kInvalidAddress = 0, ///< the address part was rejected, see `Address()`
+        kInvalidPort = 1, ///< the port isn't a number
+        kPortOutOfRange = 2, ///< the port is larger than `65535`
+        kInvalidBracketPlacement = 3, ///< the address isn't enclosed in `[...]`, or isn't followed by `:`
+        kInvalidScopeId = 4 ///< the text after `%` isn't a number that fits in 32 bits
+    };
+
+    /// Returns why the input was rejected.
+    [[nodiscard]] constexpr auto Kind() const noexcept -> ErrorKind
+    {
+        return static_cast<ErrorKind>(this->n_bits & 0xFF);
+    }
+
+    /// Returns the byte offset into the input where parsing failed.
+    [[nodiscard]] constexpr auto Offset() const noexcept -> UInt
+    {
+        return this->n_bits >> 16;
+    }
+
+    /// Returns the error for the address part, if that is what was rejected. Its offset is relative to
+    /// the whole input, not to the text between the brackets.
+    [[nodiscard]] constexpr auto Address() const noexcept -> Optional<ip::InvalidV6AddressError>
+    {
+        if (this->Kind() != ErrorKind::kInvalidAddress) {
+            return Nothing;
+        }
+
+        return Some<ip::InvalidV6AddressError>(
+            static_cast<ip::AddrV6::ParseStatus>((this->n_bits >> 8) & 0xFF), this->Offset());
+    }
+
     [[nodiscard]] auto ToString() const noexcept -> String;
     friend auto operator<<(std::ostream& os, const ParseV6Error& self) noexcept -> std::ostream&
     {
@@ -87,56 +224,92 @@ struct ParseV6Error final {
 private:
     friend auto AddrV6::FromStr(Str) noexcept -> Result<AddrV6, ParseV6Error>;
 
-    VIOLET_IMPLICIT ParseV6Error() noexcept = default;
+    constexpr ParseV6Error(ErrorKind kind, ip::AddrV6::ParseStatus addressKind, UInt offset) noexcept
+        : n_bits(static_cast<UInt32>(kind) | (static_cast<UInt32>(addressKind) << 8)
+              | (static_cast<UInt32>(std::min<UInt>(offset, std::numeric_limits<UInt16>::max())) << 16))
+    {
+    }
 
-    struct invalid_integral_t final {
-        std::errc Code;
+    static auto invalidPort(std::errc code, UInt offset) noexcept -> ParseV6Error
+    {
+        return { code == std::errc::result_out_of_range ? ErrorKind::kPortOutOfRange : ErrorKind::kInvalidPort,
+            ip::AddrV6::ParseStatus::kOk, offset };
+    }
 
-        [[nodiscard]] auto ToString() const noexcept -> String
-        {
-            auto code = std::make_error_code(this->Code);
-            return code.message();
-        }
-    };
+    /// `start` is where the address part begins in the input, i.e. just after the `[`.
+    static auto invalidAddress(const ip::InvalidV6AddressError& error, UInt start) noexcept -> ParseV6Error
+    {
+        return { ErrorKind::kInvalidAddress, error.Kind(), start + error.Offset() };
+    }
 
-    struct invalid_bracket_placement_t final {
-        [[nodiscard]] auto ToString() const noexcept -> CStr
-        {
-            return "invalid bracket placement";
-        }
-    };
+    static auto invalidBracketPlacement(UInt offset) noexcept -> ParseV6Error
+    {
+        return { ErrorKind::kInvalidBracketPlacement, ip::AddrV6::ParseStatus::kOk, offset };
+    }
 
-    static auto invalidIntegral(std::errc code) noexcept -> ParseV6Error
+    static auto invalidScopeId(UInt offset) noexcept -> ParseV6Error
     {
-        ParseV6Error error;
-        error.n_value = invalid_integral_t{ .Code = code };
+        return { ErrorKind::kInvalidScopeId, ip::AddrV6::ParseStatus::kOk, offset };
+    }
 
-        return error;
+    // same layout as `ParseV4Error::n_bits`
+    UInt32 n_bits;
+};
+
+static_assert(sizeof(ParseV6Error) == 4);
+static_assert(!std::is_trivially_copyable_v<ParseV6Error>, "see `ip::detail::returned_in_memory_t`");
+
+constexpr auto AddrV6::Parse(Str input) noexcept -> Optional<AddrV6>
+{
+    const auto closeBracket = input.find(']');
+    if (input.empty() || input.front() != '[' || closeBracket == Str::npos) {
+        return Nothing;
     }
 
-    static auto invalidAddress(ip::InvalidV6AddressError&& error) noexcept -> ParseV6Error
-    {
-        ParseV6Error err;
-        err.n_value = VIOLET_MOVE(error);
+    auto inside = input.substr(1, closeBracket - 1);
+    UInt64 scopeId = 0;
+    if (const auto percent = inside.find('%'); percent != Str::npos) {
+        if (ip::detail::ParseDecimal(inside.substr(percent + 1), std::numeric_limits<UInt32>::max(), scopeId)
+            != std::errc{ }) {
+            return Nothing;
+        }
 
-        return err;
+        inside = inside.substr(0, percent);
     }
 
-    static auto invalidBracketPlacement() -> ParseV6Error
-    {
-        ParseV6Error err;
-        err.n_value = invalid_bracket_placement_t{ };
+    auto address = ip::AddrV6::Parse(inside);
+    if (!address) {
+        return Nothing;
+    }
 
-        return err;
+    // `[::1]` and `[::1]:` both leave the port unset
+    auto rest = input.substr(closeBracket + 1);
+    if (rest.empty() || rest == ":") {
+        return AddrV6{ address.Unwrap(), 0, 0, static_cast<UInt32>(scopeId) };
     }
 
-    using variant_type
-        = violet::experimental::OneOf<invalid_integral_t, invalid_bracket_placement_t, ip::InvalidV6AddressError>;
+    UInt64 port = 0;
+    if (rest.front() != ':'
+        || ip::detail::ParseDecimal(rest.substr(1), std::numeric_limits<UInt16>::max(), port) != std::errc{ }) {
+        return Nothing;
+    }
 
-    variant_type n_value;
-};
+    return AddrV6{ address.Unwrap(), static_cast<UInt16>(port), 0, static_cast<UInt32>(scopeId) };
+}
 
 } // namespace violet::net::socket
 
 VIOLET_FORMATTER(violet::net::socket::AddrV6);
 VIOLET_FORMATTER(violet::net::socket::ParseV6Error);
+
+template<>
+struct std::hash<violet::net::socket::AddrV6> final {
+    auto operator()(const violet::net::socket::AddrV6& addr) const noexcept -> violet::UInt
+    {
+        return FixedHash(addr);
+    }
+};
+
+#if defined(VIOLET_NET_HEADER_ONLY) && VIOLET_NET_HEADER_ONLY
+    #include <violet/Networking/Socket/AddrV6-inl.h> // IWYU pragma: export
+#endif
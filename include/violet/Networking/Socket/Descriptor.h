@@ -0,0 +1,174 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Result.h>
+#include <violet/Networking/SocketAddress.h>
+
+#include <cerrno>
+#include <utility>
+
+namespace violet::net::socket {
+
+namespace detail {
+
+/// Returns what the system call `call` returns, calling it again while it's interrupted by a signal.
+template<typename Fn>
+auto RetryOnInterrupt(Fn call) noexcept
+{
+    for (;;) {
+        auto result = call();
+        if (result >= 0 || errno != EINTR) {
+            return result;
+        }
+    }
+}
+
+} // namespace detail
+
+/// Represents a system call on a socket that failed, as the `errno` that it set.
+struct VIOLET_API SocketError final {
+    /// Creates an error from the `errno` value `code`.
+    constexpr VIOLET_EXPLICIT SocketError(int code) noexcept
+        : n_errno(code)
+    {
+    }
+
+    /// Returns the error of the system call that just failed, i.e. the current `errno`.
+    static auto Last() noexcept -> SocketError;
+
+    /// Returns the `errno` value.
+    [[nodiscard]] constexpr auto Errno() const noexcept -> int
+    {
+        return this->n_errno;
+    }
+
+    /// Returns **true** if the call would have blocked on a non-blocking socket (`EAGAIN`), which means
+    /// "try again once the socket is ready" rather than a failure.
+    [[nodiscard]] auto WouldBlock() const noexcept -> bool;
+
+    /// Returns the description of the `errno` value, like `strerror`.
+    [[nodiscard]] auto ToString() const noexcept -> String;
+    friend auto operator<<(std::ostream& os, const SocketError& self) noexcept -> std::ostream&
+    {
+        return os << self.ToString();
+    }
+
+    constexpr auto operator==(const SocketError&) const noexcept -> bool = default;
+
+private:
+    int n_errno;
+};
+
+/// An owned socket file descriptor, which is closed when it's dropped. This is what the socket types,
+/// like [`UdpSocket`], are built on; it only does what every kind of socket does.
+///
+/// Every descriptor is opened with `FD_CLOEXEC` set.
+struct VIOLET_API Descriptor final {
+    /// Constructs a descriptor that owns nothing.
+    constexpr VIOLET_IMPLICIT Descriptor() noexcept = default;
+
+    /// Takes ownership of the file descriptor `fd`.
+    constexpr VIOLET_EXPLICIT Descriptor(int fd) noexcept
+        : n_fd(fd)
+    {
+    }
+
+    Descriptor(const Descriptor&) = delete;
+    auto operator=(const Descriptor&) -> Descriptor& = delete;
+
+    Descriptor(Descriptor&& other) noexcept
+        : n_fd(std::exchange(other.n_fd, -1))
+    {
+    }
+
+    auto operator=(Descriptor&& other) noexcept -> Descriptor&
+    {
+        if (this != &other) {
+            this->Close();
+            this->n_fd = std::exchange(other.n_fd, -1);
+        }
+
+        return *this;
+    }
+
+    ~Descriptor()
+    {
+        this->Close();
+    }
+
+    /// Opens a socket of `family` like `socket(2)`, where `type` is `SOCK_DGRAM`, `SOCK_STREAM`, etc.
+    static auto Open(SocketAddress::Type family, int type, int protocol = 0) noexcept
+        -> Result<Descriptor, SocketError>;
+
+    /// Returns the file descriptor, or `-1` if this owns none.
+    [[nodiscard]] constexpr auto Get() const noexcept -> int
+    {
+        return this->n_fd;
+    }
+
+    /// Returns **true** if this owns a file descriptor.
+    [[nodiscard]] constexpr auto Valid() const noexcept -> bool
+    {
+        return this->n_fd >= 0;
+    }
+
+    /// Gives up ownership of the file descriptor without closing it.
+    [[nodiscard]] constexpr auto Release() noexcept -> int
+    {
+        return std::exchange(this->n_fd, -1);
+    }
+
+    /// Closes the file descriptor now rather than when this is dropped. Closing is never retried, since
+    /// the descriptor is released even if `close` fails.
+    void Close() noexcept;
+
+    /// Binds the socket to `address`, like `bind(2)`.
+    auto Bind(const SocketAddress& address) const noexcept -> Result<void, SocketError>;
+
+    /// Connects the socket to `address`, like `connect(2)`. On a non-blocking stream socket this fails
+    /// with `EINPROGRESS` while the connection is being made.
+    auto Connect(const SocketAddress& address) const noexcept -> Result<void, SocketError>;
+
+    /// Returns the address that the socket is bound to, like `getsockname(2)`; this is how the port that
+    /// the kernel picked for port `0` is found.
+    [[nodiscard]] auto LocalAddress() const noexcept -> Result<SocketAddress, SocketError>;
+
+    /// Returns the address that the socket is connected to, like `getpeername(2)`.
+    [[nodiscard]] auto PeerAddress() const noexcept -> Result<SocketAddress, SocketError>;
+
+    /// Sets or clears `O_NONBLOCK`.
+    auto SetNonBlocking(bool enabled) const noexcept -> Result<void, SocketError>;
+
+    /// Sets the integer socket option `name` at `level`, like `setsockopt(2)`.
+    auto SetOption(int level, int name, int value) const noexcept -> Result<void, SocketError>;
+
+    /// Returns the integer socket option `name` at `level`, like `getsockopt(2)`.
+    [[nodiscard]] auto GetOption(int level, int name) const noexcept -> Result<int, SocketError>;
+
+private:
+    int n_fd = -1;
+};
+
+} // namespace violet::net::socket
+
+VIOLET_FORMATTER(violet::net::socket::SocketError);
@@ -0,0 +1,142 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Networking/Socket/Descriptor.h>
+
+#include <linux/io_uring.h>
+
+#include <atomic>
+#include <chrono>
+
+namespace violet::net::socket::detail {
+
+/// An io_uring instance driven through the raw system calls, without liburing: the submission and
+/// completion queues are mapped into memory once, and entries are written to and read from them
+/// directly. This is what [`Reactor`] is built on; it only knows about queues, not sockets.
+///
+/// The ring is set up with `IORING_SETUP_SINGLE_ISSUER` and `IORING_SETUP_DEFER_TASKRUN` when the
+/// kernel has them (6.1), so it must only be used from one thread, and completions are only posted
+/// while that thread is in `Enter`. That thread is the one that calls `Enter` first, which is when the
+/// ring is enabled and its own descriptor is registered (`IORING_REGISTER_RING_FDS`) so that `Enter`
+/// doesn't have to look it up every time; it can be created and filled in on another thread before.
+struct VIOLET_API IoUring final {
+    /// Sets up a ring whose submission queue has `entries` entries, rounded up to a power of two; the
+    /// completion queue is twice as large.
+    static auto Create(UInt32 entries) noexcept -> Result<IoUring, SocketError>;
+
+    IoUring(const IoUring&) = delete;
+    auto operator=(const IoUring&) -> IoUring& = delete;
+
+    IoUring(IoUring&& other) noexcept;
+    auto operator=(IoUring&& other) noexcept -> IoUring&;
+
+    ~IoUring();
+
+    /// Returns a zeroed submission queue entry to fill in, which is submitted by the next `Enter`, or
+    /// **nullptr** if the queue is full.
+    auto NextSqe() noexcept -> io_uring_sqe*
+    {
+        if (this->n_sqTail - std::atomic_ref(*this->n_sqHead).load(std::memory_order_acquire) >= this->n_sqEntries) {
+            return nullptr;
+        }
+
+        io_uring_sqe* sqe = &this->n_sqes[this->n_sqTail & this->n_sqMask];
+        *sqe = io_uring_sqe{ };
+        this->n_sqTail++;
+
+        return sqe;
+    }
+
+    /// Submits the entries that were filled in since the last call, and waits until at least `waitFor`
+    /// completions are ready or `timeout` has passed.
+    ///
+    /// @returns the number of entries submitted; a timeout is the error `ETIME`
+    auto Enter(UInt32 waitFor, Optional<std::chrono::nanoseconds> timeout = Nothing) noexcept
+        -> Result<UInt32, SocketError>;
+
+    /// Calls `fn` with every completion that is ready, then hands their slots back to the kernel.
+    /// @returns the number of completions
+    template<typename Fn>
+    auto Drain(Fn&& fn) -> UInt
+    {
+        unsigned head = *this->n_cqHead;
+        const unsigned tail = std::atomic_ref(*this->n_cqTail).load(std::memory_order_acquire);
+
+        UInt count = 0;
+        for (; head != tail; head++, count++) {
+            fn(static_cast<const io_uring_cqe&>(this->n_cqes[head & this->n_cqMask]));
+        }
+
+        std::atomic_ref(*this->n_cqHead).store(head, std::memory_order_release);
+        return count;
+    }
+
+    /// Calls `io_uring_register(2)` with `opcode`, such as to register files or buffers.
+    /// @returns what the system call returned
+    auto Register(unsigned opcode, void* arg, unsigned count) const noexcept -> Result<int, SocketError>;
+
+    /// Returns the number of entries that were filled in but not consumed by the kernel yet.
+    [[nodiscard]] auto Unsubmitted() const noexcept -> UInt32
+    {
+        return this->n_sqTail - std::atomic_ref(*this->n_sqHead).load(std::memory_order_acquire);
+    }
+
+    /// Returns the number of times that `Enter` made the `io_uring_enter` system call.
+    [[nodiscard]] auto Enters() const noexcept -> UInt64
+    {
+        return this->n_enters;
+    }
+
+private:
+    IoUring() = default;
+
+    auto enable() noexcept -> Result<void, SocketError>;
+    void unmap() noexcept;
+
+    int n_fd = -1;
+    int n_enterFd = -1; // the registered index of `n_fd`, or `n_fd`
+    unsigned n_enterFlags = 0;
+    bool n_disabled = false; // until the first `Enter`, with `IORING_SETUP_R_DISABLED`
+    UInt64 n_enters = 0;
+
+    void* n_sqRing = nullptr;
+    UInt n_sqRingSize = 0;
+    void* n_cqRing = nullptr; // the same as `n_sqRing` with `IORING_FEAT_SINGLE_MMAP`
+    UInt n_cqRingSize = 0;
+    io_uring_sqe* n_sqes = nullptr;
+    UInt n_sqesSize = 0;
+
+    unsigned* n_sqHead = nullptr;
+    unsigned* n_sqTailShared = nullptr;
+    unsigned n_sqTail = 0; // ahead of `*n_sqTailShared` by the entries that `Enter` hasn't published yet
+    unsigned n_sqMask = 0;
+    unsigned n_sqEntries = 0;
+
+    unsigned* n_cqHead = nullptr;
+    unsigned* n_cqTail = nullptr;
+    unsigned n_cqMask = 0;
+    io_uring_cqe* n_cqes = nullptr;
+};
+
+} // namespace violet::net::socket::detail
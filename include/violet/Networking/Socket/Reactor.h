@@ -0,0 +1,252 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/Socket/IoUring.h>
+#include <violet/Networking/Socket/TcpListener.h>
+
+#include <memory>
+#include <unordered_map>
+
+namespace violet::net::socket {
+
+/// Identifies a connection of a [`Reactor`]; it's the connection's index in the ring's table of
+/// registered files, and is reused once the connection is closed.
+using ConnectionId = UInt32;
+
+/// An event loop for TCP servers (and clients) on io_uring, which does the work of a server's sockets
+/// in the kernel with as few system calls as possible:
+///
+/// - A [`TcpListener`] is given to `Listen`, which arms one multishot accept: every connection that
+///   comes in afterwards is accepted without a system call, directly into the ring's table of
+///   registered files, so it never has a file descriptor at all. Since there's no descriptor to call
+///   `getpeername` on, and a multishot accept has nowhere to put each connection's address, the peer
+///   addresses of accepted connections are only known with [`Options::PeerAddresses`], which accepts
+///   one connection per entry instead; see `PeerAddress`.
+/// - Every connection has one multishot receive armed, which takes a buffer from a ring of provided
+///   buffers as data comes in, so that memory is only tied up by connections that have data.
+/// - Sends and receives refer to connections by their index in the registered file table, which
+///   saves looking up the file on every operation.
+///
+/// All the reactor's work is submitted and its completions reaped by one `io_uring_enter` per turn of
+/// the loop, however many connections are busy; [`Stats`] counts them. Everything happens on the thread
+/// that calls `Poll` or `Run`. A reactor can be created and given its listeners on one thread and then
+/// handed to another, but once it has been polled, the thread that polled it is the only one that may
+/// use it, since the ring only takes submissions from that thread from then on.
+///
+/// This needs Linux 6.0 or later, for multishot receives.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/Socket/Reactor.h>
+///
+/// using namespace violet::net;
+///
+/// struct Echo final: socket::Reactor::Handler {
+///     void OnData(socket::Reactor& reactor, socket::ConnectionId id, Span<const UInt8> data) override
+///     {
+///         reactor.Send(id, data);
+///     }
+/// };
+///
+/// Echo echo;
+/// auto reactor = socket::Reactor::Create(echo).Value();
+/// auto listener = socket::TcpListener::Bind(SocketAddress::FromStr("0.0.0.0:7").Value()).Value();
+///
+/// (void)reactor.Listen(listener);
+/// (void)reactor.Run();
+/// ```
+struct VIOLET_API Reactor final {
+    /// The sizes of the reactor's queues and tables.
+    struct Options final {
+        /// The size of the submission queue; the completion queue is twice as large.
+        UInt32 Entries = 256;
+
+        /// The size of the registered file table, which is the most connections that can be open.
+        UInt32 MaxConnections = 4096;
+
+        /// The number of receive buffers, a power of two up to 32768. When they're all in use, the
+        /// receives wait until the handlers return some.
+        UInt32 BufferCount = 1024;
+
+        /// The size of each receive buffer, which is the most data that `OnData` is called with.
+        UInt32 BufferSize = 4096;
+
+        /// Whether to keep the peer addresses of accepted connections for `PeerAddress`. A listener then
+        /// takes one submission queue entry per connection rather than a single multishot accept, and
+        /// accepts at most one connection per turn of the loop.
+        bool PeerAddresses = false;
+    };
+
+    /// What a reactor calls when something happens on a connection. The handlers run on the reactor's
+    /// thread and can call back into it, such as to `Send` or `Close`.
+    struct Handler {
+        Handler() = default;
+        Handler(const Handler&) = default;
+        Handler(Handler&&) = default;
+        auto operator=(const Handler&) -> Handler& = default;
+        auto operator=(Handler&&) -> Handler& = default;
+        virtual ~Handler() = default;
+
+        /// Called when a connection was accepted from a listener, or `Adopt`ed. Its peer's address is
+        /// `reactor.PeerAddress(id)`, which is **Nothing** for accepted connections unless the reactor was
+        /// created with [`Options::PeerAddresses`].
+        virtual void OnOpen(Reactor& reactor, ConnectionId id)
+        {
+            (void)reactor, (void)id;
+        }
+
+        /// Called with the data that arrived on a connection. `data` is a receive buffer, which goes
+        /// back to the kernel once this returns; `Send` copies it, so it can be sent back as is.
+        virtual void OnData(Reactor& reactor, ConnectionId id, Span<const UInt8> data) = 0;
+
+        /// Called once when a connection is closed, either by the peer (with no `error`), by `Close`,
+        /// or by an error. `id` can be reused for another connection after this.
+        virtual void OnClose(Reactor& reactor, ConnectionId id, Optional<SocketError> error)
+        {
+            (void)reactor, (void)id, (void)error;
+        }
+
+        /// Called when a listener stopped accepting connections because of `error`. A full file table isn't
+        /// an error, since the listener only waits for a connection to close then. After an error, the reactor
+        /// lets go of the listener; `Listen` has to be called again to accept from it.
+        virtual void OnAcceptError(Reactor& reactor, SocketError error)
+        {
+            (void)reactor, (void)error;
+        }
+    };
+
+    /// Counters of what the reactor did.
+    struct Stats final {
+        UInt64 Enters = 0; ///< `io_uring_enter` system calls
+        UInt64 Completions = 0; ///< completions reaped from the ring
+        UInt64 Accepted = 0; ///< connections accepted from listeners
+        UInt64 Received = 0; ///< receive completions with data
+    };
+
+    /// Sets up a reactor with the default [`Options`], which calls `handler`; `handler` has to outlive
+    /// the reactor.
+    static auto Create(Handler& handler) noexcept -> Result<Reactor, SocketError>;
+
+    /// Sets up a reactor with `options`.
+    static auto Create(Handler& handler, const Options& options) noexcept -> Result<Reactor, SocketError>;
+
+    Reactor(const Reactor&) = delete;
+    auto operator=(const Reactor&) -> Reactor& = delete;
+
+    Reactor(Reactor&&) noexcept;
+    auto operator=(Reactor&&) noexcept -> Reactor&;
+
+    ~Reactor();
+
+    /// Starts accepting the connections of `listener`. The reactor keeps its own descriptor of the
+    /// listening socket, so it accepts from it until it's dropped or `OnAcceptError` is called, even if
+    /// `listener` is closed before that.
+    auto Listen(const TcpListener& listener) noexcept -> Result<void, SocketError>;
+
+    /// Moves `stream` into the registered file table and drives it like an accepted connection, which
+    /// is how connections made with `TcpStream::Connect` are handled. `OnOpen` is called once it's in;
+    /// if the table is full, the stream is closed instead.
+    void Adopt(TcpStream stream) noexcept;
+
+    /// Sends `data` on connection `id`. The data is copied and sent in order with the other sends on the
+    /// connection, retrying the rest of partial sends. Does nothing if the connection is closing.
+    void Send(ConnectionId id, Span<const UInt8> data) noexcept;
+
+    /// Closes connection `id` once the data that was sent on it is out; `OnClose` is called then.
+    void Close(ConnectionId id) noexcept;
+
+    /// Submits the work that's queued, waits up to `timeout` for something to happen, and calls the
+    /// handlers for whatever did.
+    ///
+    /// @returns the number of completions that were handled, which is `0` if the time ran out
+    auto Poll(Optional<std::chrono::nanoseconds> timeout = Nothing) noexcept -> Result<UInt, SocketError>;
+
+    /// Calls `Poll` until a handler calls `Stop`.
+    auto Run() noexcept -> Result<void, SocketError>;
+
+    /// Makes `Run` return once the completions that it's handling are done.
+    void Stop() noexcept
+    {
+        this->n_stopped = true;
+    }
+
+    /// Returns the address of connection `id`'s peer, from `OnOpen` until the connection is closed.
+    /// @returns **Nothing** if `id` isn't open, or it was accepted without [`Options::PeerAddresses`]
+    [[nodiscard]] auto PeerAddress(ConnectionId id) const noexcept -> Optional<SocketAddress>;
+
+    /// Returns the number of connections that are open.
+    [[nodiscard]] auto Connections() const noexcept -> UInt
+    {
+        return this->n_open;
+    }
+
+    /// Returns what the reactor did so far.
+    [[nodiscard]] auto Statistics() const noexcept -> Stats
+    {
+        Stats stats = this->n_stats;
+        stats.Enters = this->n_ring.Enters();
+
+        return stats;
+    }
+
+private:
+    struct Slot;
+    struct Adoption;
+    struct Acceptor;
+
+    Reactor(Handler& handler, detail::IoUring ring, const Options& options) noexcept;
+
+    auto nextSqe() noexcept -> io_uring_sqe*;
+    void submitBacklog() noexcept;
+    void armAccept(int listener) noexcept;
+    void armRecv(ConnectionId id) noexcept;
+    void flushSend(ConnectionId id) noexcept;
+    void shutdown(ConnectionId id) noexcept;
+    void open(ConnectionId id, Optional<SocketAddress> peer) noexcept;
+    void finish(ConnectionId id, Optional<SocketError> error) noexcept;
+    void release(ConnectionId id) noexcept;
+    void recycle(UInt16 buffer) noexcept;
+    void publishBuffers() noexcept;
+    void dispatch(const io_uring_cqe& cqe) noexcept;
+    void teardown() noexcept;
+
+    Handler* n_handler;
+    detail::IoUring n_ring;
+    Options n_options;
+    Stats n_stats;
+    bool n_stopped = false;
+    UInt n_open = 0;
+
+    Vec<Slot> n_slots;
+    Vec<int> n_pausedListeners; // listeners whose accept stopped because the file table was full
+    std::unordered_map<UInt64, std::unique_ptr<Adoption>> n_adoptions;
+    UInt64 n_nextAdoption = 0;
+    std::unordered_map<int, std::unique_ptr<Acceptor>> n_listeners; // by the reactor's own descriptor
+    Vec<io_uring_sqe> n_backlog; // entries that didn't fit in the submission queue, in order
+
+    io_uring_buf* n_bufferRing = nullptr; // an `io_uring_buf_ring`
+    UInt8* n_buffers = nullptr;
+    UInt16 n_bufferTail = 0;
+};
+
+} // namespace violet::net::socket
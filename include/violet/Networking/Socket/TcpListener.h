@@ -0,0 +1,146 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/Socket/TcpStream.h>
+
+#include <limits>
+
+namespace violet::net::socket {
+
+/// A TCP socket that listens for connections on a [`SocketAddress`].
+///
+/// The listener is always non-blocking, since it's meant to be driven by an event loop: `Accept`
+/// fails with [`SocketError::WouldBlock`] when there's no connection waiting, and `AcceptAll` takes
+/// every connection that is waiting. The accepted streams are non-blocking and close-on-exec from the
+/// start (`accept4` with `SOCK_NONBLOCK | SOCK_CLOEXEC`), and their peers come back as
+/// [`SocketAddress`]es decoded straight from the kernel's `sockaddr`.
+///
+/// ## Sharding with `SO_REUSEPORT`
+/// With [`Options::ReusePort`], several listeners can be bound to the same address, such as one per
+/// core, each with its own event loop. On Linux, the kernel then spreads new connections over the
+/// listeners by the hash of their addresses, so the cores don't contend on one accept queue. Every
+/// listener has to be opened with the option, by the same user; connections that are still queued on
+/// a listener when it's closed are reset.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/Socket/TcpListener.h>
+/// #include <violet/Print.h>
+///
+/// using namespace violet::net;
+///
+/// socket::TcpListener::Options options;
+/// options.ReusePort = true;
+///
+/// auto listener = socket::TcpListener::Bind(SocketAddress::FromStr("0.0.0.0:8080").Value(), options).Value();
+///
+/// // once the listener is readable
+/// (void)listener.AcceptAll([](socket::TcpListener::Accepted&& accepted) {
+///     violet::Println("connection from {}", accepted.Peer);
+///     serve(std::move(accepted.Stream));
+/// });
+/// ```
+struct VIOLET_API TcpListener final {
+    /// How the listening socket is set up.
+    struct Options final {
+        /// Sets `SO_REUSEADDR`, so that the address can be bound again right after a previous listener
+        /// on it is closed, while its old connections are still in `TIME_WAIT`.
+        bool ReuseAddress = true;
+
+        /// Sets `SO_REUSEPORT`, so that several listeners can share the address; see above.
+        bool ReusePort = false;
+
+        /// The length of the queue of connections that have been made but not accepted yet, which the
+        /// kernel caps at `somaxconn`.
+        int Backlog = SOMAXCONN;
+    };
+
+    /// A connection that was accepted, along with the address of its peer.
+    struct Accepted final {
+        TcpStream Stream;
+        SocketAddress Peer;
+    };
+
+    /// Opens a listener on `address` with the default [`Options`]; port `0` lets the kernel pick one,
+    /// which `LocalAddress` returns.
+    static auto Bind(const SocketAddress& address) noexcept -> Result<TcpListener, SocketError>;
+
+    /// Opens a listener on `address` with `options`.
+    static auto Bind(const SocketAddress& address, const Options& options) noexcept
+        -> Result<TcpListener, SocketError>;
+
+    /// Accepts a connection. Connections that were reset before they could be accepted, or that failed with
+    /// a network error like `ENETUNREACH` on the way, are skipped.
+    /// @returns the connection, or [`SocketError::WouldBlock`] if there's none waiting
+    auto Accept() noexcept -> Result<Accepted, SocketError>;
+
+    /// Accepts every connection that is waiting, up to `limit`, passing each to `onAccept` as an
+    /// [`Accepted`]&&; this is what a listener does when an event loop reports it's readable. Running
+    /// out of waiting connections isn't an error.
+    ///
+    /// @returns the number of connections accepted, or the error that stopped it, like `EMFILE`; the
+    /// connections accepted before an error have been passed to `onAccept` all the same
+    template<typename Fn>
+    auto AcceptAll(Fn&& onAccept, UInt limit = std::numeric_limits<UInt>::max()) noexcept
+        -> Result<UInt, SocketError>
+    {
+        UInt accepted = 0;
+        while (accepted < limit) {
+            auto result = this->Accept();
+            if (result.Err()) {
+                if (result.Error().WouldBlock()) {
+                    break;
+                }
+
+                return Err(result.Error());
+            }
+
+            onAccept(std::move(result.Value()));
+            accepted++;
+        }
+
+        return accepted;
+    }
+
+    /// Returns the address that the listener is bound to.
+    [[nodiscard]] auto LocalAddress() const noexcept -> Result<SocketAddress, SocketError>
+    {
+        return this->n_fd.LocalAddress();
+    }
+
+    /// Returns the listener's descriptor, such as to register it with an event loop.
+    [[nodiscard]] auto AsDescriptor() const noexcept -> const Descriptor&
+    {
+        return this->n_fd;
+    }
+
+private:
+    VIOLET_EXPLICIT TcpListener(Descriptor fd) noexcept
+        : n_fd(std::move(fd))
+    {
+    }
+
+    Descriptor n_fd;
+};
+
+} // namespace violet::net::socket
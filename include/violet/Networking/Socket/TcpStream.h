@@ -0,0 +1,116 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/Socket/Descriptor.h>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+namespace violet::net::socket {
+
+/// A connected TCP socket, either made with `Connect` or accepted by a [`TcpListener`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/Socket/TcpStream.h>
+///
+/// using namespace violet::net;
+///
+/// auto stream = socket::TcpStream::Connect(SocketAddress::FromStr("127.0.0.1:6379").Value()).Value();
+/// (void)stream.SetNoDelay(true);
+///
+/// Str ping = "PING\r\n";
+/// (void)stream.Write({ reinterpret_cast<const UInt8*>(ping.data()), ping.size() });
+/// ```
+struct VIOLET_API TcpStream final {
+    /// Takes ownership of `fd`, which must be a connected TCP socket; this is how the streams accepted
+    /// outside of [`TcpListener`], like by an event loop, are wrapped.
+    VIOLET_EXPLICIT TcpStream(Descriptor fd) noexcept;
+
+    /// Connects to `address`, blocking until the connection is made or refused. The stream is left in
+    /// blocking mode.
+    static auto Connect(const SocketAddress& address) noexcept -> Result<TcpStream, SocketError>;
+
+    /// Reads up to `buffer.size()` bytes.
+    /// @returns the number of bytes read, or `0` if the peer has closed its side
+    auto Read(Span<UInt8> buffer) noexcept -> Result<UInt, SocketError>;
+
+    /// Writes up to `data.size()` bytes. A peer that has gone away fails the write with `EPIPE` rather
+    /// than raising `SIGPIPE`.
+    ///
+    /// @returns the number of bytes written, which can be less than asked
+    auto Write(Span<const UInt8> data) noexcept -> Result<UInt, SocketError>;
+
+    /// Shuts down reading, writing or both (`SHUT_RD`, `SHUT_WR`, `SHUT_RDWR`), like `shutdown(2)`;
+    /// shutting down writing sends a FIN while the stream can still be read.
+    auto Shutdown(int how) const noexcept -> Result<void, SocketError>;
+
+    /// Returns the address of the stream's side of the connection.
+    [[nodiscard]] auto LocalAddress() const noexcept -> Result<SocketAddress, SocketError>
+    {
+        return this->n_fd.LocalAddress();
+    }
+
+    /// Returns the address of the peer.
+    [[nodiscard]] auto PeerAddress() const noexcept -> Result<SocketAddress, SocketError>
+    {
+        return this->n_fd.PeerAddress();
+    }
+
+    /// Sets or clears `O_NONBLOCK`.
+    auto SetNonBlocking(bool enabled) const noexcept -> Result<void, SocketError>
+    {
+        return this->n_fd.SetNonBlocking(enabled);
+    }
+
+    /// Sets `TCP_NODELAY`, which sends small writes right away instead of waiting to coalesce them
+    /// (Nagle's algorithm); request/response protocols want it.
+    auto SetNoDelay(bool enabled) const noexcept -> Result<void, SocketError>
+    {
+        return this->n_fd.SetOption(IPPROTO_TCP, TCP_NODELAY, enabled ? 1 : 0);
+    }
+
+    /// Sets `SO_KEEPALIVE`, which probes idle connections so that a dead peer is eventually noticed.
+    auto SetKeepAlive(bool enabled) const noexcept -> Result<void, SocketError>
+    {
+        return this->n_fd.SetOption(SOL_SOCKET, SO_KEEPALIVE, enabled ? 1 : 0);
+    }
+
+    /// Returns the stream's descriptor, for options and system calls that this doesn't cover.
+    [[nodiscard]] auto AsDescriptor() const noexcept -> const Descriptor&
+    {
+        return this->n_fd;
+    }
+
+    /// Gives up ownership of the descriptor without closing it, such as to hand it to an event loop.
+    [[nodiscard]] auto IntoDescriptor() && noexcept -> Descriptor
+    {
+        return std::move(this->n_fd);
+    }
+
+private:
+    Descriptor n_fd;
+};
+
+} // namespace violet::net::socket
@@ -0,0 +1,221 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Networking/Socket/Descriptor.h>
+
+#include <algorithm>
+
+namespace violet::net::socket {
+
+/// A datagram received with `UdpSocket::RecvSegmented`, which can be several datagrams from the same
+/// peer that the kernel coalesced (UDP GRO). Every segment but the last is exactly [`SegmentSize`]
+/// bytes; the segments are views into the receive buffer, nothing is copied.
+struct SegmentedDatagram final {
+    /// The bytes of every segment, back to back.
+    Span<UInt8> Data;
+
+    /// The size of every segment but the last, which can be shorter. It's the size of `Data` if the
+    /// datagram wasn't coalesced.
+    UInt SegmentSize = 0;
+
+    /// Returns the number of segments.
+    [[nodiscard]] constexpr auto Count() const noexcept -> UInt
+    {
+        if (this->SegmentSize == 0 || this->Data.size() <= this->SegmentSize) {
+            return 1;
+        }
+
+        return (this->Data.size() + this->SegmentSize - 1) / this->SegmentSize;
+    }
+
+    /// Returns the `index`th segment.
+    [[nodiscard]] constexpr auto Segment(UInt index) const noexcept -> Span<UInt8>
+    {
+        VIOLET_DEBUG_ASSERT(index < this->Count(), "segment index out of range");
+        if (this->Count() == 1) {
+            return this->Data;
+        }
+
+        const UInt offset = index * this->SegmentSize;
+        return this->Data.subspan(offset, std::min(this->SegmentSize, this->Data.size() - offset));
+    }
+};
+
+/// A UDP socket whose peers are [`SocketAddress`]es.
+///
+/// Besides the usual one-datagram calls, `RecvMany` and `SendMany` move up to [`kMaxBatch`] datagrams
+/// per system call through `recvmmsg(2)` and `sendmmsg(2)`, which is what makes millions of datagrams a
+/// second possible: at that rate, the cost of a system call per datagram is more than the cost of the
+/// datagrams themselves. The peer addresses are decoded straight from the kernel's `sockaddr`s into
+/// the caller's array, and the batch calls don't allocate.
+///
+/// On platforms without `recvmmsg` and `sendmmsg`, the batch calls fall back to a loop of `recvmsg` and
+/// `sendmsg`, with the same results.
+///
+/// ## Segmentation offload
+/// For bulk flows, Linux can also do the splitting and merging of datagrams itself: `SendSegmented`
+/// passes one large buffer that the kernel (or the NIC) cuts into datagrams of a given size after it
+/// has gone down the stack once (UDP GSO), and with `SetGro` enabled, `RecvSegmented` returns runs of
+/// datagrams from the same peer as one [`SegmentedDatagram`] (UDP GRO). On other platforms,
+/// `SendSegmented` and `SetGro` fail with `ENOPROTOOPT`.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/Socket/UdpSocket.h>
+///
+/// using namespace violet::net;
+///
+/// auto socket = socket::UdpSocket::Bind(SocketAddress::FromStr("0.0.0.0:9000").Value()).Value();
+///
+/// Array<Array<UInt8, 1500>, 32> storage;
+/// Array<Span<UInt8>, 32> buffers;
+/// for (UInt i = 0; i < buffers.size(); i++) {
+///     buffers[i] = storage[i];
+/// }
+///
+/// Array<UInt, 32> sizes{};
+/// Vec<SocketAddress> peers(32, SocketAddress::V4({}));
+///
+/// while (auto received = socket.RecvMany(buffers, sizes, peers)) {
+///     for (UInt i = 0; i < received.Value(); i++) {
+///         handle(Span(storage[i]).first(sizes[i]), peers[i]);
+///     }
+/// }
+/// ```
+struct VIOLET_API UdpSocket final {
+    /// The most datagrams that one `RecvMany` or `SendMany` call moves; larger batches are cut to this.
+    constexpr static UInt kMaxBatch = 64;
+
+    /// Opens a UDP socket of the family of `address` and binds it to `address`; port `0` lets the
+    /// kernel pick one, which `LocalAddress` returns.
+    static auto Bind(const SocketAddress& address) noexcept -> Result<UdpSocket, SocketError>;
+
+    /// Sets the default peer of the socket, which `Send` sends to; the kernel then drops datagrams
+    /// from every other address.
+    auto Connect(const SocketAddress& peer) noexcept -> Result<void, SocketError>;
+
+    /// Sends `data` as one datagram to `peer`.
+    /// @returns the number of bytes sent
+    auto SendTo(Span<const UInt8> data, const SocketAddress& peer) noexcept -> Result<UInt, SocketError>;
+
+    /// Sends `data` as one datagram to the peer that the socket is connected to.
+    /// @returns the number of bytes sent
+    auto Send(Span<const UInt8> data) noexcept -> Result<UInt, SocketError>;
+
+    /// Receives one datagram into `buffer`, and its sender into `peer`. A datagram larger than
+    /// `buffer` is truncated.
+    ///
+    /// @returns the number of bytes received
+    auto RecvFrom(Span<UInt8> buffer, SocketAddress& peer) noexcept -> Result<UInt, SocketError>;
+
+    /// Receives one datagram into `buffer`, like `RecvFrom` without the sender.
+    auto Recv(Span<UInt8> buffer) noexcept -> Result<UInt, SocketError>;
+
+    /// Receives up to `buffers.size()` datagrams (at most [`kMaxBatch`]) in one system call: the `i`th
+    /// datagram is written to `buffers[i]`, its size to `sizes[i]` and its sender to `peers[i]`, which
+    /// must both be at least as large as `buffers`. A datagram larger than its buffer is truncated.
+    ///
+    /// A blocking socket waits for the first datagram, then takes whichever others are already queued
+    /// without waiting for more; a non-blocking socket fails with [`SocketError::WouldBlock`] if none are.
+    ///
+    /// @returns the number of datagrams received
+    auto RecvMany(Span<const Span<UInt8>> buffers, Span<UInt> sizes, Span<SocketAddress> peers) noexcept
+        -> Result<UInt, SocketError>;
+
+    /// Sends up to `datagrams.size()` datagrams (at most [`kMaxBatch`]) in one system call, `datagrams[i]`
+    /// to `peers[i]`; `peers` can be empty on a connected socket, to send them all to its peer.
+    ///
+    /// @returns the number of datagrams sent, which can be less than asked if the socket's buffer is full
+    auto SendMany(Span<const Span<const UInt8>> datagrams, Span<const SocketAddress> peers = { }) noexcept
+        -> Result<UInt, SocketError>;
+
+    /// The most segments that `SendSegmented` can send at once; the kernel also rejects a buffer larger
+    /// than a UDP datagram can be (65507 bytes over IPv4) with `EINVAL`.
+    constexpr static UInt kMaxSegments = 64;
+
+    /// Sends `data` to `peer` as datagrams of `segmentSize` bytes, the last of which can be shorter, in
+    /// one system call: the datagrams go down the stack as one and are only split at the bottom, by the
+    /// kernel or by the NIC (UDP GSO).
+    ///
+    /// Fails with `EINVAL` without sending anything if `segmentSize` is **0** or `data` would take more
+    /// than [`kMaxSegments`] segments.
+    ///
+    /// @returns the number of bytes sent
+    auto SendSegmented(Span<const UInt8> data, UInt16 segmentSize, const SocketAddress& peer) noexcept
+        -> Result<UInt, SocketError>;
+
+    /// Sends `data` as datagrams of `segmentSize` bytes to the peer that the socket is connected to,
+    /// like `SendSegmented` above.
+    auto SendSegmented(Span<const UInt8> data, UInt16 segmentSize) noexcept -> Result<UInt, SocketError>;
+
+    /// Enables or disables UDP GRO, which lets the kernel hand datagrams from the same peer that arrive
+    /// together to `RecvSegmented` as one. With it enabled, read the socket with `RecvSegmented` rather
+    /// than the other calls, which can't tell the datagrams in a coalesced one apart.
+    auto SetGro(bool enabled) const noexcept -> Result<void, SocketError>;
+
+    /// Receives a datagram, which can be several coalesced ones if `SetGro` is enabled, into `buffer`,
+    /// and its sender into `peer`. `buffer` should be 64 KiB, the most that the kernel coalesces; a
+    /// datagram larger than it is truncated.
+    auto RecvSegmented(Span<UInt8> buffer, SocketAddress& peer) noexcept -> Result<SegmentedDatagram, SocketError>;
+
+    /// Returns the address that the socket is bound to.
+    [[nodiscard]] auto LocalAddress() const noexcept -> Result<SocketAddress, SocketError>
+    {
+        return this->n_fd.LocalAddress();
+    }
+
+    /// Sets or clears `O_NONBLOCK`.
+    auto SetNonBlocking(bool enabled) const noexcept -> Result<void, SocketError>
+    {
+        return this->n_fd.SetNonBlocking(enabled);
+    }
+
+    /// Sets `SO_RCVBUF`, the size of the kernel's queue of received datagrams, which is what absorbs
+    /// bursts while the socket isn't being read. The kernel doubles `bytes` and caps it at `rmem_max`.
+    auto SetReceiveBufferSize(int bytes) const noexcept -> Result<void, SocketError>
+    {
+        return this->n_fd.SetOption(SOL_SOCKET, SO_RCVBUF, bytes);
+    }
+
+    /// Sets `SO_SNDBUF`, the size of the kernel's queue of datagrams to send.
+    auto SetSendBufferSize(int bytes) const noexcept -> Result<void, SocketError>
+    {
+        return this->n_fd.SetOption(SOL_SOCKET, SO_SNDBUF, bytes);
+    }
+
+    /// Returns the socket's descriptor, for options and system calls that this doesn't cover.
+    [[nodiscard]] auto AsDescriptor() const noexcept -> const Descriptor&
+    {
+        return this->n_fd;
+    }
+
+private:
+    VIOLET_EXPLICIT UdpSocket(Descriptor fd) noexcept
+        : n_fd(std::move(fd))
+    {
+    }
+
+    Descriptor n_fd;
+};
+
+} // namespace violet::net::socket
@@ -49,7 +49,7 @@ struct SocketAddress final {
         V6
     };
 
-    static auto V4(socket::AddrV4 address) noexcept -> SocketAddress
+    constexpr static auto V4(socket::AddrV4 address) noexcept -> SocketAddress
     {
         SocketAddress addr;
         addr.n_value = address;
@@ -57,7 +57,7 @@ struct SocketAddress final {
         return addr;
     }
 
-    static auto V6(socket::AddrV6 address) noexcept -> SocketAddress
+    constexpr static auto V6(socket::AddrV6 address) noexcept -> SocketAddress
     {
         SocketAddress addr;
         addr.n_value = address;
@@ -67,6 +67,84 @@ struct SocketAddress final {
 
     static auto FromStr(Str input) noexcept -> Result<SocketAddress, ParseSocketAddressError>;
 
+    /// Parses an address of either family like `FromStr`, but returns **Nothing** instead of an error so
+    /// that it can be used in constant expressions; see `ip::AddrV4::Parse`.
+    constexpr static auto Parse(Str input) noexcept -> Optional<SocketAddress>
+    {
+        // IPv6 socket addresses are always bracketed (`[::1]:80`), IPv4 ones never are
+        if (!input.empty() && input.front() == '[') {
+            if (auto v6 = socket::AddrV6::Parse(input)) {
+                return SocketAddress::V6(v6.Unwrap());
+            }
+
+            return Nothing;
+        }
+
+        if (auto v4 = socket::AddrV4::Parse(input)) {
+            return SocketAddress::V4(v4.Unwrap());
+        }
+
+        return Nothing;
+    }
+
+    /// Reads the `sockaddr_in` or `sockaddr_in6` at `address`, depending on its `sa_family`; this is how
+    /// addresses that come back from `accept`, `recvfrom` and `getpeername` are turned into a socket address.
+    ///
+    /// ## Example
+    /// ```cpp
+    /// #include <violet/Networking/SocketAddress.h>
+    ///
+    /// sockaddr_storage storage{};
+    /// socklen_t length = sizeof(storage);
+    /// int client = ::accept(listener, reinterpret_cast<sockaddr*>(&storage), &length);
+    ///
+    /// auto peer = violet::net::SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&storage), length);
+    /// ```
+    ///
+    /// @returns **Nothing** if `address` is of another family, or `length` is too short for its family
+    static auto FromSockAddr(const sockaddr* address, socklen_t length) noexcept -> Optional<SocketAddress>
+    {
+        if (address == nullptr || length < static_cast<socklen_t>(sizeof(sa_family_t))) {
+            return Nothing;
+        }
+
+        switch (address->sa_family) {
+        case AF_INET:
+            if (auto v4 = socket::AddrV4::FromSockAddr(address, length)) {
+                return SocketAddress::V4(v4.Unwrap());
+            }
+
+            return Nothing;
+
+        case AF_INET6:
+            if (auto v6 = socket::AddrV6::FromSockAddr(address, length)) {
+                return SocketAddress::V6(v6.Unwrap());
+            }
+
+            return Nothing;
+
+        default:
+            return Nothing;
+        }
+    }
+
+    /// Writes the socket address that this holds to `out`, as a `sockaddr_in` or a `sockaddr_in6`.
+    /// @returns the length to pass along with `out`, which is `SockAddrLen()`
+    auto ToSockAddr(sockaddr_storage& out) const noexcept -> socklen_t
+    {
+        if (this->TypeOf() == Type::V4) {
+            return this->AsV4Unchecked(Unsafe("checked the type")).ToSockAddr(out);
+        }
+
+        return this->AsV6Unchecked(Unsafe("checked the type")).ToSockAddr(out);
+    }
+
+    /// Returns the size of the `sockaddr` that this socket address is passed to the kernel as.
+    [[nodiscard]] constexpr auto SockAddrLen() const noexcept -> socklen_t
+    {
+        return this->TypeOf() == Type::V4 ? socket::AddrV4::SockAddrLen() : socket::AddrV6::SockAddrLen();
+    }
+
     [[nodiscard]] constexpr auto TypeOf() const noexcept -> Type
     {
         return this->n_value.Holds<socket::AddrV4>() ? Type::V4 : Type::V6;
@@ -120,6 +198,27 @@ struct SocketAddress final {
         return !(self == other);
     }
 
+    /// Returns the [`ip::FixedHash`] of the socket address that this holds.
+    friend constexpr auto FixedHash(const SocketAddress& address, UInt64 seed = 0) noexcept -> UInt64
+    {
+        if (address.TypeOf() == Type::V4) {
+            return socket::FixedHash(address.AsV4Unchecked(Unsafe("checked the type")), seed);
+        }
+
+        return socket::FixedHash(address.AsV6Unchecked(Unsafe("checked the type")), seed);
+    }
+
+    /// Hashes the family along with the socket address, like for [`IPAddress`].
+    template<typename H>
+    friend auto AbslHashValue(H state, const SocketAddress& address) -> H
+    {
+        if (address.TypeOf() == Type::V4) {
+            return H::combine(std::move(state), Type::V4, address.AsV4Unchecked(Unsafe("checked the type")));
+        }
+
+        return H::combine(std::move(state), Type::V6, address.AsV6Unchecked(Unsafe("checked the type")));
+    }
+
     constexpr friend auto operator<=>(const SocketAddress& self, const SocketAddress& other) -> std::strong_ordering
     {
         if (auto cmp = self.n_value.Index() <=> other.n_value.Index(); cmp != 0) {
@@ -133,16 +232,49 @@ struct SocketAddress final {
     }
 
 private:
-    VIOLET_IMPLICIT SocketAddress() noexcept = default;
+    constexpr VIOLET_IMPLICIT SocketAddress() noexcept = default;
 
     using variant_type = violet::experimental::OneOf<socket::AddrV4, socket::AddrV6>;
 
     variant_type n_value;
 };
 
+namespace literals {
+
+/// Parses a socket address of either family at compile time; invalid text is a compile error.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Networking/SocketAddress.h>
+///
+/// using namespace violet::net::literals;
+///
+/// constexpr auto https = "[::1]:443"_sockaddr;
+/// constexpr auto dns = "10.0.0.53:53"_sockaddr;
+/// ```
+consteval auto operator""_sockaddr(const char* str, UInt size) noexcept -> SocketAddress
+{
+    auto addr = SocketAddress::Parse(Str(str, size));
+    if (!addr) {
+        ip::detail::InvalidAddressLiteral();
+    }
+
+    return addr.Unwrap();
+}
+
+} // namespace literals
 } // namespace violet::net
 
 VIOLET_FORMATTER(violet::net::SocketAddress);
+
+template<>
+struct std::hash<violet::net::SocketAddress> final {
+    auto operator()(const violet::net::SocketAddress& addr) const noexcept -> violet::UInt
+    {
+        return FixedHash(addr);
+    }
+};
+
 VIOLET_TO_STRING(violet::net::SocketAddress::Type, typ, {
     using T = violet::net::SocketAddress::Type;
     switch (typ) {
@@ -0,0 +1,57 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/FlowKey.h>
+
+using violet::net::FlowKey;
+using violet::net::IPProtocol;
+
+namespace {
+
+auto protocolName(IPProtocol protocol) noexcept -> violet::String
+{
+    switch (protocol) {
+    case IPProtocol::kICMP:
+        return "icmp";
+
+    case IPProtocol::kTCP:
+        return "tcp";
+
+    case IPProtocol::kUDP:
+        return "udp";
+
+    case IPProtocol::kICMPv6:
+        return "icmpv6";
+
+    case IPProtocol::kSCTP:
+        return "sctp";
+    }
+
+    // any other protocol number is as valid, it just has no name here
+    return std::format("proto {}", static_cast<violet::UInt32>(protocol));
+}
+
+} // namespace
+
+auto FlowKey::ToString() const noexcept -> String
+{
+    return std::format("{} {} -> {}", protocolName(this->n_protocol), this->Source(), this->Destination());
+}
@@ -21,21 +21,99 @@
 
 #include <violet/Networking/IPAddress.h>
 
+#include <algorithm>
+
+using violet::Array;
 using violet::Err;
+using violet::Span;
+using violet::Str;
+using violet::UInt;
 using violet::net::IPAddress;
 using violet::net::ParseIPAddressError;
 
+namespace {
+
+// Every valid IPv6 address has a `:` within its first 5 characters (a hextet is at most 4 digits) while
+// an IPv4 address never has one, so this is enough to pick the only parser that could succeed.
+auto looksLikeV6(Str input) noexcept -> bool
+{
+    return input.substr(0, 5).find(':') != Str::npos;
+}
+
+// Number of inputs sorted by family at once in `IPAddress::ParseMany`; small enough that the scratch
+// buffers stay on the stack.
+constexpr UInt kParseBlockSize = 64;
+
+} // namespace
+
 auto IPAddress::FromStr(Str input) noexcept -> Result<IPAddress, ParseIPAddressError>
 {
+    if (looksLikeV6(input)) {
+        if (auto v6 = ip::AddrV6::FromStr(input); v6.Ok()) {
+            return IPAddress::V6(v6.Value());
+        }
+
+        return Err(ParseIPAddressError{});
+    }
+
     if (auto v4 = ip::AddrV4::FromStr(input); v4.Ok()) {
         return IPAddress::V4(v4.Value());
     }
 
-    if (auto v6 = ip::AddrV6::FromStr(input); v6.Ok()) {
-        return IPAddress::V6(v6.Value());
+    return Err(ParseIPAddressError{});
+}
+
+auto IPAddress::ParseMany(Span<const Str> inputs, Span<IPAddress> out, Span<ParseStatus> status) noexcept -> UInt
+{
+    VIOLET_DEBUG_ASSERT(out.size() >= inputs.size() && status.size() >= inputs.size(),
+        "output spans are smaller than the input");
+
+    using V4Status = ip::AddrV4::ParseStatus;
+    using V6Status = ip::AddrV6::ParseStatus;
+
+    Array<Str, kParseBlockSize> v4Inputs;
+    Array<Str, kParseBlockSize> v6Inputs;
+    Array<UInt, kParseBlockSize> v4Index;
+    Array<UInt, kParseBlockSize> v6Index;
+
+    Array<ip::AddrV4, kParseBlockSize> v4Addrs;
+    Array<ip::AddrV6, kParseBlockSize> v6Addrs;
+    Array<V4Status, kParseBlockSize> v4Status;
+    Array<V6Status, kParseBlockSize> v6Status;
+
+    UInt parsed = 0;
+    for (UInt base = 0; base < inputs.size(); base += kParseBlockSize) {
+        const UInt end = std::min(inputs.size(), base + kParseBlockSize);
+
+        UInt v4Count = 0;
+        UInt v6Count = 0;
+        for (UInt i = base; i < end; ++i) {
+            if (looksLikeV6(inputs[i])) {
+                v6Index[v6Count] = i;
+                v6Inputs[v6Count++] = inputs[i];
+            } else {
+                v4Index[v4Count] = i;
+                v4Inputs[v4Count++] = inputs[i];
+            }
+        }
+
+        parsed += ip::AddrV4::ParseMany(Span<const Str>(v4Inputs.data(), v4Count), v4Addrs, v4Status);
+        parsed += ip::AddrV6::ParseMany(Span<const Str>(v6Inputs.data(), v6Count), v6Addrs, v6Status);
+
+        for (UInt i = 0; i < v4Count; ++i) {
+            const bool ok = v4Status[i] == V4Status::kOk;
+            out[v4Index[i]] = IPAddress::V4(v4Addrs[i]);
+            status[v4Index[i]] = ok ? ParseStatus::kOk : ParseStatus::kInvalid;
+        }
+
+        for (UInt i = 0; i < v6Count; ++i) {
+            const bool ok = v6Status[i] == V6Status::kOk;
+            out[v6Index[i]] = ok ? IPAddress::V6(v6Addrs[i]) : IPAddress::V4(ip::AddrV4());
+            status[v6Index[i]] = ok ? ParseStatus::kOk : ParseStatus::kInvalid;
+        }
     }
 
-    return Err(ParseIPAddressError{});
+    return parsed;
 }
 
 auto IPAddress::ToString() const noexcept -> String
@@ -0,0 +1,50 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/IPNetwork.h>
+
+using violet::Err;
+using violet::Str;
+using violet::net::IPNetwork;
+using violet::net::ParseIPNetworkError;
+
+auto IPNetwork::FromStr(Str input) noexcept -> Result<IPNetwork, ParseIPNetworkError>
+{
+    // see `IPAddress::FromStr`
+    if (input.substr(0, 5).find(':') != Str::npos) {
+        if (auto v6 = ip::NetworkV6::FromStr(input); v6.Ok()) {
+            return IPNetwork::V6(v6.Value());
+        }
+
+        return Err(ParseIPNetworkError{ });
+    }
+
+    if (auto v4 = ip::NetworkV4::FromStr(input); v4.Ok()) {
+        return IPNetwork::V4(v4.Value());
+    }
+
+    return Err(ParseIPNetworkError{ });
+}
+
+auto IPNetwork::ToString() const noexcept -> String
+{
+    return this->n_value.Visit([](const auto& network) -> String { return network.ToString(); });
+}
@@ -27,12 +27,17 @@ using violet::net::SocketAddress;
 
 auto SocketAddress::FromStr(Str input) noexcept -> Result<SocketAddress, ParseSocketAddressError>
 {
-    if (auto v4 = socket::AddrV4::FromStr(input); v4.Ok()) {
-        return SocketAddress::V4(v4.Value());
+    // IPv6 socket addresses are always bracketed (`[::1]:80`), IPv4 ones never are.
+    if (!input.empty() && input.front() == '[') {
+        if (auto v6 = socket::AddrV6::FromStr(input); v6.Ok()) {
+            return SocketAddress::V6(v6.Value());
+        }
+
+        return Err(ParseSocketAddressError{});
     }
 
-    if (auto v6 = socket::AddrV6::FromStr(input); v6.Ok()) {
-        return SocketAddress::V6(v6.Value());
+    if (auto v4 = socket::AddrV4::FromStr(input); v4.Ok()) {
+        return SocketAddress::V4(v4.Value());
     }
 
     return Err(ParseSocketAddressError{});
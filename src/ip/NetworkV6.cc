@@ -0,0 +1,85 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/IP/NetworkV6.h>
+#include <violet/Networking/IP/Tables.h>
+
+namespace violet::net::ip {
+
+auto NetworkV6::FromStr(Str input) noexcept -> Result<NetworkV6, InvalidV6NetworkError>
+{
+    const auto slash = input.find('/');
+
+    auto address = AddrV6::FromStr(input.substr(0, slash));
+    if (address.Err()) {
+        const auto& error = address.Error();
+        return Err(InvalidV6NetworkError(ParseStatus::kInvalidAddress, error.Kind(), error.Offset()));
+    }
+
+    if (slash == Str::npos) {
+        return NetworkV6(address.Value(), 128);
+    }
+
+    UInt64 prefix = 0;
+    if (auto ec = detail::ParseDecimal(input.substr(slash + 1), 128, prefix); ec != std::errc{ }) {
+        auto kind = ec == std::errc::result_out_of_range ? ParseStatus::kPrefixOutOfRange : ParseStatus::kInvalidPrefix;
+        return Err(InvalidV6NetworkError(kind, AddrV6::ParseStatus::kOk, slash + 1));
+    }
+
+    return NetworkV6(address.Value(), static_cast<UInt8>(prefix));
+}
+
+auto NetworkV6::ToChars(char* first, char* last) const noexcept -> std::to_chars_result
+{
+    return detail::WriteBounded<kMaxStringLength>(first, last, [this](char* out) -> char* {
+        out = this->Address().ToChars(out, out + AddrV6::kMaxStringLength).ptr;
+        *out++ = '/';
+
+        return detail::WriteOctet(out, this->n_prefix);
+    });
+}
+
+auto NetworkV6::ToString() const noexcept -> String
+{
+    Array<char, kMaxStringLength> buf;
+    auto [end, _] = this->ToChars(buf.data(), buf.data() + buf.size());
+
+    return { buf.data(), end };
+}
+
+auto InvalidV6NetworkError::ToString() const noexcept -> String
+{
+    switch (this->Kind()) {
+    case NetworkV6::ParseStatus::kInvalidAddress:
+        return this->Address()->ToString();
+
+    case NetworkV6::ParseStatus::kInvalidPrefix:
+        return "invalid IPv6 network: prefix length isn't a number";
+
+    case NetworkV6::ParseStatus::kPrefixOutOfRange:
+        return "invalid IPv6 network: prefix length is larger than 128";
+
+    default:
+        VIOLET_UNREACHABLE();
+    }
+}
+
+} // namespace violet::net::ip
@@ -0,0 +1,205 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/IP/PrefixMapV4.h>
+
+namespace violet::net::ip::detail {
+
+namespace {
+
+// how many lookups `LookupMany` has in flight at once
+constexpr UInt kLookupBatch = 8;
+
+} // namespace
+
+Dir24Table::Dir24Table()
+    : n_tbl24(kTbl24Size, 0)
+{
+}
+
+auto Dir24Table::Insert(const NetworkV4& network, UInt32 id) -> Optional<UInt32>
+{
+    VIOLET_DEBUG_ASSERT(id <= kMaxId, "value id doesn't fit in 24 bits");
+
+    Optional<UInt32> previous = Nothing;
+    auto [it, inserted] = this->n_rules.try_emplace(ruleKey(network), id);
+    if (!inserted) {
+        previous = Some<UInt32>(it->second);
+        it->second = id;
+    }
+
+    this->update(network, makeEntry(network.PrefixLength(), id), false);
+    return previous;
+}
+
+auto Dir24Table::Remove(const NetworkV4& network) -> Optional<UInt32>
+{
+    auto it = this->n_rules.find(ruleKey(network));
+    if (it == this->n_rules.end()) {
+        return Nothing;
+    }
+
+    const UInt32 id = it->second;
+    this->n_rules.erase(it);
+    this->update(network, this->coveringEntry(network), true);
+
+    return Some<UInt32>(id);
+}
+
+auto Dir24Table::Find(const NetworkV4& network) const noexcept -> Optional<UInt32>
+{
+    if (auto it = this->n_rules.find(ruleKey(network)); it != this->n_rules.end()) {
+        return Some<UInt32>(it->second);
+    }
+
+    return Nothing;
+}
+
+auto Dir24Table::LookupMany(Span<const AddrV4> addresses, Span<UInt32> ids) const noexcept -> UInt
+{
+    return this->AsView().LookupMany(addresses, ids);
+}
+
+auto Dir24Table::View::LookupMany(Span<const AddrV4> addresses, Span<UInt32> ids) const noexcept -> UInt
+{
+    VIOLET_DEBUG_ASSERT(ids.size() >= addresses.size(), "output span is too small");
+
+    UInt matched = 0;
+    Array<UInt32, kLookupBatch> entries;
+    for (UInt i = 0; i < addresses.size(); i += kLookupBatch) {
+        const UInt count = std::min(kLookupBatch, addresses.size() - i);
+        const AddrV4* batch = addresses.data() + i;
+
+        for (UInt j = 0; j < count; j++) {
+            __builtin_prefetch(&this->n_tbl24[batch[j].AsUInt32() >> 8]);
+        }
+
+        for (UInt j = 0; j < count; j++) {
+            entries[j] = this->n_tbl24[batch[j].AsUInt32() >> 8];
+            if (entries[j] & kExtended) {
+                __builtin_prefetch(&this->n_tbl8[((entries[j] & kIdMask) << 8) | (batch[j].AsUInt32() & 0xFF)]);
+            }
+        }
+
+        for (UInt j = 0; j < count; j++) {
+            UInt32 entry = entries[j];
+            if (entry & kExtended) {
+                entry = this->n_tbl8[((entry & kIdMask) << 8) | (batch[j].AsUInt32() & 0xFF)];
+            }
+
+            const bool valid = (entry & kValid) != 0;
+            ids[i + j] = valid ? (entry & kIdMask) : kNoMatch;
+            matched += static_cast<UInt>(valid);
+        }
+    }
+
+    return matched;
+}
+
+void Dir24Table::update(const NetworkV4& network, UInt32 entry, bool removing)
+{
+    const UInt32 addr = network.Address().AsUInt32();
+    const UInt8 prefix = network.PrefixLength();
+
+    if (prefix <= 24) {
+        const UInt32 first = addr >> 8;
+        const UInt32 last = first + (UInt32(1) << (24 - prefix));
+        for (UInt32 index = first; index < last; index++) {
+            const UInt32 current = this->n_tbl24[index];
+            if (current & kExtended) {
+                this->updateGroup(current & kIdMask, 0, kGroupSize, prefix, entry, removing);
+            } else if (matches(current, prefix, removing)) {
+                this->n_tbl24[index] = entry;
+            }
+        }
+
+        return;
+    }
+
+    const UInt32 index = addr >> 8;
+    if (!(this->n_tbl24[index] & kExtended)) {
+        VIOLET_DEBUG_ASSERT(!removing, "a prefix longer than /24 is always in a group");
+        this->n_tbl24[index] = kExtended | this->allocateGroup(this->n_tbl24[index]);
+    }
+
+    this->updateGroup(this->n_tbl24[index] & kIdMask, addr & 0xFF, UInt32(1) << (32 - prefix), prefix, entry,
+        removing);
+
+    if (removing) {
+        this->collapseGroup(index);
+    }
+}
+
+void Dir24Table::updateGroup(UInt32 group, UInt32 first, UInt32 count, UInt8 prefix, UInt32 entry, bool removing)
+{
+    UInt32* entries = this->n_tbl8.data() + (static_cast<UInt>(group) * kGroupSize);
+    for (UInt32 i = first; i < first + count; i++) {
+        if (matches(entries[i], prefix, removing)) {
+            entries[i] = entry;
+        }
+    }
+}
+
+auto Dir24Table::allocateGroup(UInt32 entry) -> UInt32
+{
+    UInt32 group = 0;
+    if (this->n_freeGroups.empty()) {
+        group = static_cast<UInt32>(this->n_tbl8.size() / kGroupSize);
+        VIOLET_DEBUG_ASSERT(group <= kMaxId, "too many groups");
+
+        this->n_tbl8.resize(this->n_tbl8.size() + kGroupSize);
+    } else {
+        group = this->n_freeGroups.back();
+        this->n_freeGroups.pop_back();
+    }
+
+    std::fill_n(this->n_tbl8.begin() + (static_cast<std::ptrdiff_t>(group) * kGroupSize), kGroupSize, entry);
+    return group;
+}
+
+void Dir24Table::collapseGroup(UInt32 index)
+{
+    // once a group has no prefixes longer than `/24` left, all of its entries come from the same
+    // prefix (or none), so the `tbl24` entry can hold it again
+    const UInt32 group = this->n_tbl24[index] & kIdMask;
+    const UInt32* entries = this->n_tbl8.data() + (static_cast<UInt>(group) * kGroupSize);
+    for (UInt32 i = 0; i < kGroupSize; i++) {
+        if ((entries[i] & kValid) && prefixOf(entries[i]) > 24) {
+            return;
+        }
+    }
+
+    this->n_tbl24[index] = entries[0];
+    this->n_freeGroups.push_back(group);
+}
+
+auto Dir24Table::coveringEntry(const NetworkV4& network) const noexcept -> UInt32
+{
+    for (UInt8 prefix = network.PrefixLength(); prefix-- > 0;) {
+        if (auto it = this->n_rules.find(ruleKey(NetworkV4(network.Address(), prefix))); it != this->n_rules.end()) {
+            return makeEntry(prefix, it->second);
+        }
+    }
+
+    return 0;
+}
+
+} // namespace violet::net::ip::detail
@@ -0,0 +1,533 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/IP/PrefixMapV6.h>
+
+#include <bit>
+
+namespace violet::net::ip::detail {
+
+namespace {
+
+// how many lookups `LookupMany` walks down the trie at once
+constexpr UInt kLookupBatch = 8;
+
+constexpr UInt kStride = TreeBitmapV6::kStride;
+constexpr UInt kLevels = TreeBitmapV6::kLevels;
+constexpr UInt32 kNoMatch = TreeBitmapV6::kNoMatch;
+
+// the bit of the prefix of `length` (1 to `kStride`) within a stride that contains `slot`
+constexpr auto positionOf(UInt slot, UInt length) noexcept -> UInt
+{
+    return (UInt(1) << length) - 2 + (slot >> (kStride - length));
+}
+
+// the bits of `address` that the node at `level` consumes, read from its 64-bit halves; the last level
+// can run past the end of the address, as if it was followed by zeros
+constexpr auto slotAt(const AddrV6& address, UInt level) noexcept -> UInt
+{
+    const absl::uint128 value = absl::MakeUint128(address.High64(), address.Low64());
+    const auto end = static_cast<int>(kStride * (level + 1));
+    const absl::uint128 slot = end <= 128 ? value >> (128 - end) : value << (end - 128);
+
+    return static_cast<UInt>(absl::Uint128Low64(slot) & (TreeBitmapV6::kFanout - 1));
+}
+
+template<UInt N>
+constexpr auto testBit(const Array<UInt64, N>& bits, UInt position) noexcept -> bool
+{
+    return ((bits[position / 64] >> (position % 64)) & 1) != 0;
+}
+
+template<UInt N>
+constexpr void flipBit(Array<UInt64, N>& bits, UInt position) noexcept
+{
+    bits[position / 64] ^= UInt64(1) << (position % 64);
+}
+
+// the number of set bits before `position`
+template<UInt N>
+constexpr auto rankOf(const Array<UInt64, N>& bits, UInt position) noexcept -> UInt
+{
+    UInt rank = 0;
+    for (UInt word = 0; word < position / 64; word++) {
+        rank += static_cast<UInt>(std::popcount(bits[word]));
+    }
+
+    return rank + static_cast<UInt>(std::popcount(bits[position / 64] & ((UInt64(1) << (position % 64)) - 1)));
+}
+
+template<UInt N>
+constexpr auto countOf(const Array<UInt64, N>& bits) noexcept -> UInt
+{
+    UInt count = 0;
+    for (const UInt64 word: bits) {
+        count += static_cast<UInt>(std::popcount(word));
+    }
+
+    return count;
+}
+
+template<UInt N>
+constexpr auto isEmpty(const Array<UInt64, N>& bits) noexcept -> bool
+{
+    UInt64 any = 0;
+    for (const UInt64 word: bits) {
+        any |= word;
+    }
+
+    return any == 0;
+}
+
+// `kSlotMasks[slot]` has the bits of the prefixes within a stride that contain `slot`, one per length
+constexpr auto kSlotMasks = []() constexpr {
+    Array<Array<UInt64, ((2 * TreeBitmapV6::kFanout) - 2 + 63) / 64>, TreeBitmapV6::kFanout> masks{ };
+    for (UInt slot = 0; slot < TreeBitmapV6::kFanout; slot++) {
+        for (UInt length = 1; length <= kStride; length++) {
+            const UInt position = positionOf(slot, length);
+            masks[slot][position / 64] |= UInt64(1) << (position % 64);
+        }
+    }
+
+    return masks;
+}();
+
+// where the prefix of `network` is in the node at `(length - 1) / kStride`
+struct Placement final {
+    UInt Level;
+    UInt Position;
+};
+
+constexpr auto placementOf(const NetworkV6& network) noexcept -> Placement
+{
+    const UInt level = (network.PrefixLength() - 1U) / kStride;
+    const UInt length = network.PrefixLength() - (kStride * level);
+
+    return { level, positionOf(slotAt(network.Address(), level), length) };
+}
+
+// Blocks of `T`s within `pool` are rounded up to a power of two, so that a block only moves when its
+// size crosses one; `free` has the released blocks by log2 of their size.
+template<typename T, UInt N>
+auto allocateBlock(Vec<T>& pool, Array<Vec<UInt32>, N>& free, UInt count) -> UInt32
+{
+    auto& blocks = free[static_cast<UInt>(std::countr_zero(std::bit_ceil(count)))];
+    if (!blocks.empty()) {
+        const UInt32 base = blocks.back();
+        blocks.pop_back();
+
+        return base;
+    }
+
+    const auto base = static_cast<UInt32>(pool.size());
+    pool.resize(pool.size() + std::bit_ceil(count));
+
+    return base;
+}
+
+template<UInt N>
+void releaseBlock(Array<Vec<UInt32>, N>& free, UInt32 base, UInt count)
+{
+    free[static_cast<UInt>(std::countr_zero(std::bit_ceil(count)))].push_back(base);
+}
+
+// inserts `value` at `rank` into the block of `count` elements at `base`, and returns where the block
+// is now
+template<typename T, UInt N>
+auto insertAt(Vec<T>& pool, Array<Vec<UInt32>, N>& free, UInt32 base, UInt count, UInt rank, const T& value) -> UInt32
+{
+    if (count != 0 && std::bit_ceil(count + 1) == std::bit_ceil(count)) {
+        std::move_backward(pool.begin() + base + rank, pool.begin() + base + count, pool.begin() + base + count + 1);
+        pool[base + rank] = value;
+
+        return base;
+    }
+
+    const UInt32 target = allocateBlock(pool, free, count + 1);
+    std::move(pool.begin() + base, pool.begin() + base + rank, pool.begin() + target);
+    std::move(pool.begin() + base + rank, pool.begin() + base + count, pool.begin() + target + rank + 1);
+    pool[target + rank] = value;
+
+    if (count != 0) {
+        releaseBlock(free, base, count);
+    }
+
+    return target;
+}
+
+// removes the element at `rank` from the block of `count` elements at `base`, and returns where the
+// block is now
+template<typename T, UInt N>
+auto eraseAt(Vec<T>& pool, Array<Vec<UInt32>, N>& free, UInt32 base, UInt count, UInt rank) -> UInt32
+{
+    if (count == 1) {
+        releaseBlock(free, base, count);
+        return 0;
+    }
+
+    if (std::bit_ceil(count - 1) == std::bit_ceil(count)) {
+        std::move(pool.begin() + base + rank + 1, pool.begin() + base + count, pool.begin() + base + rank);
+        return base;
+    }
+
+    const UInt32 target = allocateBlock(pool, free, count - 1);
+    std::move(pool.begin() + base, pool.begin() + base + rank, pool.begin() + target);
+    std::move(pool.begin() + base + rank + 1, pool.begin() + base + count, pool.begin() + target + rank);
+    releaseBlock(free, base, count);
+
+    return target;
+}
+
+// The walk is compiled twice: once for the baseline, and once with `popcnt`, which the rank of every
+// step needs and which is otherwise a call into the runtime library that doubles the cost of a level.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && !defined(__POPCNT__)
+#    define VIOLET_NET_TRIE_POPCNT 1
+#    define VIOLET_NET_TRIE_INLINE __attribute__((always_inline)) inline
+#elif defined(__GNUC__) || defined(__clang__)
+#    define VIOLET_NET_TRIE_POPCNT 0
+#    define VIOLET_NET_TRIE_INLINE __attribute__((always_inline)) inline
+#else
+#    define VIOLET_NET_TRIE_POPCNT 0
+#    define VIOLET_NET_TRIE_INLINE inline
+#endif
+
+using Node = TreeBitmapV6::Node;
+
+// what a lookup reads from the table
+struct Trie final {
+    const Node* Nodes;
+    const UInt32* Ids;
+    UInt32 Default;
+};
+
+// a match is the node and the bit of the longest prefix so far, `node << 32 | position`; it's only
+// resolved to its id at the end of the walk, since most are overridden by a longer one further down
+constexpr UInt64 kNoPrefix = ~UInt64(0);
+
+// descends from `node` along `slot`, recording its longest prefix that contains `slot` in `match`, and
+// returns the child or `kNoMatch`
+VIOLET_NET_TRIE_INLINE auto step(const Trie& trie, UInt32 node, UInt slot, UInt64& match) noexcept -> UInt32
+{
+    const Node& current = trie.Nodes[node];
+
+    // the longest prefix that contains `slot` is the highest bit left by its mask; everything is
+    // selected with conditional moves, so the only data-dependent branch of a walk is where it ends
+    const auto& mask = kSlotMasks[slot];
+    UInt64 longest = kNoPrefix;
+    for (UInt word = 0; word < current.Prefixes.size(); word++) {
+        const UInt64 hits = current.Prefixes[word] & mask[word];
+        const UInt64 position = (word * 64) + 63 - static_cast<UInt64>(std::countl_zero(hits));
+        longest = hits != 0 ? position : longest;
+    }
+
+    match = longest != kNoPrefix ? (static_cast<UInt64>(node) << 32) | longest : match;
+
+    // the rank of `slot` counts the children in the words before it and in its word below it
+    const UInt word = slot / 64;
+    UInt rank = 0;
+    for (UInt i = 0; i < current.Children.size(); i++) {
+        const UInt64 below = i < word ? ~UInt64(0) : (i == word ? (UInt64(1) << (slot % 64)) - 1 : 0);
+        rank += static_cast<UInt>(std::popcount(current.Children[i] & below));
+    }
+
+    return testBit(current.Children, slot) ? current.ChildBase + static_cast<UInt32>(rank) : kNoMatch;
+}
+
+VIOLET_NET_TRIE_INLINE auto resolve(const Trie& trie, UInt64 match) noexcept -> UInt32
+{
+    if (match == kNoPrefix) {
+        return trie.Default;
+    }
+
+    const Node& node = trie.Nodes[match >> 32];
+    return trie.Ids[node.ResultBase + rankOf(node.Prefixes, match & 0xFFFFFFFF)];
+}
+
+VIOLET_NET_TRIE_INLINE auto lookupIn(const Trie& trie, const AddrV6& address) noexcept -> UInt32
+{
+    UInt64 match = kNoPrefix;
+    UInt32 node = 0;
+    for (UInt level = 0; level < kLevels && node != kNoMatch; level++) {
+        node = step(trie, node, slotAt(address, level), match);
+    }
+
+    return resolve(trie, match);
+}
+
+VIOLET_NET_TRIE_INLINE auto lookupManyIn(const Trie& trie, Span<const AddrV6> addresses, Span<UInt32> ids) noexcept
+    -> UInt
+{
+    UInt matched = 0;
+    Array<UInt32, kLookupBatch> nodes;
+    Array<UInt64, kLookupBatch> matches;
+    for (UInt i = 0; i < addresses.size(); i += kLookupBatch) {
+        const UInt count = std::min(kLookupBatch, addresses.size() - i);
+        const AddrV6* batch = addresses.data() + i;
+
+        nodes.fill(0);
+        matches.fill(kNoPrefix);
+
+        for (UInt level = 0; level < kLevels; level++) {
+            bool active = false;
+            for (UInt j = 0; j < count; j++) {
+                if (nodes[j] != kNoMatch) {
+                    nodes[j] = step(trie, nodes[j], slotAt(batch[j], level), matches[j]);
+                }
+
+                if (nodes[j] != kNoMatch) {
+                    __builtin_prefetch(&trie.Nodes[nodes[j]]);
+                    active = true;
+                }
+            }
+
+            if (!active) {
+                break;
+            }
+        }
+
+        for (UInt j = 0; j < count; j++) {
+            ids[i + j] = resolve(trie, matches[j]);
+            matched += static_cast<UInt>(ids[i + j] != kNoMatch);
+        }
+    }
+
+    return matched;
+}
+
+auto lookupGeneric(const Trie& trie, const AddrV6& address) noexcept -> UInt32
+{
+    return lookupIn(trie, address);
+}
+
+auto lookupManyGeneric(const Trie& trie, Span<const AddrV6> addresses, Span<UInt32> ids) noexcept -> UInt
+{
+    return lookupManyIn(trie, addresses, ids);
+}
+
+#if VIOLET_NET_TRIE_POPCNT
+__attribute__((target("popcnt"))) auto lookupPopcnt(const Trie& trie, const AddrV6& address) noexcept -> UInt32
+{
+    return lookupIn(trie, address);
+}
+
+__attribute__((target("popcnt"))) auto lookupManyPopcnt(
+    const Trie& trie, Span<const AddrV6> addresses, Span<UInt32> ids) noexcept -> UInt
+{
+    return lookupManyIn(trie, addresses, ids);
+}
+
+auto hasPopcnt() noexcept -> bool
+{
+    static const bool supported = []() -> bool {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("popcnt") != 0;
+    }();
+
+    return supported;
+}
+#endif
+
+} // namespace
+
+TreeBitmapV6::TreeBitmapV6()
+    : n_nodes(1)
+{
+}
+
+auto TreeBitmapV6::Insert(const NetworkV6& network, UInt32 id) -> Optional<UInt32>
+{
+    VIOLET_DEBUG_ASSERT(id <= kMaxId, "value id is out of range");
+
+    if (network.PrefixLength() == 0) {
+        const UInt32 previous = std::exchange(this->n_default, id);
+        if (previous == kNoMatch) {
+            this->n_size++;
+            return Nothing;
+        }
+
+        return Some<UInt32>(previous);
+    }
+
+    const auto [level, position] = placementOf(network);
+
+    UInt32 node = 0;
+    for (UInt depth = 0; depth < level; depth++) {
+        const UInt slot = slotAt(network.Address(), depth);
+        const UInt rank = rankOf(this->n_nodes[node].Children, slot);
+
+        if (!testBit(this->n_nodes[node].Children, slot)) {
+            // `n_nodes` can grow here, so `this->n_nodes[node]` is looked up again afterwards
+            const UInt32 base = insertAt(this->n_nodes, this->n_freeNodes, this->n_nodes[node].ChildBase,
+                countOf(this->n_nodes[node].Children), rank, Node{ });
+
+            this->n_nodes[node].ChildBase = base;
+            flipBit(this->n_nodes[node].Children, slot);
+        }
+
+        node = this->n_nodes[node].ChildBase + static_cast<UInt32>(rank);
+    }
+
+    Node& target = this->n_nodes[node];
+    const UInt rank = rankOf(target.Prefixes, position);
+    if (testBit(target.Prefixes, position)) {
+        return Some<UInt32>(std::exchange(this->n_pool[target.ResultBase + rank], id));
+    }
+
+    target.ResultBase = insertAt(this->n_pool, this->n_freeIds, target.ResultBase, countOf(target.Prefixes), rank, id);
+    flipBit(target.Prefixes, position);
+    this->n_size++;
+
+    return Nothing;
+}
+
+auto TreeBitmapV6::Remove(const NetworkV6& network) -> Optional<UInt32>
+{
+    if (network.PrefixLength() == 0) {
+        const UInt32 previous = std::exchange(this->n_default, kNoMatch);
+        if (previous == kNoMatch) {
+            return Nothing;
+        }
+
+        this->n_size--;
+        return Some<UInt32>(previous);
+    }
+
+    const auto [level, position] = placementOf(network);
+
+    Array<UInt32, kLevels> path{ };
+    for (UInt depth = 0; depth < level; depth++) {
+        const Node& node = this->n_nodes[path[depth]];
+        const UInt slot = slotAt(network.Address(), depth);
+        if (!testBit(node.Children, slot)) {
+            return Nothing;
+        }
+
+        path[depth + 1] = node.ChildBase + static_cast<UInt32>(rankOf(node.Children, slot));
+    }
+
+    Node& target = this->n_nodes[path[level]];
+    if (!testBit(target.Prefixes, position)) {
+        return Nothing;
+    }
+
+    const UInt rank = rankOf(target.Prefixes, position);
+    const UInt32 id = this->n_pool[target.ResultBase + rank];
+    target.ResultBase = eraseAt(this->n_pool, this->n_freeIds, target.ResultBase, countOf(target.Prefixes), rank);
+    flipBit(target.Prefixes, position);
+    this->n_size--;
+
+    // unlink the nodes that are left without prefixes or children, bottom-up; the root always stays
+    for (UInt depth = level; depth > 0; depth--) {
+        const Node& node = this->n_nodes[path[depth]];
+        if (!isEmpty(node.Prefixes) || !isEmpty(node.Children)) {
+            break;
+        }
+
+        // `n_nodes` can grow when the siblings move to a smaller block, so `parent` isn't a reference
+        const UInt32 parent = path[depth - 1];
+        const UInt slot = slotAt(network.Address(), depth - 1);
+        const UInt32 base = eraseAt(this->n_nodes, this->n_freeNodes, this->n_nodes[parent].ChildBase,
+            countOf(this->n_nodes[parent].Children), rankOf(this->n_nodes[parent].Children, slot));
+
+        this->n_nodes[parent].ChildBase = base;
+        flipBit(this->n_nodes[parent].Children, slot);
+    }
+
+    return Some<UInt32>(id);
+}
+
+auto TreeBitmapV6::Find(const NetworkV6& network) const noexcept -> Optional<UInt32>
+{
+    if (network.PrefixLength() == 0) {
+        return this->n_default == kNoMatch ? Nothing : Some<UInt32>(this->n_default);
+    }
+
+    const UInt32 node = this->findNode(network);
+    if (node == kNoMatch) {
+        return Nothing;
+    }
+
+    const Node& target = this->n_nodes[node];
+    const UInt position = placementOf(network).Position;
+    if (!testBit(target.Prefixes, position)) {
+        return Nothing;
+    }
+
+    return Some<UInt32>(this->n_pool[target.ResultBase + rankOf(target.Prefixes, position)]);
+}
+
+auto TreeBitmapV6::Lookup(const AddrV6& address) const noexcept -> UInt32
+{
+    return this->AsView().Lookup(address);
+}
+
+auto TreeBitmapV6::LookupMany(Span<const AddrV6> addresses, Span<UInt32> ids) const noexcept -> UInt
+{
+    return this->AsView().LookupMany(addresses, ids);
+}
+
+auto TreeBitmapV6::View::Lookup(const AddrV6& address) const noexcept -> UInt32
+{
+    const Trie trie{ this->n_nodes.data(), this->n_ids.data(), this->n_default };
+
+#if VIOLET_NET_TRIE_POPCNT
+    if (hasPopcnt()) {
+        return lookupPopcnt(trie, address);
+    }
+#endif
+
+    return lookupGeneric(trie, address);
+}
+
+auto TreeBitmapV6::View::LookupMany(Span<const AddrV6> addresses, Span<UInt32> ids) const noexcept -> UInt
+{
+    VIOLET_DEBUG_ASSERT(ids.size() >= addresses.size(), "output span is too small");
+
+    const Trie trie{ this->n_nodes.data(), this->n_ids.data(), this->n_default };
+
+#if VIOLET_NET_TRIE_POPCNT
+    if (hasPopcnt()) {
+        return lookupManyPopcnt(trie, addresses, ids);
+    }
+#endif
+
+    return lookupManyGeneric(trie, addresses, ids);
+}
+
+auto TreeBitmapV6::findNode(const NetworkV6& network) const noexcept -> UInt32
+{
+    const UInt level = placementOf(network).Level;
+
+    UInt32 node = 0;
+    for (UInt depth = 0; depth < level; depth++) {
+        const Node& current = this->n_nodes[node];
+        const UInt slot = slotAt(network.Address(), depth);
+        if (!testBit(current.Children, slot)) {
+            return kNoMatch;
+        }
+
+        node = current.ChildBase + static_cast<UInt32>(rankOf(current.Children, slot));
+    }
+
+    return node;
+}
+
+} // namespace violet::net::ip::detail
@@ -0,0 +1,654 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/IP/TableImage.h>
+
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#    include <nmmintrin.h>
+#endif
+
+// The sections are used in place, so the image has the same byte order as the tables in memory.
+static_assert(std::endian::native == std::endian::little, "table images are only supported on little-endian targets");
+
+namespace violet::net::ip {
+
+namespace detail {
+
+namespace {
+
+// CRC-32C's polynomial, reversed
+constexpr UInt32 kCastagnoli = 0x82F63B78;
+
+constexpr auto makeCrcTable() noexcept -> Array<UInt32, 256>
+{
+    Array<UInt32, 256> table{ };
+    for (UInt32 i = 0; i < 256; i++) {
+        UInt32 crc = i;
+        for (UInt bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ ((crc & 1) != 0 ? kCastagnoli : 0);
+        }
+
+        table[i] = crc;
+    }
+
+    return table;
+}
+
+constexpr Array<UInt32, 256> kCrcTable = makeCrcTable();
+
+auto crcGeneric(const UInt8* data, UInt size, UInt32 crc) noexcept -> UInt32
+{
+    for (UInt i = 0; i < size; i++) {
+        crc = (crc >> 8) ^ kCrcTable[(crc ^ data[i]) & 0xFF];
+    }
+
+    return crc;
+}
+
+// SSE 4.2's `crc32` computes CRC-32C eight bytes at a time, an order of magnitude faster than the
+// table, which matters since `Verify` reads the whole image.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#    define VIOLET_NET_IMAGE_CRC32 1
+
+__attribute__((target("sse4.2"))) auto crcHardware(const UInt8* data, UInt size, UInt32 crc) noexcept -> UInt32
+{
+    UInt i = 0;
+#    if defined(__x86_64__)
+    UInt64 wide = crc;
+    for (; i + 8 <= size; i += 8) {
+        UInt64 word;
+        std::memcpy(&word, data + i, sizeof(word));
+        wide = _mm_crc32_u64(wide, word);
+    }
+
+    crc = static_cast<UInt32>(wide);
+#    endif
+
+    for (; i < size; i++) {
+        crc = _mm_crc32_u8(crc, data[i]);
+    }
+
+    return crc;
+}
+
+auto hasCrc32() noexcept -> bool
+{
+#    if defined(__SSE4_2__)
+    return true;
+#    else
+    static const bool supported = []() -> bool {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2") != 0;
+    }();
+
+    return supported;
+#    endif
+}
+#else
+#    define VIOLET_NET_IMAGE_CRC32 0
+#endif
+
+} // namespace
+
+auto Crc32c(Span<const UInt8> bytes, UInt32 crc) noexcept -> UInt32
+{
+    crc = ~crc;
+
+#if VIOLET_NET_IMAGE_CRC32
+    if (hasCrc32()) {
+        return ~crcHardware(bytes.data(), bytes.size(), crc);
+    }
+#endif
+
+    return ~crcGeneric(bytes.data(), bytes.size(), crc);
+}
+
+} // namespace detail
+
+namespace {
+
+constexpr Array<char, 8> kMagic{ 'V', 'I', 'O', 'L', 'E', 'T', 'I', 'P' };
+
+struct Header final {
+    Array<char, 8> Magic;
+    UInt32 Version;
+    UInt32 SectionCount;
+    UInt64 FileSize;
+    UInt32 PayloadChecksum;
+    Array<UInt8, 32> Reserved;
+    UInt32 HeaderChecksum; // of the bytes before it, then of the section table
+};
+
+struct Section final {
+    UInt32 Kind;
+    UInt32 Reserved;
+    UInt64 Offset;
+    UInt64 Size;
+    UInt64 Extra;
+};
+
+static_assert(sizeof(Header) == 64 && offsetof(Header, HeaderChecksum) == 60);
+static_assert(sizeof(Section) == 32);
+
+// the kinds of sections; see the format in `TableImage`'s documentation
+constexpr UInt32 kSetV4 = 1;
+constexpr UInt32 kSetV6 = 2;
+constexpr UInt32 kPrefixesV4Tbl24 = 3;
+constexpr UInt32 kPrefixesV4Tbl8 = 4;
+constexpr UInt32 kPrefixesV6Nodes = 5;
+constexpr UInt32 kPrefixesV6Ids = 6;
+constexpr UInt32 kLabelOffsets = 7;
+constexpr UInt32 kLabels = 8;
+
+using IntervalV4 = IPSetV4::Interval;
+using IntervalV6 = IPSetV6::Interval;
+using Node = detail::TreeBitmapV6::Node;
+
+static_assert(sizeof(IntervalV4) == 8 && sizeof(IntervalV6) == 32);
+static_assert(alignof(IntervalV6) <= TableImage::kAlignment && alignof(Node) <= TableImage::kAlignment);
+
+constexpr auto alignUp(UInt64 offset) noexcept -> UInt64
+{
+    return (offset + TableImage::kAlignment - 1) & ~UInt64(TableImage::kAlignment - 1);
+}
+
+template<typename T>
+auto bytesOf(Span<const T> values) noexcept -> Span<const UInt8>
+{
+    return { reinterpret_cast<const UInt8*>(values.data()), values.size_bytes() };
+}
+
+auto headerChecksum(const Header& header, Span<const UInt8> sections) noexcept -> UInt32
+{
+    const UInt32 crc = detail::Crc32c({ reinterpret_cast<const UInt8*>(&header), offsetof(Header, HeaderChecksum) });
+    return detail::Crc32c(sections, crc);
+}
+
+auto systemError() noexcept -> TableImageError
+{
+    return { TableImageError::Status::kSystem, errno };
+}
+
+} // namespace
+
+TableImage::TableImage(Span<const UInt8> bytes, bool mapped) noexcept
+    : n_bytes(bytes)
+    , n_mapped(mapped)
+{
+}
+
+TableImage::TableImage(TableImage&& other) noexcept
+    : n_bytes(std::exchange(other.n_bytes, { }))
+    , n_mapped(std::exchange(other.n_mapped, false))
+    , n_payload(other.n_payload)
+    , n_sections(other.n_sections)
+    , n_extra(other.n_extra)
+{
+}
+
+auto TableImage::operator=(TableImage&& other) noexcept -> TableImage&
+{
+    if (this != &other) {
+        if (this->n_mapped) {
+            ::munmap(const_cast<UInt8*>(this->n_bytes.data()), this->n_bytes.size());
+        }
+
+        this->n_bytes = std::exchange(other.n_bytes, { });
+        this->n_mapped = std::exchange(other.n_mapped, false);
+        this->n_payload = other.n_payload;
+        this->n_sections = other.n_sections;
+        this->n_extra = other.n_extra;
+    }
+
+    return *this;
+}
+
+TableImage::~TableImage()
+{
+    if (this->n_mapped) {
+        ::munmap(const_cast<UInt8*>(this->n_bytes.data()), this->n_bytes.size());
+    }
+}
+
+auto TableImage::Open(Str path) noexcept -> Result<TableImage, TableImageError>
+{
+    const String name(path);
+
+    const int fd = ::open(name.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return Err(systemError());
+    }
+
+    struct stat info{ };
+    if (::fstat(fd, &info) != 0) {
+        const auto error = systemError();
+        ::close(fd);
+
+        return Err(error);
+    }
+
+    if (static_cast<UInt64>(info.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return Err(TableImageError(TableImageError::Status::kTruncated));
+    }
+
+    const auto size = static_cast<UInt>(info.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    const auto error = systemError();
+    ::close(fd);
+
+    if (data == MAP_FAILED) {
+        return Err(error);
+    }
+
+    TableImage image({ static_cast<const UInt8*>(data), size }, true);
+    if (auto result = image.load(); !result) {
+        return Err(result.Error());
+    }
+
+    return image;
+}
+
+auto TableImage::FromBytes(Span<const UInt8> bytes) noexcept -> Result<TableImage, TableImageError>
+{
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) % kAlignment != 0) {
+        return Err(TableImageError(TableImageError::Status::kMisaligned));
+    }
+
+    TableImage image(bytes, false);
+    if (auto result = image.load(); !result) {
+        return Err(result.Error());
+    }
+
+    return image;
+}
+
+auto TableImage::load() noexcept -> Result<void, TableImageError>
+{
+    using Status = TableImageError::Status;
+
+    const Span<const UInt8> bytes = this->n_bytes;
+    if (bytes.size() < sizeof(Header)) {
+        return Err(TableImageError(Status::kTruncated));
+    }
+
+    Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    if (header.Magic != kMagic) {
+        return Err(TableImageError(Status::kBadMagic));
+    }
+
+    if (header.Version != kVersion) {
+        return Err(TableImageError(Status::kUnsupportedVersion));
+    }
+
+    const UInt64 tableEnd = sizeof(Header) + UInt64(header.SectionCount) * sizeof(Section);
+    if (tableEnd > bytes.size()) {
+        return Err(TableImageError(Status::kTruncated));
+    }
+
+    const Span<const UInt8> table = bytes.subspan(sizeof(Header), tableEnd - sizeof(Header));
+    if (headerChecksum(header, table) != header.HeaderChecksum) {
+        return Err(TableImageError(Status::kCorruptHeader));
+    }
+
+    if (header.FileSize != bytes.size()) {
+        return Err(TableImageError(header.FileSize > bytes.size() ? Status::kTruncated : Status::kCorruptHeader));
+    }
+
+    this->n_payload = alignUp(tableEnd);
+    if (this->n_payload > bytes.size()) {
+        return Err(TableImageError(Status::kTruncated));
+    }
+
+    for (UInt i = 0; i < header.SectionCount; i++) {
+        Section section;
+        std::memcpy(&section, table.data() + i * sizeof(Section), sizeof(section));
+
+        // newer kinds are skipped, which is what lets them be added without a new version
+        if (section.Kind == 0 || section.Kind > kSectionKinds) {
+            continue;
+        }
+
+        if (this->n_sections[section.Kind].data() != nullptr || section.Offset % kAlignment != 0
+            || section.Offset < this->n_payload || section.Offset > bytes.size()
+            || section.Size > bytes.size() - section.Offset) {
+            return Err(TableImageError(Status::kInvalidSection));
+        }
+
+        this->n_sections[section.Kind] = bytes.subspan(section.Offset, section.Size);
+        this->n_extra[section.Kind] = section.Extra;
+    }
+
+    const auto has = [this](UInt kind) -> bool { return this->n_sections[kind].data() != nullptr; };
+    const auto sizeOf = [this](UInt kind) -> UInt { return this->n_sections[kind].size(); };
+
+    // the sets have to start with their sentinel, which their search relies on
+    if (has(kSetV4)) {
+        const auto ranges = this->section<IntervalV4>(kSetV4);
+        if (sizeOf(kSetV4) % sizeof(IntervalV4) != 0 || ranges.empty() || ranges[0] != IPSetV4::kSentinel) {
+            return Err(TableImageError(Status::kInvalidSection));
+        }
+    }
+
+    if (has(kSetV6)) {
+        const auto ranges = this->section<IntervalV6>(kSetV6);
+        if (sizeOf(kSetV6) % sizeof(IntervalV6) != 0 || ranges.empty() || ranges[0] != IPSetV6::kSentinel) {
+            return Err(TableImageError(Status::kInvalidSection));
+        }
+    }
+
+    if (has(kPrefixesV4Tbl24) != has(kPrefixesV4Tbl8)
+        || (has(kPrefixesV4Tbl24)
+            && (sizeOf(kPrefixesV4Tbl24) != detail::Dir24Table::kTbl24Size * sizeof(UInt32)
+                || sizeOf(kPrefixesV4Tbl8) % (detail::Dir24Table::kGroupSize * sizeof(UInt32)) != 0))) {
+        return Err(TableImageError(Status::kInvalidSection));
+    }
+
+    if (has(kPrefixesV6Nodes) != has(kPrefixesV6Ids)
+        || (has(kPrefixesV6Nodes)
+            && (sizeOf(kPrefixesV6Nodes) == 0 || sizeOf(kPrefixesV6Nodes) % sizeof(Node) != 0
+                || sizeOf(kPrefixesV6Ids) % sizeof(UInt32) != 0))) {
+        return Err(TableImageError(Status::kInvalidSection));
+    }
+
+    if (has(kLabelOffsets) != has(kLabels)
+        || (has(kLabelOffsets) && (sizeOf(kLabelOffsets) == 0 || sizeOf(kLabelOffsets) % sizeof(UInt32) != 0))) {
+        return Err(TableImageError(Status::kInvalidSection));
+    }
+
+    return { };
+}
+
+template<typename T>
+auto TableImage::section(UInt kind) const noexcept -> Span<const T>
+{
+    const Span<const UInt8> bytes = this->n_sections[kind];
+    return { reinterpret_cast<const T*>(bytes.data()), bytes.size() / sizeof(T) };
+}
+
+auto TableImage::Verify() const noexcept -> Result<void, TableImageError>
+{
+    Header header;
+    std::memcpy(&header, this->n_bytes.data(), sizeof(header));
+
+    if (detail::Crc32c(this->n_bytes.subspan(this->n_payload)) != header.PayloadChecksum) {
+        return Err(TableImageError(TableImageError::Status::kChecksumMismatch));
+    }
+
+    return { };
+}
+
+auto TableImage::SetV4() const noexcept -> Optional<IPSetV4::View>
+{
+    if (this->n_sections[kSetV4].data() == nullptr) {
+        return Nothing;
+    }
+
+    return Some<IPSetV4::View>(this->section<IntervalV4>(kSetV4));
+}
+
+auto TableImage::SetV6() const noexcept -> Optional<IPSetV6::View>
+{
+    if (this->n_sections[kSetV6].data() == nullptr) {
+        return Nothing;
+    }
+
+    return Some<IPSetV6::View>(this->section<IntervalV6>(kSetV6));
+}
+
+auto TableImage::PrefixesV4() const noexcept -> Optional<detail::Dir24Table::View>
+{
+    if (this->n_sections[kPrefixesV4Tbl24].data() == nullptr) {
+        return Nothing;
+    }
+
+    return Some<detail::Dir24Table::View>(this->section<UInt32>(kPrefixesV4Tbl24),
+        this->section<UInt32>(kPrefixesV4Tbl8), static_cast<UInt>(this->n_extra[kPrefixesV4Tbl24]));
+}
+
+auto TableImage::PrefixesV6() const noexcept -> Optional<detail::TreeBitmapV6::View>
+{
+    if (this->n_sections[kPrefixesV6Nodes].data() == nullptr) {
+        return Nothing;
+    }
+
+    return Some<detail::TreeBitmapV6::View>(this->section<Node>(kPrefixesV6Nodes),
+        this->section<UInt32>(kPrefixesV6Ids), static_cast<UInt32>(this->n_extra[kPrefixesV6Ids]),
+        static_cast<UInt>(this->n_extra[kPrefixesV6Nodes]));
+}
+
+auto TableImage::Label(UInt32 id) const noexcept -> Optional<Str>
+{
+    const auto offsets = this->section<UInt32>(kLabelOffsets);
+    const auto text = this->n_sections[kLabels];
+
+    // the offsets are only trusted as far as they stay in the text
+    if (UInt(id) + 1 >= offsets.size() || offsets[id] > offsets[id + 1] || offsets[id + 1] > text.size()) {
+        return Nothing;
+    }
+
+    return Some<Str>(reinterpret_cast<const char*>(text.data()) + offsets[id], offsets[id + 1] - offsets[id]);
+}
+
+auto TableImageWriter::SetV4(IPSetV4::View set) noexcept -> TableImageWriter&
+{
+    this->n_setV4 = Some<IPSetV4::View>(set);
+    return *this;
+}
+
+auto TableImageWriter::SetV6(IPSetV6::View set) noexcept -> TableImageWriter&
+{
+    this->n_setV6 = Some<IPSetV6::View>(set);
+    return *this;
+}
+
+auto TableImageWriter::PrefixesV4(detail::Dir24Table::View table) noexcept -> TableImageWriter&
+{
+    this->n_prefixesV4 = Some<detail::Dir24Table::View>(table);
+    return *this;
+}
+
+auto TableImageWriter::PrefixesV6(detail::TreeBitmapV6::View table) noexcept -> TableImageWriter&
+{
+    this->n_prefixesV6 = Some<detail::TreeBitmapV6::View>(table);
+    return *this;
+}
+
+auto TableImageWriter::Labels(Span<const Str> labels) -> TableImageWriter&
+{
+    this->n_labelOffsets.clear();
+    this->n_labels.clear();
+
+    this->n_labelOffsets.reserve(labels.size() + 1);
+    this->n_labelOffsets.push_back(0);
+    for (Str label: labels) {
+        this->n_labels.append(label);
+        this->n_labelOffsets.push_back(static_cast<UInt32>(this->n_labels.size()));
+    }
+
+    return *this;
+}
+
+auto TableImageWriter::Serialize() const -> Vec<UInt8>
+{
+    struct Pending final {
+        UInt32 Kind;
+        Span<const UInt8> Bytes;
+        UInt64 Extra;
+    };
+
+    Vec<Pending> pending;
+    if (this->n_setV4) {
+        pending.push_back({ kSetV4, bytesOf(this->n_setV4->Data()), 0 });
+    }
+
+    if (this->n_setV6) {
+        pending.push_back({ kSetV6, bytesOf(this->n_setV6->Data()), 0 });
+    }
+
+    if (this->n_prefixesV4) {
+        pending.push_back({ kPrefixesV4Tbl24, bytesOf(this->n_prefixesV4->Tbl24()), this->n_prefixesV4->Size() });
+        pending.push_back({ kPrefixesV4Tbl8, bytesOf(this->n_prefixesV4->Tbl8()), 0 });
+    }
+
+    if (this->n_prefixesV6) {
+        pending.push_back({ kPrefixesV6Nodes, bytesOf(this->n_prefixesV6->Nodes()), this->n_prefixesV6->Size() });
+        pending.push_back({ kPrefixesV6Ids, bytesOf(this->n_prefixesV6->Ids()), this->n_prefixesV6->Default() });
+    }
+
+    if (!this->n_labelOffsets.empty()) {
+        pending.push_back({ kLabelOffsets, bytesOf(Span<const UInt32>(this->n_labelOffsets)), 0 });
+        pending.push_back({ kLabels, { reinterpret_cast<const UInt8*>(this->n_labels.data()), this->n_labels.size() },
+            0 });
+    }
+
+    Vec<Section> sections;
+    const UInt64 payload = alignUp(sizeof(Header) + pending.size() * sizeof(Section));
+
+    UInt64 offset = payload;
+    for (const Pending& section: pending) {
+        sections.push_back({ section.Kind, 0, offset, section.Bytes.size(), section.Extra });
+        offset = alignUp(offset + section.Bytes.size());
+    }
+
+    Vec<UInt8> image(offset, 0);
+    for (UInt i = 0; i < pending.size(); i++) {
+        if (!pending[i].Bytes.empty()) {
+            std::memcpy(image.data() + sections[i].Offset, pending[i].Bytes.data(), pending[i].Bytes.size());
+        }
+    }
+
+    const auto table = bytesOf(Span<const Section>(sections));
+    if (!table.empty()) {
+        std::memcpy(image.data() + sizeof(Header), table.data(), table.size());
+    }
+
+    Header header{ };
+    header.Magic = kMagic;
+    header.Version = TableImage::kVersion;
+    header.SectionCount = static_cast<UInt32>(sections.size());
+    header.FileSize = image.size();
+    header.PayloadChecksum = detail::Crc32c(Span<const UInt8>(image).subspan(payload));
+    header.HeaderChecksum = headerChecksum(header, table);
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    return image;
+}
+
+auto TableImageWriter::WriteTo(Str path) const -> Result<void, TableImageError>
+{
+    const Vec<UInt8> image = this->Serialize();
+
+    const String name(path);
+    String temporary = name + ".XXXXXX";
+
+    const int fd = ::mkstemp(temporary.data());
+    if (fd < 0) {
+        return Err(systemError());
+    }
+
+    const auto fail = [&]() -> TableImageError {
+        const auto error = systemError();
+        ::close(fd);
+        ::unlink(temporary.c_str());
+
+        return error;
+    };
+
+    // `mkstemp` creates the file for the owner only, but images are meant to be shared
+    if (::fchmod(fd, 0644) != 0) {
+        return Err(fail());
+    }
+
+    for (UInt written = 0; written < image.size();) {
+        const ssize_t count = ::write(fd, image.data() + written, image.size() - written);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return Err(fail());
+        }
+
+        written += static_cast<UInt>(count);
+    }
+
+    // the data has to be on disk before the rename is, or a crash could leave `path` empty
+    if (::fsync(fd) != 0) {
+        return Err(fail());
+    }
+
+    if (::close(fd) != 0 || ::rename(temporary.c_str(), name.c_str()) != 0) {
+        const auto error = systemError();
+        ::unlink(temporary.c_str());
+
+        return Err(error);
+    }
+
+    return { };
+}
+
+auto TableImageError::ToString() const noexcept -> String
+{
+    switch (this->Kind()) {
+    case Status::kSystem:
+        return String("table image: ") + std::strerror(this->Errno());
+
+    case Status::kTruncated:
+        return "table image: truncated";
+
+    case Status::kBadMagic:
+        return "table image: not a table image";
+
+    case Status::kUnsupportedVersion:
+        return "table image: unsupported format version";
+
+    case Status::kCorruptHeader:
+        return "table image: header checksum mismatch";
+
+    case Status::kInvalidSection:
+        return "table image: invalid section";
+
+    case Status::kMisaligned:
+        return "table image: data isn't aligned to 64 bytes";
+
+    case Status::kChecksumMismatch:
+        return "table image: checksum mismatch";
+
+    default:
+        VIOLET_UNREACHABLE();
+    }
+}
+
+} // namespace violet::net::ip
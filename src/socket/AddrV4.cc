@@ -19,52 +19,4 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include <violet/Networking/Socket/AddrV4.h>
-#include <violet/Strings.h>
-
-#include <charconv>
-#include <limits>
-
-using violet::Err;
-using violet::net::socket::AddrV4;
-using violet::net::socket::ParseV4Error;
-
-auto AddrV4::FromStr(Str input) noexcept -> Result<AddrV4, ParseV4Error>
-{
-    auto [addr, port] = strings::SplitOnce(input, ':');
-    if (!port.HasValue()) {
-        auto address = ip::AddrV4::FromStr(addr);
-        if (address.Err()) {
-            return Err(ParseV4Error::invalidAddress(VIOLET_MOVE(address.Error())));
-        }
-
-        return AddrV4{ address.Value(), static_cast<UInt16>(0) };
-    }
-
-    auto address = ip::AddrV4::FromStr(addr);
-    if (address.Err()) {
-        return Err(ParseV4Error::invalidAddress(VIOLET_MOVE(address.Error())));
-    }
-
-    UInt64 thePort = 0;
-    auto [ptr, ec] = std::from_chars(port->begin(), port->begin() + port->size(), thePort);
-    if (ec != std::errc{ }) {
-        return Err(ParseV4Error::invalidIntegral(ec));
-    }
-
-    if (thePort > std::numeric_limits<UInt16>::max()) {
-        return Err(ParseV4Error::invalidIntegral(std::errc::invalid_argument));
-    }
-
-    return AddrV4{ address.Value(), static_cast<UInt16>(thePort) };
-}
-
-auto AddrV4::ToString() const noexcept -> String
-{
-    return std::format("{}:{}", this->Address, this->Port);
-}
-
-auto ParseV4Error::ToString() const noexcept -> String
-{
-    return this->n_value.Visit([](const auto& value) -> String { return value.ToString(); });
-}
+#include <violet/Networking/Socket/AddrV4-inl.h>
@@ -19,69 +19,4 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include <violet/Networking/Socket/AddrV6.h>
-#include <violet/Strings.h>
-
-#include <charconv>
-#include <limits>
-
-using violet::Err;
-using violet::net::socket::AddrV6;
-using violet::net::socket::ParseV6Error;
-
-auto AddrV6::FromStr(Str input) noexcept -> Result<AddrV6, ParseV6Error>
-{
-    auto stripBrackets = [](Str input) -> Result<Pair<Str, UInt>, ParseV6Error> {
-        auto closeBracket = input.find(']');
-        if (closeBracket == Str::npos) {
-            return Err(ParseV6Error::invalidBracketPlacement());
-        }
-
-        return std::make_pair(input.substr(1, closeBracket - 1), closeBracket);
-    };
-
-    if (input.front() != '[') {
-        return Err(ParseV6Error::invalidBracketPlacement());
-    }
-
-    auto [ip, closeBracketIdx] = VIOLET_TRY(stripBrackets(input));
-    auto address = ip::AddrV6::FromStr(ip);
-    if (address.Err()) {
-        return Err(ParseV6Error::invalidAddress(VIOLET_MOVE(address.Error())));
-    }
-
-    if (closeBracketIdx + 1 >= input.size()) {
-        return AddrV6{ address.Value(), 0 };
-    }
-
-    if (input[closeBracketIdx + 1] != ':') {
-        return Err(ParseV6Error::invalidBracketPlacement());
-    }
-
-    auto port = input.substr(closeBracketIdx + 2);
-    if (port.empty()) {
-        return AddrV6{ address.Value(), 0 };
-    }
-
-    UInt64 thePort = 0;
-    auto [ptr, ec] = std::from_chars(port.begin(), port.begin() + port.size(), thePort);
-    if (ec != std::errc{ }) {
-        return Err(ParseV6Error::invalidIntegral(ec));
-    }
-
-    if (thePort > std::numeric_limits<UInt16>::max()) {
-        return Err(ParseV6Error::invalidIntegral(std::errc::invalid_argument));
-    }
-
-    return AddrV6{ address.Value(), static_cast<UInt16>(thePort) };
-}
-
-auto AddrV6::ToString() const noexcept -> String
-{
-    return std::format("[{}]:{}", this->Address, this->Port);
-}
-
-auto ParseV6Error::ToString() const noexcept -> String
-{
-    return this->n_value.Visit([](const auto& value) -> String { return value.ToString(); });
-}
+#include <violet/Networking/Socket/AddrV6-inl.h>
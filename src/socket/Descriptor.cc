@@ -0,0 +1,177 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/Socket/Descriptor.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace violet::net::socket {
+
+namespace {
+
+auto toFamily(SocketAddress::Type family) noexcept -> int
+{
+    return family == SocketAddress::Type::V4 ? AF_INET : AF_INET6;
+}
+
+// `getsockname` and `getpeername` both fill in a `sockaddr` of the same shape
+template<typename Fn>
+auto queryAddress(int fd, Fn call) noexcept -> Result<SocketAddress, SocketError>
+{
+    sockaddr_storage storage{ };
+    socklen_t length = sizeof(storage);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* address = reinterpret_cast<sockaddr*>(&storage);
+    if (call(fd, address, &length) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    if (auto result = SocketAddress::FromSockAddr(address, length)) {
+        return result.Unwrap();
+    }
+
+    return Err(SocketError(EAFNOSUPPORT));
+}
+
+} // namespace
+
+auto SocketError::Last() noexcept -> SocketError
+{
+    return SocketError(errno);
+}
+
+auto SocketError::WouldBlock() const noexcept -> bool
+{
+    // NOLINTNEXTLINE(misc-redundant-expression): they are the same value on Linux, but not everywhere
+    return this->n_errno == EAGAIN || this->n_errno == EWOULDBLOCK;
+}
+
+auto SocketError::ToString() const noexcept -> String
+{
+    return std::strerror(this->n_errno);
+}
+
+auto Descriptor::Open(SocketAddress::Type family, int type, int protocol) noexcept -> Result<Descriptor, SocketError>
+{
+#ifdef SOCK_CLOEXEC
+    const int fd = ::socket(toFamily(family), type | SOCK_CLOEXEC, protocol);
+    if (fd < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return Descriptor(fd);
+#else
+    // macOS has no `SOCK_CLOEXEC`, so there's a window where a concurrent `exec` inherits the socket
+    Descriptor descriptor(::socket(toFamily(family), type, protocol));
+    if (!descriptor.Valid() || ::fcntl(descriptor.Get(), F_SETFD, FD_CLOEXEC) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return descriptor;
+#endif
+}
+
+void Descriptor::Close() noexcept
+{
+    if (this->n_fd >= 0) {
+        ::close(std::exchange(this->n_fd, -1));
+    }
+}
+
+auto Descriptor::Bind(const SocketAddress& address) const noexcept -> Result<void, SocketError>
+{
+    sockaddr_storage storage{ };
+    const socklen_t length = address.ToSockAddr(storage);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (::bind(this->n_fd, reinterpret_cast<const sockaddr*>(&storage), length) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return { };
+}
+
+auto Descriptor::Connect(const SocketAddress& address) const noexcept -> Result<void, SocketError>
+{
+    sockaddr_storage storage{ };
+    const socklen_t length = address.ToSockAddr(storage);
+
+    // a `connect` interrupted by a signal carries on in the background, so it can't just be retried
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (::connect(this->n_fd, reinterpret_cast<const sockaddr*>(&storage), length) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return { };
+}
+
+auto Descriptor::LocalAddress() const noexcept -> Result<SocketAddress, SocketError>
+{
+    return queryAddress(this->n_fd, ::getsockname);
+}
+
+auto Descriptor::PeerAddress() const noexcept -> Result<SocketAddress, SocketError>
+{
+    return queryAddress(this->n_fd, ::getpeername);
+}
+
+auto Descriptor::SetNonBlocking(bool enabled) const noexcept -> Result<void, SocketError>
+{
+    const int flags = ::fcntl(this->n_fd, F_GETFL);
+    if (flags < 0) {
+        return Err(SocketError::Last());
+    }
+
+    const int updated = enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    if (updated != flags && ::fcntl(this->n_fd, F_SETFL, updated) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return { };
+}
+
+auto Descriptor::SetOption(int level, int name, int value) const noexcept -> Result<void, SocketError>
+{
+    if (::setsockopt(this->n_fd, level, name, &value, sizeof(value)) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return { };
+}
+
+auto Descriptor::GetOption(int level, int name) const noexcept -> Result<int, SocketError>
+{
+    int value = 0;
+    socklen_t length = sizeof(value);
+    if (::getsockopt(this->n_fd, level, name, &value, &length) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return value;
+}
+
+} // namespace violet::net::socket
@@ -0,0 +1,263 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/Socket/IoUring.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <utility>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace violet::net::socket::detail {
+
+namespace {
+
+auto setup(UInt32 entries, io_uring_params& params) noexcept -> int
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+auto enter(int fd, unsigned submit, unsigned waitFor, unsigned flags, void* arg, UInt argSize) noexcept -> int
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, submit, waitFor, flags, arg, argSize));
+}
+
+auto mapRing(int fd, UInt size, off_t offset) noexcept -> void*
+{
+    void* ring = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    return ring == MAP_FAILED ? nullptr : ring;
+}
+
+template<typename T>
+auto at(void* ring, UInt32 offset) noexcept -> T*
+{
+    return reinterpret_cast<T*>(static_cast<UInt8*>(ring) + offset); // NOLINT
+}
+
+} // namespace
+
+auto IoUring::Create(UInt32 entries) noexcept -> Result<IoUring, SocketError>
+{
+    io_uring_params params{ };
+
+    // fewer wakeups and no task work run from interrupts; both need a recent kernel, so fall back
+    // to a plain ring if it rejects them. The ring starts out disabled so that it's bound to the thread
+    // that enables it in the first `Enter`, rather than to this one.
+    params.flags = IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN | IORING_SETUP_SINGLE_ISSUER
+        | IORING_SETUP_DEFER_TASKRUN | IORING_SETUP_R_DISABLED;
+
+    IoUring ring;
+    ring.n_fd = setup(entries, params);
+    if (ring.n_fd < 0 && errno == EINVAL) {
+        params = io_uring_params{ };
+        ring.n_fd = setup(entries, params);
+    }
+
+    if (ring.n_fd < 0) {
+        return Err(SocketError::Last());
+    }
+
+    ring.n_enterFd = ring.n_fd;
+    ring.n_disabled = (params.flags & IORING_SETUP_R_DISABLED) != 0;
+
+    ring.n_sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    ring.n_cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+        ring.n_sqRingSize = ring.n_cqRingSize = std::max(ring.n_sqRingSize, ring.n_cqRingSize);
+    }
+
+    ring.n_sqRing = mapRing(ring.n_fd, ring.n_sqRingSize, IORING_OFF_SQ_RING);
+    if (ring.n_sqRing == nullptr) {
+        return Err(SocketError::Last());
+    }
+
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+        ring.n_cqRing = ring.n_sqRing;
+    } else if (ring.n_cqRing = mapRing(ring.n_fd, ring.n_cqRingSize, IORING_OFF_CQ_RING); ring.n_cqRing == nullptr) {
+        return Err(SocketError::Last());
+    }
+
+    ring.n_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    ring.n_sqes = static_cast<io_uring_sqe*>(mapRing(ring.n_fd, ring.n_sqesSize, IORING_OFF_SQES));
+    if (ring.n_sqes == nullptr) {
+        return Err(SocketError::Last());
+    }
+
+    ring.n_sqHead = at<unsigned>(ring.n_sqRing, params.sq_off.head);
+    ring.n_sqTailShared = at<unsigned>(ring.n_sqRing, params.sq_off.tail);
+    ring.n_sqTail = *ring.n_sqTailShared;
+    ring.n_sqMask = *at<unsigned>(ring.n_sqRing, params.sq_off.ring_mask);
+    ring.n_sqEntries = params.sq_entries;
+
+    // entries are always taken in order, so the indirection array is the identity
+    auto* array = at<unsigned>(ring.n_sqRing, params.sq_off.array);
+    for (unsigned i = 0; i < params.sq_entries; i++) {
+        array[i] = i;
+    }
+
+    ring.n_cqHead = at<unsigned>(ring.n_cqRing, params.cq_off.head);
+    ring.n_cqTail = at<unsigned>(ring.n_cqRing, params.cq_off.tail);
+    ring.n_cqMask = *at<unsigned>(ring.n_cqRing, params.cq_off.ring_mask);
+    ring.n_cqes = at<io_uring_cqe>(ring.n_cqRing, params.cq_off.cqes);
+
+    return ring;
+}
+
+IoUring::IoUring(IoUring&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+auto IoUring::operator=(IoUring&& other) noexcept -> IoUring&
+{
+    if (this != &other) {
+        this->unmap();
+
+        this->n_fd = std::exchange(other.n_fd, -1);
+        this->n_enterFd = std::exchange(other.n_enterFd, -1);
+        this->n_enterFlags = other.n_enterFlags;
+        this->n_disabled = other.n_disabled;
+        this->n_enters = other.n_enters;
+        this->n_sqRing = std::exchange(other.n_sqRing, nullptr);
+        this->n_sqRingSize = other.n_sqRingSize;
+        this->n_cqRing = std::exchange(other.n_cqRing, nullptr);
+        this->n_cqRingSize = other.n_cqRingSize;
+        this->n_sqes = std::exchange(other.n_sqes, nullptr);
+        this->n_sqesSize = other.n_sqesSize;
+        this->n_sqHead = other.n_sqHead;
+        this->n_sqTailShared = other.n_sqTailShared;
+        this->n_sqTail = other.n_sqTail;
+        this->n_sqMask = other.n_sqMask;
+        this->n_sqEntries = other.n_sqEntries;
+        this->n_cqHead = other.n_cqHead;
+        this->n_cqTail = other.n_cqTail;
+        this->n_cqMask = other.n_cqMask;
+        this->n_cqes = other.n_cqes;
+    }
+
+    return *this;
+}
+
+IoUring::~IoUring()
+{
+    this->unmap();
+}
+
+void IoUring::unmap() noexcept
+{
+    if (this->n_sqes != nullptr) {
+        ::munmap(this->n_sqes, this->n_sqesSize);
+    }
+
+    if (this->n_cqRing != nullptr && this->n_cqRing != this->n_sqRing) {
+        ::munmap(this->n_cqRing, this->n_cqRingSize);
+    }
+
+    if (this->n_sqRing != nullptr) {
+        ::munmap(this->n_sqRing, this->n_sqRingSize);
+    }
+
+    // closing the ring cancels whatever is still in flight
+    if (this->n_fd >= 0) {
+        ::close(this->n_fd);
+    }
+
+    this->n_sqes = nullptr;
+    this->n_cqRing = this->n_sqRing = nullptr;
+    this->n_fd = -1;
+}
+
+auto IoUring::Enter(UInt32 waitFor, Optional<std::chrono::nanoseconds> timeout) noexcept
+    -> Result<UInt32, SocketError>
+{
+    if (this->n_disabled) {
+        if (auto enabled = this->enable(); enabled.Err()) {
+            return Err(enabled.Error());
+        }
+    }
+
+    const unsigned submit = this->Unsubmitted();
+    std::atomic_ref(*this->n_sqTailShared).store(this->n_sqTail, std::memory_order_release);
+
+    unsigned flags = this->n_enterFlags | (waitFor > 0 ? IORING_ENTER_GETEVENTS : 0);
+    __kernel_timespec ts{ };
+    io_uring_getevents_arg arg{ };
+    void* argp = nullptr;
+    UInt argSize = 0;
+
+    if (timeout) {
+        ts.tv_sec = timeout->count() / 1'000'000'000;
+        ts.tv_nsec = timeout->count() % 1'000'000'000;
+
+        arg.sigmask_sz = _NSIG / 8;
+        arg.ts = reinterpret_cast<UInt64>(&ts); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        flags |= IORING_ENTER_EXT_ARG;
+        argp = &arg;
+        argSize = sizeof(arg);
+    }
+
+    this->n_enters++;
+    const int submitted = enter(this->n_enterFd, submit, waitFor, flags, argp, argSize);
+    if (submitted < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt32>(submitted);
+}
+
+auto IoUring::enable() noexcept -> Result<void, SocketError>
+{
+    // with `IORING_SETUP_SINGLE_ISSUER`, this makes the calling thread the ring's only submitter
+    if (auto enabled = this->Register(IORING_REGISTER_ENABLE_RINGS, nullptr, 0); enabled.Err()) {
+        return Err(enabled.Error());
+    }
+
+    this->n_disabled = false;
+
+    // not having to look the ring up on every `io_uring_enter` is worth a few percent; it's fine if the
+    // kernel doesn't support it. The registration belongs to this thread, like the ring now does.
+    io_uring_rsrc_update update{ };
+    update.offset = ~0U;
+    update.data = static_cast<UInt64>(this->n_fd);
+    if (this->Register(IORING_REGISTER_RING_FDS, &update, 1).Ok()) {
+        this->n_enterFd = static_cast<int>(update.offset);
+        this->n_enterFlags = IORING_ENTER_REGISTERED_RING;
+    }
+
+    return { };
+}
+
+auto IoUring::Register(unsigned opcode, void* arg, unsigned count) const noexcept -> Result<int, SocketError>
+{
+    const auto result = static_cast<int>(::syscall(__NR_io_uring_register, this->n_fd, opcode, arg, count));
+    if (result < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return result;
+}
+
+} // namespace violet::net::socket::detail
@@ -0,0 +1,667 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/Socket/Reactor.h>
+
+#include <cerrno>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+
+namespace violet::net::socket {
+
+namespace {
+
+// what a completion is for, which is kept in the top byte of its `user_data`; the rest is the
+// connection id, listener descriptor or adoption key that it's about
+enum struct Op : UInt8 {
+    kAccept = 1,
+    kRecv,
+    kSend,
+    kShutdown,
+    kClose,
+    kAdopt
+};
+
+constexpr UInt64 kValueMask = (UInt64(1) << 56) - 1;
+constexpr UInt16 kBufferGroup = 0;
+
+constexpr auto pack(Op op, UInt64 value) noexcept -> UInt64
+{
+    return (static_cast<UInt64>(op) << 56) | (value & kValueMask);
+}
+
+auto mapAnonymous(UInt size) noexcept -> void*
+{
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return memory == MAP_FAILED ? nullptr : memory;
+}
+
+} // namespace
+
+struct Reactor::Slot final {
+    Vec<UInt8> Sending; // what the send in flight is sending, from `SendOffset` on
+    UInt SendOffset = 0;
+    Vec<UInt8> Queued; // what was sent while another send was in flight
+    UInt32 InFlight = 0; // operations that will still complete on this slot
+
+    bool Open = false; // the slot holds a connection, until its file is closed
+    bool Receiving = false;
+    bool SendInFlight = false;
+    bool Closing = false; // `Close` was called
+    bool ShutDown = false;
+    bool Closed = false; // `OnClose` was called
+
+    Optional<SocketAddress> Peer;
+};
+
+struct Reactor::Adoption final {
+    Descriptor Fd;
+    int Index; // the descriptor going in, then the index that the kernel put it at
+    Optional<SocketAddress> Peer;
+};
+
+// the reactor's own descriptor of a listener, which its accepts are armed on, so that closing the
+// listener doesn't stop them and its number can't be reused for another socket; a single accept puts the
+// address of the connection it accepts here too
+struct Reactor::Acceptor final {
+    Descriptor Fd;
+    sockaddr_storage Address;
+    socklen_t Length;
+};
+
+auto Reactor::Create(Handler& handler) noexcept -> Result<Reactor, SocketError>
+{
+    return Reactor::Create(handler, Options{ });
+}
+
+auto Reactor::Create(Handler& handler, const Options& options) noexcept -> Result<Reactor, SocketError>
+{
+    const bool powerOfTwo = (options.BufferCount & (options.BufferCount - 1)) == 0;
+    if (options.BufferCount == 0 || options.BufferCount > 32768 || !powerOfTwo || options.BufferSize == 0
+        || options.MaxConnections == 0) {
+        return Err(SocketError(EINVAL));
+    }
+
+    auto created = detail::IoUring::Create(options.Entries);
+    if (created.Err()) {
+        return Err(created.Error());
+    }
+
+    auto ring = std::move(created.Value());
+
+    // connections only ever live in the file table, which starts out empty
+    io_uring_rsrc_register files{ };
+    files.nr = options.MaxConnections;
+    files.flags = IORING_RSRC_REGISTER_SPARSE;
+    if (auto result = ring.Register(IORING_REGISTER_FILES2, &files, sizeof(files)); result.Err()) {
+        return Err(result.Error());
+    }
+
+    Reactor reactor(handler, std::move(ring), options);
+
+    reactor.n_bufferRing = static_cast<io_uring_buf*>(mapAnonymous(options.BufferCount * sizeof(io_uring_buf)));
+    reactor.n_buffers = static_cast<UInt8*>(mapAnonymous(UInt(options.BufferCount) * options.BufferSize));
+    if (reactor.n_bufferRing == nullptr || reactor.n_buffers == nullptr) {
+        return Err(SocketError::Last());
+    }
+
+    io_uring_buf_reg buffers{ };
+    buffers.ring_addr = reinterpret_cast<UInt64>(reactor.n_bufferRing); // NOLINT
+    buffers.ring_entries = options.BufferCount;
+    buffers.bgid = kBufferGroup;
+    if (auto result = reactor.n_ring.Register(IORING_REGISTER_PBUF_RING, &buffers, 1); result.Err()) {
+        return Err(result.Error());
+    }
+
+    for (UInt32 i = 0; i < options.BufferCount; i++) {
+        reactor.recycle(static_cast<UInt16>(i));
+    }
+
+    reactor.publishBuffers();
+    return reactor;
+}
+
+Reactor::Reactor(Handler& handler, detail::IoUring ring, const Options& options) noexcept
+    : n_handler(&handler)
+    , n_ring(std::move(ring))
+    , n_options(options)
+    , n_slots(options.MaxConnections)
+{
+}
+
+Reactor::Reactor(Reactor&& other) noexcept
+    : n_handler(other.n_handler)
+    , n_ring(std::move(other.n_ring))
+    , n_options(other.n_options)
+    , n_stats(other.n_stats)
+    , n_stopped(other.n_stopped)
+    , n_open(other.n_open)
+    , n_slots(std::move(other.n_slots))
+    , n_pausedListeners(std::move(other.n_pausedListeners))
+    , n_adoptions(std::move(other.n_adoptions))
+    , n_nextAdoption(other.n_nextAdoption)
+    , n_listeners(std::move(other.n_listeners))
+    , n_backlog(std::move(other.n_backlog))
+    , n_bufferRing(std::exchange(other.n_bufferRing, nullptr))
+    , n_buffers(std::exchange(other.n_buffers, nullptr))
+    , n_bufferTail(other.n_bufferTail)
+{
+}
+
+auto Reactor::operator=(Reactor&& other) noexcept -> Reactor&
+{
+    if (this != &other) {
+        this->teardown();
+
+        this->n_handler = other.n_handler;
+        this->n_ring = std::move(other.n_ring);
+        this->n_options = other.n_options;
+        this->n_stats = other.n_stats;
+        this->n_stopped = other.n_stopped;
+        this->n_open = other.n_open;
+        this->n_slots = std::move(other.n_slots);
+        this->n_pausedListeners = std::move(other.n_pausedListeners);
+        this->n_adoptions = std::move(other.n_adoptions);
+        this->n_nextAdoption = other.n_nextAdoption;
+        this->n_listeners = std::move(other.n_listeners);
+        this->n_backlog = std::move(other.n_backlog);
+        this->n_bufferRing = std::exchange(other.n_bufferRing, nullptr);
+        this->n_buffers = std::exchange(other.n_buffers, nullptr);
+        this->n_bufferTail = other.n_bufferTail;
+    }
+
+    return *this;
+}
+
+Reactor::~Reactor()
+{
+    this->teardown();
+}
+
+void Reactor::teardown() noexcept
+{
+    // the ring goes first, so that nothing in flight refers to the buffers, adoptions or listeners anymore
+    {
+        auto ring = std::move(this->n_ring);
+    }
+
+    if (this->n_buffers != nullptr) {
+        ::munmap(this->n_buffers, UInt(this->n_options.BufferCount) * this->n_options.BufferSize);
+    }
+
+    if (this->n_bufferRing != nullptr) {
+        ::munmap(this->n_bufferRing, this->n_options.BufferCount * sizeof(io_uring_buf));
+    }
+
+    this->n_buffers = nullptr;
+    this->n_bufferRing = nullptr;
+    this->n_adoptions.clear();
+    this->n_listeners.clear();
+    this->n_backlog.clear();
+}
+
+auto Reactor::Listen(const TcpListener& listener) noexcept -> Result<void, SocketError>
+{
+    if (!listener.AsDescriptor().Valid()) {
+        return Err(SocketError(EBADF));
+    }
+
+    Descriptor fd(::fcntl(listener.AsDescriptor().Get(), F_DUPFD_CLOEXEC, 0));
+    if (!fd.Valid()) {
+        return Err(SocketError::Last());
+    }
+
+    const int key = fd.Get();
+    this->n_listeners.emplace(key, std::make_unique<Acceptor>(Acceptor{ std::move(fd), { }, 0 }));
+    this->armAccept(key);
+
+    return { };
+}
+
+void Reactor::Adopt(TcpStream stream) noexcept
+{
+    auto peer = stream.PeerAddress();
+    auto adoption = std::make_unique<Adoption>(Adoption{ std::move(stream).IntoDescriptor(), -1,
+        peer.Ok() ? Optional<SocketAddress>(peer.Value()) : Optional<SocketAddress>(Nothing) });
+    adoption->Index = adoption->Fd.Get();
+
+    const UInt64 key = this->n_nextAdoption++ & kValueMask;
+
+    io_uring_sqe* sqe = this->nextSqe();
+    sqe->opcode = IORING_OP_FILES_UPDATE;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<UInt64>(&adoption->Index); // NOLINT
+    sqe->len = 1;
+    sqe->off = IORING_FILE_INDEX_ALLOC;
+    sqe->user_data = pack(Op::kAdopt, key);
+
+    this->n_adoptions.emplace(key, std::move(adoption));
+}
+
+void Reactor::Send(ConnectionId id, Span<const UInt8> data) noexcept
+{
+    if (id >= this->n_slots.size()) {
+        return;
+    }
+
+    Slot& slot = this->n_slots[id];
+    if (!slot.Open || slot.Closing || slot.Closed || data.empty()) {
+        return;
+    }
+
+    slot.Queued.insert(slot.Queued.end(), data.begin(), data.end());
+    this->flushSend(id);
+}
+
+void Reactor::Close(ConnectionId id) noexcept
+{
+    if (id >= this->n_slots.size()) {
+        return;
+    }
+
+    Slot& slot = this->n_slots[id];
+    if (!slot.Open || slot.Closing || slot.Closed) {
+        return;
+    }
+
+    slot.Closing = true;
+    if (!slot.SendInFlight) {
+        this->flushSend(id);
+    }
+}
+
+auto Reactor::Poll(Optional<std::chrono::nanoseconds> timeout) noexcept -> Result<UInt, SocketError>
+{
+    this->publishBuffers();
+    this->submitBacklog();
+
+    if (auto entered = this->n_ring.Enter(1, timeout); entered.Err()) {
+        // `EBUSY` means that completions are backed up, which reaping them below sorts out
+        const int error = entered.Error().Errno();
+        if (error != ETIME && error != EINTR && error != EBUSY) {
+            return Err(entered.Error());
+        }
+    }
+
+    const UInt handled = this->n_ring.Drain([this](const io_uring_cqe& cqe) { this->dispatch(cqe); });
+    this->n_stats.Completions += handled;
+
+    return handled;
+}
+
+auto Reactor::Run() noexcept -> Result<void, SocketError>
+{
+    this->n_stopped = false;
+    while (!this->n_stopped) {
+        if (auto result = this->Poll(); result.Err()) {
+            return Err(result.Error());
+        }
+    }
+
+    return { };
+}
+
+auto Reactor::nextSqe() noexcept -> io_uring_sqe*
+{
+    // once an entry is in the backlog, the ones after it go there too so that they're submitted in order
+    if (this->n_backlog.empty()) {
+        io_uring_sqe* sqe = this->n_ring.NextSqe();
+        if (sqe == nullptr) {
+            // the queue is full, so submit what's in it without waiting for anything
+            this->publishBuffers();
+            (void)this->n_ring.Enter(0);
+
+            sqe = this->n_ring.NextSqe();
+        }
+
+        if (sqe != nullptr) {
+            return sqe;
+        }
+    }
+
+    // the kernel didn't take the queue, such as with `EBUSY` while completions are backed up, which only
+    // reaping them in `Poll` sorts out; the handlers can't be called from here, so the entry waits
+    return &this->n_backlog.emplace_back();
+}
+
+void Reactor::submitBacklog() noexcept
+{
+    UInt moved = 0;
+    while (moved < this->n_backlog.size()) {
+        io_uring_sqe* sqe = this->n_ring.NextSqe();
+        if (sqe == nullptr) {
+            // what doesn't fit waits for the next `Poll` if the kernel doesn't take the queue either
+            if (auto entered = this->n_ring.Enter(0); entered.Err() || entered.Value() == 0) {
+                break;
+            }
+
+            continue;
+        }
+
+        *sqe = this->n_backlog[moved++];
+    }
+
+    this->n_backlog.erase(this->n_backlog.begin(), this->n_backlog.begin() + static_cast<std::ptrdiff_t>(moved));
+}
+
+void Reactor::armAccept(int listener) noexcept
+{
+    io_uring_sqe* sqe = this->nextSqe();
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = listener;
+    sqe->file_index = IORING_FILE_INDEX_ALLOC;
+    sqe->user_data = pack(Op::kAccept, static_cast<UInt32>(listener));
+
+    if (!this->n_options.PeerAddresses) {
+        sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+        return;
+    }
+
+    // every accept would write its address to the same place, so there's one in flight per listener
+    Acceptor* acceptor = this->n_listeners.at(listener).get();
+    acceptor->Length = sizeof(acceptor->Address);
+    sqe->addr = reinterpret_cast<UInt64>(&acceptor->Address); // NOLINT
+    sqe->addr2 = reinterpret_cast<UInt64>(&acceptor->Length); // NOLINT
+}
+
+void Reactor::armRecv(ConnectionId id) noexcept
+{
+    Slot& slot = this->n_slots[id];
+    slot.Receiving = true;
+    slot.InFlight++;
+
+    io_uring_sqe* sqe = this->nextSqe();
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = static_cast<int>(id);
+    sqe->flags = IOSQE_FIXED_FILE | IOSQE_BUFFER_SELECT;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->buf_group = kBufferGroup;
+    sqe->user_data = pack(Op::kRecv, id);
+}
+
+void Reactor::flushSend(ConnectionId id) noexcept
+{
+    Slot& slot = this->n_slots[id];
+    if (slot.SendInFlight || slot.Closed) {
+        return;
+    }
+
+    if (slot.SendOffset >= slot.Sending.size()) {
+        slot.Sending.clear();
+        slot.SendOffset = 0;
+        std::swap(slot.Sending, slot.Queued);
+    }
+
+    if (slot.Sending.empty()) {
+        if (slot.Closing) {
+            this->shutdown(id);
+        }
+
+        return;
+    }
+
+    slot.SendInFlight = true;
+    slot.InFlight++;
+
+    io_uring_sqe* sqe = this->nextSqe();
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = static_cast<int>(id);
+    sqe->flags = IOSQE_FIXED_FILE;
+    sqe->addr = reinterpret_cast<UInt64>(slot.Sending.data() + slot.SendOffset); // NOLINT
+    sqe->len = static_cast<UInt32>(slot.Sending.size() - slot.SendOffset);
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = pack(Op::kSend, id);
+}
+
+void Reactor::shutdown(ConnectionId id) noexcept
+{
+    Slot& slot = this->n_slots[id];
+    if (slot.ShutDown) {
+        return;
+    }
+
+    slot.ShutDown = true;
+    slot.InFlight++;
+
+    // this ends the multishot receive, whose last completion closes the connection
+    io_uring_sqe* sqe = this->nextSqe();
+    sqe->opcode = IORING_OP_SHUTDOWN;
+    sqe->fd = static_cast<int>(id);
+    sqe->flags = IOSQE_FIXED_FILE;
+    sqe->len = SHUT_RDWR;
+    sqe->user_data = pack(Op::kShutdown, id);
+}
+
+auto Reactor::PeerAddress(ConnectionId id) const noexcept -> Optional<SocketAddress>
+{
+    if (id >= this->n_slots.size() || !this->n_slots[id].Open) {
+        return Nothing;
+    }
+
+    return this->n_slots[id].Peer;
+}
+
+void Reactor::open(ConnectionId id, Optional<SocketAddress> peer) noexcept
+{
+    VIOLET_DEBUG_ASSERT(id < this->n_slots.size(), "the kernel allocated a file outside of the table");
+
+    Slot& slot = this->n_slots[id];
+    VIOLET_DEBUG_ASSERT(!slot.Open, "the kernel allocated a file that is still in use");
+
+    slot.Sending.clear();
+    slot.SendOffset = 0;
+    slot.Queued.clear();
+    slot.InFlight = 0;
+    slot.Open = true;
+    slot.Receiving = slot.SendInFlight = slot.Closing = slot.ShutDown = slot.Closed = false;
+    slot.Peer = std::move(peer);
+
+    this->n_open++;
+    this->armRecv(id);
+    this->n_handler->OnOpen(*this, id);
+}
+
+void Reactor::finish(ConnectionId id, Optional<SocketError> error) noexcept
+{
+    Slot& slot = this->n_slots[id];
+    if (!slot.Open || slot.Closed) {
+        return;
+    }
+
+    slot.Closed = true;
+    slot.Queued.clear();
+    if (slot.Receiving) {
+        this->shutdown(id);
+    }
+
+    this->n_handler->OnClose(*this, id, std::move(error));
+}
+
+void Reactor::release(ConnectionId id) noexcept
+{
+    Slot& slot = this->n_slots[id];
+    if (!slot.Open || !slot.Closed || slot.InFlight > 0) {
+        return;
+    }
+
+    slot.Open = false;
+    slot.Sending = Vec<UInt8>{ };
+    slot.Queued = Vec<UInt8>{ };
+    this->n_open--;
+
+    io_uring_sqe* sqe = this->nextSqe();
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->file_index = id + 1;
+    sqe->user_data = pack(Op::kClose, id);
+
+    // there's room in the table again for the listeners that ran out of it
+    for (int listener: std::exchange(this->n_pausedListeners, { })) {
+        this->armAccept(listener);
+    }
+}
+
+void Reactor::recycle(UInt16 buffer) noexcept
+{
+    // only the fields are written, since the ring's tail overlaps the reserved field of the first entry
+    io_uring_buf& entry = this->n_bufferRing[this->n_bufferTail & (this->n_options.BufferCount - 1)];
+    entry.addr = reinterpret_cast<UInt64>(this->n_buffers + (UInt(buffer) * this->n_options.BufferSize)); // NOLINT
+    entry.len = this->n_options.BufferSize;
+    entry.bid = buffer;
+
+    this->n_bufferTail++;
+}
+
+void Reactor::publishBuffers() noexcept
+{
+    // this is `io_uring_buf_ring::tail`; the struct isn't used since its flexible array member is laid
+    // out differently by C++ compilers
+    std::atomic_ref(this->n_bufferRing[0].resv).store(this->n_bufferTail, std::memory_order_release);
+}
+
+void Reactor::dispatch(const io_uring_cqe& cqe) noexcept
+{
+    const auto op = static_cast<Op>(cqe.user_data >> 56);
+    const UInt64 value = cqe.user_data & kValueMask;
+    const bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+
+    switch (op) {
+    case Op::kAccept: {
+        const auto listener = static_cast<int>(value);
+        if (cqe.res >= 0) {
+            Optional<SocketAddress> peer = Nothing;
+            if (this->n_options.PeerAddresses) {
+                const Acceptor& acceptor = *this->n_listeners.at(listener);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                peer = SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&acceptor.Address),
+                    acceptor.Length);
+            }
+
+            this->n_stats.Accepted++;
+            this->open(static_cast<ConnectionId>(cqe.res), std::move(peer));
+        }
+
+        if (more) {
+            break;
+        }
+
+        // the accept is over: either it was a single accept, the completion queue overflowed, which is
+        // fine, the table is full, which waits until a connection is released, or the listener failed
+        if (cqe.res >= 0 || cqe.res == -EINTR || cqe.res == -ECONNABORTED) {
+            this->armAccept(listener);
+        } else if (cqe.res == -ENFILE) {
+            this->n_pausedListeners.push_back(listener);
+        } else {
+            this->n_listeners.erase(listener);
+            this->n_handler->OnAcceptError(*this, SocketError(-cqe.res));
+        }
+
+        break;
+    }
+
+    case Op::kRecv: {
+        const auto id = static_cast<ConnectionId>(value);
+        Slot& slot = this->n_slots[id];
+        if (!more) {
+            slot.Receiving = false;
+            slot.InFlight--;
+        }
+
+        if (cqe.res > 0) {
+            const auto buffer = static_cast<UInt16>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+            this->n_stats.Received++;
+
+            if (!slot.Closed) {
+                this->n_handler->OnData(
+                    *this, id, Span<const UInt8>(this->n_buffers + (UInt(buffer) * this->n_options.BufferSize),
+                                   static_cast<UInt>(cqe.res)));
+            }
+
+            this->recycle(buffer);
+            if (!more && !slot.Closed) {
+                this->armRecv(id);
+            }
+        } else if (cqe.res == -ENOBUFS && !slot.Closed) {
+            // the kernel filled every published buffer, for completions that weren't handled yet; they're
+            // recycled as they are, and published before anything is submitted, the re-armed receive too
+            this->armRecv(id);
+        } else {
+            if ((cqe.flags & IORING_CQE_F_BUFFER) != 0) {
+                this->recycle(static_cast<UInt16>(cqe.flags >> IORING_CQE_BUFFER_SHIFT));
+            }
+
+            this->finish(id, cqe.res == 0 ? Optional<SocketError>(Nothing) : Some<SocketError>(-cqe.res));
+        }
+
+        this->release(id);
+        break;
+    }
+
+    case Op::kSend: {
+        const auto id = static_cast<ConnectionId>(value);
+        Slot& slot = this->n_slots[id];
+        slot.SendInFlight = false;
+        slot.InFlight--;
+
+        if (cqe.res < 0) {
+            this->finish(id, Some<SocketError>(-cqe.res));
+        } else {
+            slot.SendOffset += static_cast<UInt>(cqe.res);
+            this->flushSend(id);
+        }
+
+        this->release(id);
+        break;
+    }
+
+    case Op::kShutdown: {
+        const auto id = static_cast<ConnectionId>(value);
+        this->n_slots[id].InFlight--;
+        this->release(id);
+
+        break;
+    }
+
+    case Op::kClose:
+        break;
+
+    case Op::kAdopt: {
+        auto it = this->n_adoptions.find(value);
+        if (it == this->n_adoptions.end()) {
+            break;
+        }
+
+        // the table holds its own reference to the socket, so the descriptor is closed either way
+        const int index = it->second->Index;
+        auto peer = std::move(it->second->Peer);
+        this->n_adoptions.erase(it);
+
+        if (cqe.res == 1) {
+            this->open(static_cast<ConnectionId>(index), std::move(peer));
+        }
+
+        break;
+    }
+    }
+}
+
+} // namespace violet::net::socket
@@ -0,0 +1,155 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/Socket/TcpListener.h>
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace violet::net::socket {
+
+namespace {
+
+// Returns a socket that `accept` made non-blocking and close-on-exec, or `-1`.
+auto acceptNonBlocking(int listener, sockaddr_storage& storage, socklen_t& length) noexcept -> int
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* address = reinterpret_cast<sockaddr*>(&storage);
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    return detail::RetryOnInterrupt(
+        [&] { return ::accept4(listener, address, &length, SOCK_NONBLOCK | SOCK_CLOEXEC); });
+#else
+    // no `accept4` on macOS, so the flags are set afterwards
+    const int fd = detail::RetryOnInterrupt([&] { return ::accept(listener, address, &length); });
+    if (fd >= 0 && (::fcntl(fd, F_SETFD, FD_CLOEXEC) != 0 || ::fcntl(fd, F_SETFL, O_NONBLOCK) != 0)) {
+        const int error = errno;
+        ::close(fd);
+        errno = error;
+
+        return -1;
+    }
+
+    return fd;
+#endif
+}
+
+// Whether `accept` failed because of the connection it was about to return rather than the listener. Besides
+// a connection that was reset while it was queued, Linux reports errors that are already pending on the new
+// socket, which accept(2) says to treat like `EAGAIN` and retry; there can be others queued behind it.
+auto skipsConnection(int error) noexcept -> bool
+{
+    switch (error) {
+    case ECONNABORTED:
+    case EPROTO:
+    case ENOPROTOOPT:
+    case EOPNOTSUPP:
+    case ENETDOWN:
+    case ENETUNREACH:
+    case EHOSTDOWN:
+    case EHOSTUNREACH:
+#if defined(ENONET)
+    case ENONET:
+#endif
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+auto TcpListener::Bind(const SocketAddress& address) noexcept -> Result<TcpListener, SocketError>
+{
+    return TcpListener::Bind(address, Options{ });
+}
+
+auto TcpListener::Bind(const SocketAddress& address, const Options& options) noexcept
+    -> Result<TcpListener, SocketError>
+{
+    auto opened = Descriptor::Open(address.TypeOf(), SOCK_STREAM, IPPROTO_TCP);
+    if (opened.Err()) {
+        return Err(opened.Error());
+    }
+
+    auto fd = std::move(opened.Value());
+    if (options.ReuseAddress) {
+        if (auto result = fd.SetOption(SOL_SOCKET, SO_REUSEADDR, 1); !result) {
+            return Err(result.Error());
+        }
+    }
+
+    if (options.ReusePort) {
+#ifdef SO_REUSEPORT
+        if (auto result = fd.SetOption(SOL_SOCKET, SO_REUSEPORT, 1); !result) {
+            return Err(result.Error());
+        }
+#else
+        return Err(SocketError(ENOPROTOOPT));
+#endif
+    }
+
+    if (auto result = fd.SetNonBlocking(true); !result) {
+        return Err(result.Error());
+    }
+
+    if (auto result = fd.Bind(address); !result) {
+        return Err(result.Error());
+    }
+
+    if (::listen(fd.Get(), options.Backlog) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return TcpListener(std::move(fd));
+}
+
+auto TcpListener::Accept() noexcept -> Result<Accepted, SocketError>
+{
+    for (;;) {
+        sockaddr_storage storage; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        socklen_t length = sizeof(storage);
+
+        const int fd = acceptNonBlocking(this->n_fd.Get(), storage, length);
+        if (fd < 0) {
+            if (skipsConnection(errno)) {
+                continue;
+            }
+
+            return Err(SocketError::Last());
+        }
+
+        Descriptor stream(fd);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto peer = SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&storage), length);
+        if (!peer) {
+            return Err(SocketError(EAFNOSUPPORT));
+        }
+
+        return Accepted{ TcpStream(std::move(stream)), peer.Unwrap() };
+    }
+}
+
+} // namespace violet::net::socket
@@ -0,0 +1,92 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/Socket/TcpStream.h>
+
+namespace violet::net::socket {
+
+namespace {
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+// macOS has no `MSG_NOSIGNAL`; `SO_NOSIGPIPE` is set on the socket instead
+constexpr int kSendFlags = 0;
+#endif
+
+} // namespace
+
+TcpStream::TcpStream(Descriptor fd) noexcept
+    : n_fd(std::move(fd))
+{
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+    (void)this->n_fd.SetOption(SOL_SOCKET, SO_NOSIGPIPE, 1);
+#endif
+}
+
+auto TcpStream::Connect(const SocketAddress& address) noexcept -> Result<TcpStream, SocketError>
+{
+    auto fd = Descriptor::Open(address.TypeOf(), SOCK_STREAM, IPPROTO_TCP);
+    if (fd.Err()) {
+        return Err(fd.Error());
+    }
+
+    if (auto result = fd.Value().Connect(address); !result) {
+        return Err(result.Error());
+    }
+
+    return TcpStream(std::move(fd.Value()));
+}
+
+auto TcpStream::Read(Span<UInt8> buffer) noexcept -> Result<UInt, SocketError>
+{
+    const auto received = detail::RetryOnInterrupt(
+        [&] { return ::recv(this->n_fd.Get(), buffer.data(), buffer.size(), 0); });
+
+    if (received < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt>(received);
+}
+
+auto TcpStream::Write(Span<const UInt8> data) noexcept -> Result<UInt, SocketError>
+{
+    const auto sent = detail::RetryOnInterrupt(
+        [&] { return ::send(this->n_fd.Get(), data.data(), data.size(), kSendFlags); });
+
+    if (sent < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt>(sent);
+}
+
+auto TcpStream::Shutdown(int how) const noexcept -> Result<void, SocketError>
+{
+    if (::shutdown(this->n_fd.Get(), how) != 0) {
+        return Err(SocketError::Last());
+    }
+
+    return { };
+}
+
+} // namespace violet::net::socket
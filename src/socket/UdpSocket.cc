@@ -0,0 +1,367 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Networking/Socket/UdpSocket.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#if defined(__linux__)
+#    include <netinet/udp.h>
+#endif
+
+namespace violet::net::socket {
+
+namespace {
+
+auto asSockAddr(sockaddr_storage& storage) noexcept -> sockaddr*
+{
+    return reinterpret_cast<sockaddr*>(&storage); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+// Returns **Nothing** if the kernel hands back an address of another family, which doesn't happen on a
+// UDP socket; callers then leave their peer as it is.
+auto decodePeer(sockaddr_storage& storage, socklen_t length) noexcept -> Optional<SocketAddress>
+{
+    return SocketAddress::FromSockAddr(asSockAddr(storage), length);
+}
+
+// Points `header` at one buffer and, if `name` isn't null, one address; `mmsghdr` wraps the same thing.
+void prepare(msghdr& header, iovec& vec, sockaddr_storage* name, socklen_t nameLength) noexcept
+{
+    header = msghdr{ };
+    header.msg_name = name;
+    header.msg_namelen = name != nullptr ? nameLength : 0;
+    header.msg_iov = &vec;
+    header.msg_iovlen = 1;
+}
+
+auto sendSegmented(int fd, Span<const UInt8> data, UInt16 segmentSize, sockaddr_storage* name,
+    socklen_t nameLength) noexcept -> Result<UInt, SocketError>
+{
+    // checked here rather than left to the kernel, which takes a segment size of 0 as no segmentation
+    if (segmentSize == 0 || data.size() > UInt(segmentSize) * UdpSocket::kMaxSegments) {
+        return Err(SocketError(EINVAL));
+    }
+
+#if defined(__linux__)
+    iovec vec{ const_cast<UInt8*>(data.data()), data.size() };
+    msghdr header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    prepare(header, vec, name, nameLength);
+
+    // the segment size goes along with the buffer as a `UDP_SEGMENT` control message
+    alignas(cmsghdr) Array<char, CMSG_SPACE(sizeof(UInt16))> control{ };
+    header.msg_control = control.data();
+    header.msg_controllen = control.size();
+
+    cmsghdr* message = CMSG_FIRSTHDR(&header);
+    message->cmsg_level = SOL_UDP;
+    message->cmsg_type = UDP_SEGMENT;
+    message->cmsg_len = CMSG_LEN(sizeof(UInt16));
+    std::memcpy(CMSG_DATA(message), &segmentSize, sizeof(segmentSize));
+
+    const auto sent = detail::RetryOnInterrupt([&] { return ::sendmsg(fd, &header, 0); });
+    if (sent < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt>(sent);
+#else
+    (void)fd, (void)data, (void)segmentSize, (void)name, (void)nameLength;
+    return Err(SocketError(ENOPROTOOPT));
+#endif
+}
+
+} // namespace
+
+auto UdpSocket::Bind(const SocketAddress& address) noexcept -> Result<UdpSocket, SocketError>
+{
+    auto fd = Descriptor::Open(address.TypeOf(), SOCK_DGRAM, IPPROTO_UDP);
+    if (fd.Err()) {
+        return Err(fd.Error());
+    }
+
+    if (auto result = fd.Value().Bind(address); !result) {
+        return Err(result.Error());
+    }
+
+    return UdpSocket(std::move(fd.Value()));
+}
+
+auto UdpSocket::Connect(const SocketAddress& peer) noexcept -> Result<void, SocketError>
+{
+    return this->n_fd.Connect(peer);
+}
+
+auto UdpSocket::SendTo(Span<const UInt8> data, const SocketAddress& peer) noexcept -> Result<UInt, SocketError>
+{
+    sockaddr_storage storage; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    const socklen_t length = peer.ToSockAddr(storage);
+
+    const auto sent = detail::RetryOnInterrupt(
+        [&] { return ::sendto(this->n_fd.Get(), data.data(), data.size(), 0, asSockAddr(storage), length); });
+
+    if (sent < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt>(sent);
+}
+
+auto UdpSocket::Send(Span<const UInt8> data) noexcept -> Result<UInt, SocketError>
+{
+    const auto sent = detail::RetryOnInterrupt([&] { return ::send(this->n_fd.Get(), data.data(), data.size(), 0); });
+    if (sent < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt>(sent);
+}
+
+auto UdpSocket::RecvFrom(Span<UInt8> buffer, SocketAddress& peer) noexcept -> Result<UInt, SocketError>
+{
+    sockaddr_storage storage; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    socklen_t length = sizeof(storage);
+
+    const auto received = detail::RetryOnInterrupt([&] {
+        return ::recvfrom(this->n_fd.Get(), buffer.data(), buffer.size(), 0, asSockAddr(storage), &length);
+    });
+
+    if (received < 0) {
+        return Err(SocketError::Last());
+    }
+
+    if (auto address = decodePeer(storage, length)) {
+        peer = address.Unwrap();
+    }
+
+    return static_cast<UInt>(received);
+}
+
+auto UdpSocket::Recv(Span<UInt8> buffer) noexcept -> Result<UInt, SocketError>
+{
+    const auto received
+        = detail::RetryOnInterrupt([&] { return ::recv(this->n_fd.Get(), buffer.data(), buffer.size(), 0); });
+
+    if (received < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt>(received);
+}
+
+auto UdpSocket::RecvMany(Span<const Span<UInt8>> buffers, Span<UInt> sizes, Span<SocketAddress> peers) noexcept
+    -> Result<UInt, SocketError>
+{
+    const UInt count = std::min<UInt>(buffers.size(), kMaxBatch);
+    VIOLET_DEBUG_ASSERT(sizes.size() >= count && peers.size() >= count, "output spans are too small");
+
+    if (count == 0) {
+        return 0;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-member-init): only the first `count` are used, and set below
+    Array<iovec, kMaxBatch> vecs;
+    Array<sockaddr_storage, kMaxBatch> names;
+    // NOLINTEND(cppcoreguidelines-pro-type-member-init)
+
+    for (UInt i = 0; i < count; i++) {
+        vecs[i] = { buffers[i].data(), buffers[i].size() };
+    }
+
+#if defined(__linux__)
+    Array<mmsghdr, kMaxBatch> messages; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    for (UInt i = 0; i < count; i++) {
+        prepare(messages[i].msg_hdr, vecs[i], &names[i], sizeof(sockaddr_storage));
+        messages[i].msg_len = 0;
+    }
+
+    // `MSG_WAITFORONE` only waits for the first datagram, or a blocking socket would wait for `count`
+    const int received = detail::RetryOnInterrupt([&] {
+        return ::recvmmsg(this->n_fd.Get(), messages.data(), static_cast<unsigned>(count), MSG_WAITFORONE, nullptr);
+    });
+
+    if (received < 0) {
+        return Err(SocketError::Last());
+    }
+
+    for (UInt i = 0; i < static_cast<UInt>(received); i++) {
+        sizes[i] = messages[i].msg_len;
+        if (auto address = decodePeer(names[i], messages[i].msg_hdr.msg_namelen)) {
+            peers[i] = address.Unwrap();
+        }
+    }
+
+    return static_cast<UInt>(received);
+#else
+    UInt received = 0;
+    for (; received < count; received++) {
+        msghdr header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        prepare(header, vecs[received], &names[received], sizeof(sockaddr_storage));
+
+        // like `MSG_WAITFORONE`: only the first datagram is waited for
+        const int flags = received == 0 ? 0 : MSG_DONTWAIT;
+        const auto size = detail::RetryOnInterrupt([&] { return ::recvmsg(this->n_fd.Get(), &header, flags); });
+        if (size < 0) {
+            // the datagrams so far are returned, and the error is seen again by the next call
+            if (received > 0) {
+                break;
+            }
+
+            return Err(SocketError::Last());
+        }
+
+        sizes[received] = static_cast<UInt>(size);
+        if (auto address = decodePeer(names[received], header.msg_namelen)) {
+            peers[received] = address.Unwrap();
+        }
+    }
+
+    return received;
+#endif
+}
+
+auto UdpSocket::SendMany(Span<const Span<const UInt8>> datagrams, Span<const SocketAddress> peers) noexcept
+    -> Result<UInt, SocketError>
+{
+    const UInt count = std::min<UInt>(datagrams.size(), kMaxBatch);
+    VIOLET_DEBUG_ASSERT(peers.empty() || peers.size() >= count, "`peers` is too small");
+
+    if (count == 0) {
+        return 0;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-member-init): only the first `count` are used, and set below
+    Array<iovec, kMaxBatch> vecs;
+    Array<sockaddr_storage, kMaxBatch> names;
+    Array<socklen_t, kMaxBatch> nameLengths;
+    // NOLINTEND(cppcoreguidelines-pro-type-member-init)
+
+    for (UInt i = 0; i < count; i++) {
+        // `iovec` isn't const-correct, but `sendmsg` only reads from it
+        vecs[i] = { const_cast<UInt8*>(datagrams[i].data()), datagrams[i].size() };
+        nameLengths[i] = peers.empty() ? 0 : peers[i].ToSockAddr(names[i]);
+    }
+
+#if defined(__linux__)
+    Array<mmsghdr, kMaxBatch> messages; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    for (UInt i = 0; i < count; i++) {
+        prepare(messages[i].msg_hdr, vecs[i], peers.empty() ? nullptr : &names[i], nameLengths[i]);
+        messages[i].msg_len = 0;
+    }
+
+    const int sent = detail::RetryOnInterrupt(
+        [&] { return ::sendmmsg(this->n_fd.Get(), messages.data(), static_cast<unsigned>(count), 0); });
+
+    if (sent < 0) {
+        return Err(SocketError::Last());
+    }
+
+    return static_cast<UInt>(sent);
+#else
+    UInt sent = 0;
+    for (; sent < count; sent++) {
+        msghdr header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        prepare(header, vecs[sent], peers.empty() ? nullptr : &names[sent], nameLengths[sent]);
+
+        if (detail::RetryOnInterrupt([&] { return ::sendmsg(this->n_fd.Get(), &header, 0); }) < 0) {
+            // like `sendmmsg`, an error after the first datagram only cuts the batch short
+            if (sent > 0) {
+                break;
+            }
+
+            return Err(SocketError::Last());
+        }
+    }
+
+    return sent;
+#endif
+}
+
+auto UdpSocket::SendSegmented(Span<const UInt8> data, UInt16 segmentSize, const SocketAddress& peer) noexcept
+    -> Result<UInt, SocketError>
+{
+    sockaddr_storage storage; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    const socklen_t length = peer.ToSockAddr(storage);
+
+    return sendSegmented(this->n_fd.Get(), data, segmentSize, &storage, length);
+}
+
+auto UdpSocket::SendSegmented(Span<const UInt8> data, UInt16 segmentSize) noexcept -> Result<UInt, SocketError>
+{
+    return sendSegmented(this->n_fd.Get(), data, segmentSize, nullptr, 0);
+}
+
+auto UdpSocket::SetGro(bool enabled) const noexcept -> Result<void, SocketError>
+{
+#if defined(__linux__)
+    return this->n_fd.SetOption(SOL_UDP, UDP_GRO, enabled ? 1 : 0);
+#else
+    (void)enabled;
+    return Err(SocketError(ENOPROTOOPT));
+#endif
+}
+
+auto UdpSocket::RecvSegmented(Span<UInt8> buffer, SocketAddress& peer) noexcept
+    -> Result<SegmentedDatagram, SocketError>
+{
+    iovec vec{ buffer.data(), buffer.size() };
+    sockaddr_storage storage; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    msghdr header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    prepare(header, vec, &storage, sizeof(storage));
+
+#if defined(__linux__)
+    alignas(cmsghdr) Array<char, CMSG_SPACE(sizeof(int))> control{ };
+    header.msg_control = control.data();
+    header.msg_controllen = control.size();
+#endif
+
+    const auto received = detail::RetryOnInterrupt([&] { return ::recvmsg(this->n_fd.Get(), &header, 0); });
+    if (received < 0) {
+        return Err(SocketError::Last());
+    }
+
+    if (auto address = decodePeer(storage, header.msg_namelen)) {
+        peer = address.Unwrap();
+    }
+
+    const auto size = static_cast<UInt>(received);
+    SegmentedDatagram datagram{ buffer.first(size), size };
+
+#if defined(__linux__)
+    // a coalesced datagram comes with the size of its segments as a `UDP_GRO` control message
+    for (cmsghdr* message = CMSG_FIRSTHDR(&header); message != nullptr; message = CMSG_NXTHDR(&header, message)) {
+        if (message->cmsg_level == SOL_UDP && message->cmsg_type == UDP_GRO) {
+            int segmentSize = 0;
+            std::memcpy(&segmentSize, CMSG_DATA(message), sizeof(segmentSize));
+            datagram.SegmentSize = static_cast<UInt>(segmentSize);
+        }
+    }
+#endif
+
+    return datagram;
+}
+
+} // namespace violet::net::socket
@@ -0,0 +1,100 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <absl/hash/hash.h>
+#include <gtest/gtest.h>
+#include <violet/Networking/FlowKey.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet::net::literals;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+TEST(FlowKey, V4)
+{
+    constexpr FlowKey key("10.0.0.1:49152"_sockaddr, "10.0.0.2:443"_sockaddr, IPProtocol::kTCP);
+
+    static_assert(key.TypeOf() == SocketAddress::Type::V4);
+    static_assert(key.Source() == "10.0.0.1:49152"_sockaddr);
+    static_assert(key.Destination() == "10.0.0.2:443"_sockaddr);
+    static_assert(key.Protocol() == IPProtocol::kTCP);
+    EXPECT_EQ(key.ToString(), "tcp 10.0.0.1:49152 -> 10.0.0.2:443");
+}
+
+TEST(FlowKey, V6)
+{
+    const FlowKey key(socket::AddrV6(ip::AddrV6::Localhost(), 53), socket::AddrV6(ip::AddrV6::Localhost(), 5353),
+        static_cast<IPProtocol>(47));
+
+    EXPECT_EQ(key.TypeOf(), SocketAddress::Type::V6);
+    EXPECT_EQ(key.Source(), "[::1]:53"_sockaddr);
+    EXPECT_EQ(key.Destination(), "[::1]:5353"_sockaddr);
+    EXPECT_EQ(key.ToString(), "proto 47 [::1]:53 -> [::1]:5353");
+}
+
+TEST(FlowKey, ScopeId)
+{
+    const FlowKey onFirst("[fe80::1%2]:546"_sockaddr, "[fe80::2%2]:547"_sockaddr, IPProtocol::kUDP);
+    const FlowKey onSecond("[fe80::1%3]:546"_sockaddr, "[fe80::2%3]:547"_sockaddr, IPProtocol::kUDP);
+
+    // the same link-local addresses on two interfaces are two flows
+    EXPECT_NE(onFirst, onSecond);
+    EXPECT_NE(FixedHash(onFirst), FixedHash(onSecond));
+    EXPECT_NE(absl::HashOf(onFirst), absl::HashOf(onSecond));
+
+    EXPECT_EQ(onFirst.Source(), "[fe80::1%2]:546"_sockaddr);
+    EXPECT_EQ(onFirst.Destination(), "[fe80::2%2]:547"_sockaddr);
+    EXPECT_EQ(onFirst.Reversed().Source(), "[fe80::2%2]:547"_sockaddr);
+    EXPECT_EQ(onSecond.ToString(), "udp [fe80::1%3]:546 -> [fe80::2%3]:547");
+
+    // the scope ids are kept per side
+    const FlowKey mixed("[fe80::1%2]:546"_sockaddr, "[fe80::2%3]:547"_sockaddr, IPProtocol::kUDP);
+    EXPECT_NE(FixedHash(mixed), FixedHash(FlowKey("[fe80::1%3]:546"_sockaddr, "[fe80::2%2]:547"_sockaddr,
+                                    IPProtocol::kUDP)));
+}
+
+TEST(FlowKey, Equality)
+{
+    const FlowKey key("10.0.0.1:1000"_sockaddr, "10.0.0.2:80"_sockaddr, IPProtocol::kTCP);
+
+    EXPECT_EQ(key, FlowKey("10.0.0.1:1000"_sockaddr, "10.0.0.2:80"_sockaddr, IPProtocol::kTCP));
+    EXPECT_NE(key, FlowKey("10.0.0.1:1000"_sockaddr, "10.0.0.2:80"_sockaddr, IPProtocol::kUDP));
+    EXPECT_NE(key, FlowKey("10.0.0.1:1001"_sockaddr, "10.0.0.2:80"_sockaddr, IPProtocol::kTCP));
+    EXPECT_NE(key, key.Reversed());
+    EXPECT_EQ(key, key.Reversed().Reversed());
+
+    // the same bits in the other family
+    EXPECT_NE(key, FlowKey("[::a00:1]:1000"_sockaddr, "[::a00:2]:80"_sockaddr, IPProtocol::kTCP));
+}
+
+TEST(FlowKey, FixedHash)
+{
+    constexpr FlowKey key("10.0.0.1:49152"_sockaddr, "10.0.0.2:443"_sockaddr, IPProtocol::kTCP);
+    static_assert(FixedHash(key) == 0xDF8F586A660523D3);
+
+    const FlowKey v6("[2001:db8::1]:53"_sockaddr, "[2001:db8::2]:5353"_sockaddr, static_cast<IPProtocol>(47));
+    EXPECT_EQ(FixedHash(v6), 0x132397CEF634161Eu);
+    EXPECT_EQ(FixedHash(v6, 42), 0xFDDFFD1F5F00D12Bu);
+
+    EXPECT_NE(FixedHash(key), FixedHash(key.Reversed()));
+    EXPECT_NE(FixedHash(key), FixedHash(key, 1));
+}
@@ -0,0 +1,281 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/FlowTable.h>
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet::net::literals;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// a client connecting to one of a few servers
+auto flow(UInt32 i) -> FlowKey
+{
+    return { socket::AddrV4(ip::AddrV4::FromUInt32(0x0A000000 | (i >> 8)), static_cast<UInt16>(32768 + (i & 0xFF))),
+        socket::AddrV4(ip::AddrV4(192, 0, 2, static_cast<UInt8>(i % 4)), 443), IPProtocol::kTCP };
+}
+
+// a value whose constructors throw once `Fail` is set
+struct Fragile final {
+    static inline bool Fail = false;
+
+    VIOLET_IMPLICIT Fragile(int value)
+        : Value(value)
+    {
+        if (Fail) {
+            throw std::runtime_error("fragile");
+        }
+    }
+
+    Fragile(const Fragile& other)
+        : Fragile(other.Value)
+    {
+    }
+
+    Fragile(Fragile&& other)
+        : Fragile(other.Value)
+    {
+    }
+
+    auto operator=(const Fragile& other) -> Fragile& = default;
+
+    int Value;
+};
+
+} // namespace
+
+TEST(FlowTable, Empty)
+{
+    const FlowTable<int> table;
+    EXPECT_TRUE(table.Empty());
+    EXPECT_EQ(table.Capacity(), 0u);
+    EXPECT_EQ(table.MemoryUsage(), 0u);
+    EXPECT_FALSE(table.Get(flow(1)));
+    EXPECT_FALSE(table.Contains(flow(1)));
+}
+
+TEST(FlowTable, InsertGetRemove)
+{
+    FlowTable<int> table;
+    EXPECT_TRUE(table.Insert(flow(1), 1));
+    EXPECT_TRUE(table.Insert(flow(2), 2));
+    EXPECT_FALSE(table.Insert(flow(1), 10));
+    EXPECT_EQ(table.Size(), 2u);
+
+    EXPECT_EQ(table.Get(flow(1)).Unwrap(), 10);
+    EXPECT_EQ(table.Get(flow(2)).Unwrap(), 2);
+    EXPECT_FALSE(table.Get(flow(1).Reversed()));
+
+    EXPECT_EQ(table.Remove(flow(1)), Some<int>(10));
+    EXPECT_EQ(table.Remove(flow(1)), Nothing);
+    EXPECT_FALSE(table.Contains(flow(1)));
+    EXPECT_TRUE(table.Contains(flow(2)));
+    EXPECT_EQ(table.Size(), 1u);
+}
+
+TEST(FlowTable, LinkLocalFlowsOnTwoInterfaces)
+{
+    const FlowKey onFirst("[fe80::1%2]:546"_sockaddr, "[ff02::1:2%2]:547"_sockaddr, IPProtocol::kUDP);
+    const FlowKey onSecond("[fe80::1%3]:546"_sockaddr, "[ff02::1:2%3]:547"_sockaddr, IPProtocol::kUDP);
+
+    FlowTable<int> table;
+    EXPECT_TRUE(table.Insert(onFirst, 2));
+    EXPECT_TRUE(table.Insert(onSecond, 3));
+    EXPECT_EQ(table.Size(), 2u);
+    EXPECT_EQ(table.Get(onFirst).Unwrap(), 2);
+    EXPECT_EQ(table.Get(onSecond).Unwrap(), 3);
+}
+
+TEST(FlowTable, TryEmplace)
+{
+    struct Connection {
+        UInt64 Packets = 0;
+    };
+
+    FlowTable<Connection> table;
+    for (int i = 0; i < 3; i++) {
+        auto [connection, inserted] = table.TryEmplace(flow(7));
+        EXPECT_EQ(inserted, i == 0);
+        connection.Packets++;
+    }
+
+    const Connection& connection = table.Get(flow(7)).Unwrap();
+    EXPECT_EQ(connection.Packets, 3u);
+}
+
+TEST(FlowTable, MatchesUnorderedMap)
+{
+    // random inserts and removes over a small key space, so that both hit often
+    std::mt19937 rng(0x5EED); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    FlowTable<UInt32> table;
+    std::unordered_map<FlowKey, UInt32> expected;
+
+    for (UInt32 i = 0; i < 200'000; i++) {
+        const FlowKey key = flow(rng() % 20'000);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(table.Remove(key).HasValue(), expected.erase(key) == 1);
+        } else {
+            EXPECT_EQ(table.Insert(key, i), expected.insert_or_assign(key, i).second);
+        }
+    }
+
+    ASSERT_EQ(table.Size(), expected.size());
+    for (const auto& [key, value]: expected) {
+        ASSERT_EQ(table.Get(key).Unwrap(), value) << key;
+    }
+
+    UInt visited = 0;
+    table.ForEach([&](const FlowKey& key, UInt32 value) -> void {
+        EXPECT_EQ(expected.at(key), value) << key;
+        visited++;
+    });
+
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST(FlowTable, ChurnDoesNotGrowTheTable)
+{
+    FlowTable<UInt32> table(10'000);
+    const UInt capacity = table.Capacity();
+    EXPECT_GE(capacity, 10'000u);
+
+    // a sliding window of live flows, so that every slot gets reused many times
+    for (UInt32 i = 0; i < 500'000; i++) {
+        table.Insert(flow(i), i);
+        if (i >= 5'000) {
+            ASSERT_TRUE(table.Remove(flow(i - 5'000))) << i;
+        }
+    }
+
+    EXPECT_EQ(table.Size(), 5'000u);
+    EXPECT_EQ(table.Capacity(), capacity);
+    for (UInt32 i = 500'000 - 5'000; i < 500'000; i++) {
+        ASSERT_TRUE(table.Contains(flow(i))) << i;
+    }
+}
+
+TEST(FlowTable, RemoveIf)
+{
+    FlowTable<UInt32> table;
+    for (UInt32 i = 0; i < 10'000; i++) {
+        table.Insert(flow(i), i);
+    }
+
+    EXPECT_EQ(table.RemoveIf([](const FlowKey&, UInt32 value) -> bool { return value % 2 == 0; }), 5'000u);
+    EXPECT_EQ(table.Size(), 5'000u);
+    for (UInt32 i = 0; i < 10'000; i++) {
+        ASSERT_EQ(table.Contains(flow(i)), i % 2 == 1) << i;
+    }
+}
+
+TEST(FlowTable, GetMany)
+{
+    FlowTable<UInt32> table;
+    for (UInt32 i = 0; i < 1'000; i += 2) {
+        table.Insert(flow(i), i);
+    }
+
+    Vec<FlowKey> keys;
+    for (UInt32 i = 0; i < 100; i++) {
+        keys.push_back(flow(i));
+    }
+
+    Vec<const UInt32*> values(keys.size());
+    EXPECT_EQ(table.GetMany(keys, values), 50u);
+    for (UInt32 i = 0; i < 100; i++) {
+        if (i % 2 == 0) {
+            ASSERT_NE(values[i], nullptr);
+            EXPECT_EQ(*values[i], i);
+        } else {
+            EXPECT_EQ(values[i], nullptr);
+        }
+    }
+
+    const FlowTable<UInt32> empty;
+    EXPECT_EQ(empty.GetMany(keys, values), 0u);
+    EXPECT_EQ(values[0], nullptr);
+}
+
+TEST(FlowTable, CopyClearAndMoveOnlyValues)
+{
+    FlowTable<UInt32> table;
+    for (UInt32 i = 0; i < 1'000; i++) {
+        table.Insert(flow(i), i);
+    }
+
+    FlowTable<UInt32> copy = table;
+    table.Clear();
+    EXPECT_TRUE(table.Empty());
+    EXPECT_FALSE(table.Contains(flow(1)));
+    EXPECT_EQ(copy.Size(), 1'000u);
+    EXPECT_EQ(copy.Get(flow(999)).Unwrap(), 999u);
+
+    FlowTable<std::unique_ptr<int>> owned;
+    for (int i = 0; i < 100; i++) {
+        owned.Insert(flow(i), std::make_unique<int>(i));
+    }
+
+    FlowTable<std::unique_ptr<int>> moved = std::move(owned);
+    EXPECT_EQ(*moved.Remove(flow(42)).Unwrap(), 42);
+    EXPECT_EQ(moved.Size(), 99u);
+}
+
+TEST(FlowTable, ThrowingValuesLeaveTheTableAsItWas)
+{
+    FlowTable<Fragile> table;
+    for (int i = 0; i < 13; i++) {
+        table.Insert(flow(i), i);
+    }
+
+    // the next insert grows the table, and the values throw as they're copied into the new one
+    const UInt capacity = table.Capacity();
+    Fragile::Fail = true;
+    EXPECT_THROW(table.TryEmplace(flow(13), 13), std::runtime_error);
+    EXPECT_THROW(FlowTable<Fragile>{ table }, std::runtime_error);
+    Fragile::Fail = false;
+
+    // and without growing, the value throws as it's constructed
+    table.Remove(flow(12));
+    Fragile::Fail = true;
+    EXPECT_THROW(table.TryEmplace(flow(12), 12), std::runtime_error);
+    Fragile::Fail = false;
+    EXPECT_TRUE(table.Insert(flow(12), 12));
+
+    EXPECT_EQ(table.Size(), 13u);
+    EXPECT_EQ(table.Capacity(), capacity);
+    EXPECT_FALSE(table.Contains(flow(13)));
+
+    int sum = 0;
+    table.ForEach([&sum](const FlowKey&, const Fragile& value) -> void { sum += value.Value; });
+    EXPECT_EQ(sum, 78);
+
+    EXPECT_TRUE(table.Insert(flow(13), 13));
+    EXPECT_EQ(table.Remove(flow(13)).Unwrap().Value, 13);
+}
@@ -19,6 +19,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <absl/hash/hash_testing.h>
 #include <gtest/gtest.h>
 #include <violet/Networking/IPAddress.h>
 
@@ -139,3 +140,68 @@ TEST(IPAddress, FromStrInvalid)
     auto res = IPAddress::FromStr("not_an_ip");
     EXPECT_FALSE(res.Ok());
 }
+
+TEST(IPAddress, FromStrSniffsFamily)
+{
+    auto full = IPAddress::FromStr("2001:db8:0:0:0:0:0:1");
+    ASSERT_TRUE(full.Ok());
+    EXPECT_EQ(full->TypeOf(), IPAddress::Type::V6);
+
+    auto mapped = IPAddress::FromStr("::ffff:10.0.0.1");
+    ASSERT_TRUE(mapped.Ok());
+    EXPECT_EQ(mapped->TypeOf(), IPAddress::Type::V6);
+
+    auto padded = IPAddress::FromStr("0010.0.0.1");
+    ASSERT_TRUE(padded.Ok());
+    EXPECT_EQ(padded->TypeOf(), IPAddress::Type::V4);
+
+    EXPECT_FALSE(IPAddress::FromStr(""));
+    EXPECT_FALSE(IPAddress::FromStr("12345::1"));
+}
+
+TEST(IPAddress, ParseMany)
+{
+    // more than one block, with the families interleaved
+    Vec<String> corpus;
+    for (UInt i = 0; i < 150; ++i) {
+        switch (i % 3) {
+        case 0:
+            corpus.push_back(std::format("10.0.{}.{}", i / 256, i % 256));
+            break;
+
+        case 1:
+            corpus.push_back(std::format("fe80::{:x}", i));
+            break;
+
+        default:
+            corpus.push_back(i % 2 == 0 ? "10.0.0" : "fe80:::1");
+        }
+    }
+
+    Vec<Str> inputs(corpus.begin(), corpus.end());
+    Vec<IPAddress> out(inputs.size(), IPAddress::V4(ip::AddrV4::Broadcast()));
+    Vec<IPAddress::ParseStatus> status(inputs.size());
+
+    EXPECT_EQ(IPAddress::ParseMany(inputs, out, status), 100);
+
+    for (UInt i = 0; i < inputs.size(); ++i) {
+        auto expected = IPAddress::FromStr(inputs[i]);
+        ASSERT_EQ(expected.Ok(), status[i] == IPAddress::ParseStatus::kOk) << "input `" << inputs[i] << "'";
+
+        if (expected.Ok()) {
+            EXPECT_EQ(out[i], expected.Value());
+        } else {
+            EXPECT_EQ(out[i], IPAddress::V4(ip::AddrV4()));
+        }
+    }
+}
+
+TEST(IPAddress, Hash)
+{
+    const auto v4 = IPAddress::V4(ip::AddrV4(0, 0, 0, 1));
+    const auto v6 = IPAddress::V6(ip::AddrV6::FromWords(0, 1));
+
+    EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly({ v4, v6, IPAddress::V6(ip::AddrV6::FromWords(1, 0)) }));
+    EXPECT_EQ(std::hash<IPAddress>{ }(v4), FixedHash(v4));
+    EXPECT_NE(FixedHash(v4), FixedHash(v6));
+}
@@ -0,0 +1,86 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IPNetwork.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+TEST(IPNetwork, FromStr)
+{
+    auto v4 = IPNetwork::FromStr("10.0.0.0/8");
+    ASSERT_TRUE(v4);
+    EXPECT_EQ(v4.Value().TypeOf(), IPNetwork::Type::V4);
+    EXPECT_EQ(v4.Value().PrefixLength(), 8);
+    EXPECT_EQ(v4.Value().ToString(), "10.0.0.0/8");
+
+    auto v6 = IPNetwork::FromStr("fe80::1/10");
+    ASSERT_TRUE(v6);
+    EXPECT_EQ(v6.Value().TypeOf(), IPNetwork::Type::V6);
+    EXPECT_EQ(v6.Value().Address(), IPAddress::V6(ip::AddrV6::FromStr("fe80::").Value()));
+    EXPECT_EQ(v6.Value().ToString(), "fe80::/10");
+
+    // IPv4-mapped addresses are picked up by the `:` probe
+    EXPECT_EQ(IPNetwork::FromStr("::ffff:10.0.0.0/104").Value().TypeOf(), IPNetwork::Type::V6);
+
+    EXPECT_FALSE(IPNetwork::FromStr("10.0.0.0/33"));
+    EXPECT_FALSE(IPNetwork::FromStr("not a network"));
+    EXPECT_FALSE(IPNetwork::FromStr(""));
+}
+
+TEST(IPNetwork, ConstexprParse)
+{
+    static_assert(IPNetwork::Parse("192.168.0.0/16").Unwrap().PrefixLength() == 16);
+    static_assert(IPNetwork::Parse("2001:db8::/32").Unwrap().TypeOf() == IPNetwork::Type::V6);
+    static_assert(!IPNetwork::Parse("2001:db8::/130"));
+}
+
+TEST(IPNetwork, Contains)
+{
+    auto v4 = IPNetwork::V4(ip::NetworkV4(ip::AddrV4(10, 0, 0, 0), 8));
+    auto v6 = IPNetwork::FromStr("::/0").Value();
+
+    EXPECT_TRUE(v4.Contains(IPAddress::V4(ip::AddrV4(10, 1, 2, 3))));
+    EXPECT_FALSE(v4.Contains(IPAddress::V4(ip::AddrV4(11, 1, 2, 3))));
+    EXPECT_TRUE(v6.Contains(IPAddress::V6(ip::AddrV6::Localhost())));
+
+    // families never contain each other, even `::/0` and `0.0.0.0/0`
+    EXPECT_FALSE(v6.Contains(IPAddress::V4(ip::AddrV4::Localhost())));
+    EXPECT_FALSE(v4.Contains(IPAddress::V6(ip::AddrV6())));
+    EXPECT_FALSE(v6.Contains(IPNetwork::FromStr("0.0.0.0/0").Value()));
+    EXPECT_FALSE(v6.Overlaps(IPNetwork::FromStr("0.0.0.0/0").Value()));
+
+    EXPECT_TRUE(v4.Contains(IPNetwork::FromStr("10.20.0.0/16").Value()));
+    EXPECT_TRUE(v4.Overlaps(IPNetwork::FromStr("0.0.0.0/0").Value()));
+}
+
+TEST(IPNetwork, Ordering)
+{
+    auto v4 = IPNetwork::FromStr("255.0.0.0/8").Value();
+    auto v6 = IPNetwork::FromStr("::/0").Value();
+
+    EXPECT_LT(v4, v6);
+    EXPECT_NE(v4, v6);
+    EXPECT_EQ(v4, IPNetwork::FromStr("255.1.2.3/8").Value());
+}
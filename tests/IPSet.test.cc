@@ -0,0 +1,75 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IPSet.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto address(Str input) -> IPAddress
+{
+    return IPAddress::FromStr(input).Value();
+}
+
+auto cidr(Str input) -> IPNetwork
+{
+    return IPNetwork::FromStr(input).Value();
+}
+
+} // namespace
+
+TEST(IPSet, FamiliesAreSeparate)
+{
+    const IPSet set = IPSet::Builder().Add(cidr("10.0.0.0/8")).Add(address("2001:db8::1")).Build();
+    EXPECT_EQ(set.Size(), 2);
+    EXPECT_EQ(set.V4().Size(), 1);
+    EXPECT_EQ(set.V6().Size(), 1);
+
+    EXPECT_TRUE(set.Contains(address("10.1.2.3")));
+    EXPECT_FALSE(set.Contains(address("::ffff:10.1.2.3")));
+    EXPECT_TRUE(set.Contains(address("2001:db8::1")));
+    EXPECT_TRUE(set.Contains(cidr("10.1.0.0/16")));
+    EXPECT_FALSE(set.Contains(cidr("2001:db8::/64")));
+}
+
+TEST(IPSet, SetOperations)
+{
+    const IPSet lhs = IPSet::Builder().Add(cidr("10.0.0.0/8")).Add(cidr("2001:db8::/32")).Build();
+    const IPSet rhs = IPSet::Builder()
+                          .Add(ip::AddrV4(10, 0, 0, 0), ip::AddrV4(10, 0, 0, 255))
+                          .Add(cidr("2001:db8:1::/48"))
+                          .Build();
+
+    const IPSet difference = lhs.Difference(rhs);
+    EXPECT_FALSE(difference.Contains(address("10.0.0.5")));
+    EXPECT_TRUE(difference.Contains(address("10.0.1.0")));
+    EXPECT_FALSE(difference.Contains(address("2001:db8:1::1")));
+    EXPECT_TRUE(difference.Contains(address("2001:db8:2::1")));
+
+    EXPECT_EQ(lhs.Intersection(rhs), rhs);
+    EXPECT_EQ(difference.Union(rhs), lhs);
+    EXPECT_TRUE(rhs.Difference(lhs).Empty());
+}
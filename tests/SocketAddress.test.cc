@@ -19,6 +19,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <absl/hash/hash_testing.h>
 #include <gtest/gtest.h>
 #include <violet/Networking/SocketAddress.h>
 
@@ -145,3 +146,90 @@ TEST(SocketAddress, FromStrMissingPortV6)
     auto res = SocketAddress::FromStr("[::1]");
     EXPECT_TRUE(res.Ok());
 }
+
+TEST(SocketAddress, FromStrEmpty)
+{
+    EXPECT_FALSE(SocketAddress::FromStr(""));
+    EXPECT_FALSE(SocketAddress::FromStr("["));
+}
+
+TEST(SocketAddress, FromStrRejectsTrailingCharactersInPort)
+{
+    EXPECT_FALSE(SocketAddress::FromStr("127.0.0.1:80abc"));
+    EXPECT_FALSE(SocketAddress::FromStr("127.0.0.1:80:90"));
+    EXPECT_FALSE(SocketAddress::FromStr("[::1]:80abc"));
+}
+
+TEST(SocketAddress, ConstexprParse)
+{
+    using namespace violet::net::literals; // NOLINT(google-build-using-namespace)
+
+    constexpr auto https = "[::1]:443"_sockaddr;
+    static_assert(https.TypeOf() == SocketAddress::Type::V6);
+    static_assert(https.AsV6Unchecked(Unsafe("checked above")).Port == 443);
+
+    constexpr auto dns = "10.0.0.53:53"_sockaddr;
+    static_assert(dns.TypeOf() == SocketAddress::Type::V4);
+    static_assert(dns.AsV4Unchecked(Unsafe("checked above")) == socket::AddrV4({ 10, 0, 0, 53 }, 53));
+
+    static_assert(!SocketAddress::Parse("10.0.0.53:65536"));
+    static_assert(!SocketAddress::Parse("[::1"));
+
+    Array<Str, 13> inputs = { "1.2.3.4", "1.2.3.4:80", "1.2.3.4:", "1.2.3.4:99999999999999999999", "[::1]", "[::1]:",
+        "[::1]:8080", "[::1]8080", "::1", "", "[fe80::1%2]:80", "[fe80::1%]:80", "[fe80::1%4294967296]" };
+
+    for (const auto& input: inputs) {
+        auto expected = SocketAddress::FromStr(input);
+        auto actual = SocketAddress::Parse(input);
+
+        ASSERT_EQ(expected.Ok(), actual.HasValue()) << "input `" << input << "'";
+        if (actual) {
+            EXPECT_EQ(expected.Value(), actual.Unwrap());
+        }
+    }
+}
+
+TEST(SocketAddress, Hash)
+{
+    const auto v4 = SocketAddress::V4({ ip::AddrV4(0, 0, 0, 1), 80 });
+    const auto v6 = SocketAddress::V6({ ip::AddrV6::FromWords(0, 1), 80 });
+    const auto localhost = SocketAddress::V6({ ip::AddrV6::Localhost(), 81 });
+
+    EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly({ v4, v6, localhost }));
+    EXPECT_EQ(std::hash<SocketAddress>{ }(v4), FixedHash(v4));
+    EXPECT_NE(FixedHash(v4), FixedHash(v6));
+}
+
+TEST(SocketAddress, SockAddrRoundTrip)
+{
+    const Array<SocketAddress, 3> addresses = { SocketAddress::V4({ ip::AddrV4(192, 168, 1, 10), 8080 }),
+        SocketAddress::V6({ ip::AddrV6::Localhost(), 443 }),
+        SocketAddress::V6({ ip::AddrV6(0xfe80, 0, 0, 0, 0, 0, 0, 1), 53, 0x12345, 3 }) };
+
+    for (const auto& address: addresses) {
+        sockaddr_storage storage{ };
+        const socklen_t length = address.ToSockAddr(storage);
+        EXPECT_EQ(length, address.SockAddrLen());
+        EXPECT_EQ(storage.ss_family, address.TypeOf() == SocketAddress::Type::V4 ? AF_INET : AF_INET6);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto back = SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&storage), length);
+        ASSERT_TRUE(back) << address;
+        EXPECT_EQ(back.Unwrap(), address);
+    }
+}
+
+TEST(SocketAddress, FromSockAddrRejectsOtherFamilies)
+{
+    sockaddr_storage storage{ };
+    storage.ss_family = AF_UNIX;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    EXPECT_FALSE(SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&storage), sizeof(storage)));
+    EXPECT_FALSE(SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&storage), 0));
+    EXPECT_FALSE(SocketAddress::FromSockAddr(nullptr, sizeof(storage)));
+
+    storage.ss_family = AF_INET6;
+    EXPECT_FALSE(SocketAddress::FromSockAddr(reinterpret_cast<const sockaddr*>(&storage), sizeof(sockaddr_in)));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
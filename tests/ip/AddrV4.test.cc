@@ -19,9 +19,12 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <absl/hash/hash_testing.h>
 #include <gtest/gtest.h>
 #include <violet/Networking/IP/AddrV4.h>
 
+#include <unordered_set>
+
 // NOLINTBEGIN(google-build-using-namespace)
 using namespace violet::net::ip;
 using namespace violet;
@@ -114,3 +117,221 @@ TEST(AddrV4, Localhost)
     ASSERT_TRUE(loop.Loopback());
     ASSERT_EQ(loop.ToString(), "127.0.0.1");
 }
+
+TEST(AddrV4, ParseEveryOctetWidth)
+{
+    for (UInt8 first: { 1, 22, 255 }) {
+        for (UInt8 second: { 0, 10, 199 }) {
+            for (UInt8 third: { 9, 64, 100 }) {
+                for (UInt8 fourth: { 7, 99, 250 }) {
+                    AddrV4 expected(first, second, third, fourth);
+
+                    auto result = AddrV4::FromStr(expected.ToString());
+                    ASSERT_TRUE(result) << "failed to parse `" << expected << "': " << result.Error();
+                    EXPECT_EQ(result.Value(), expected);
+                }
+            }
+        }
+    }
+
+    auto padded = AddrV4::FromStr("010.001.000.099");
+    ASSERT_TRUE(padded);
+    EXPECT_EQ(padded.Value(), AddrV4(10, 1, 0, 99));
+}
+
+TEST(AddrV4, ParseErrorKinds)
+{
+    EXPECT_EQ(AddrV4::FromStr("1.2.3.4.5").Error().ToString(), "invalid IPv4 address: exceeded number of octets needed");
+    EXPECT_EQ(AddrV4::FromStr("1.2.3.4.").Error().ToString(), "invalid IPv4 address: exceeded number of octets needed");
+    EXPECT_EQ(AddrV4::FromStr("1.2.999.4").Error().ToString(), "invalid IPv4 address: max octet number (>255)");
+    EXPECT_EQ(AddrV4::FromStr("1.2.3").Error().ToString(),
+        "invalid IPv4 address: 4 octets are required to be a valid address");
+    EXPECT_EQ(AddrV4::FromStr("1..3.4").Error().ToString(),
+        AddrV4::FromStr("x.2.3.4").Error().ToString()); // both fail integral parsing
+}
+
+TEST(AddrV4, ParseErrorOffsets)
+{
+    static_assert(sizeof(Result<AddrV4, InvalidV4AddressError>) <= 12);
+
+    auto error = AddrV4::FromStr("10.0.300.1").Error();
+    EXPECT_EQ(error.Kind(), AddrV4::ParseStatus::kMaxOctetNumber);
+    EXPECT_EQ(error.Offset(), 5);
+
+    EXPECT_EQ(AddrV4::FromStr("1.2.3.4.5").Error(), InvalidV4AddressError(AddrV4::ParseStatus::kExceededOctetLimit, 8));
+    EXPECT_EQ(AddrV4::FromStr("1.2.3x.4").Error(), InvalidV4AddressError(AddrV4::ParseStatus::kInvalidIntegral, 4));
+    EXPECT_EQ(
+        AddrV4::FromStr("1.2.3").Error(), InvalidV4AddressError(AddrV4::ParseStatus::kNotAtleast4Octets, 5));
+    EXPECT_EQ(AddrV4::FromStr("1.99999999999.3.4").Error(),
+        InvalidV4AddressError(AddrV4::ParseStatus::kIntegralOutOfRange, 2));
+}
+
+TEST(AddrV4, ToChars)
+{
+    Array<char, AddrV4::kMaxStringLength> buf;
+
+    auto [end, ec] = AddrV4::Broadcast().ToChars(buf.data(), buf.data() + buf.size());
+    ASSERT_EQ(ec, std::errc{ });
+    EXPECT_EQ(Str(buf.data(), end), "255.255.255.255");
+
+    // exact fit, even though the in-place writer needs slack
+    auto [end2, ec2] = AddrV4(1, 2, 3, 4).ToChars(buf.data(), buf.data() + 7);
+    ASSERT_EQ(ec2, std::errc{ });
+    EXPECT_EQ(Str(buf.data(), end2), "1.2.3.4");
+
+    auto [end3, ec3] = AddrV4(10, 20, 30, 40).ToChars(buf.data(), buf.data() + 10);
+    EXPECT_EQ(ec3, std::errc::value_too_large);
+    EXPECT_EQ(end3, buf.data() + 10);
+}
+
+TEST(AddrV4, SpecialPurposeRanges)
+{
+    EXPECT_TRUE(AddrV4(100, 64, 0, 1).Shared());
+    EXPECT_TRUE(AddrV4(100, 127, 255, 254).Shared());
+    EXPECT_FALSE(AddrV4(100, 128, 0, 1).Shared());
+
+    EXPECT_TRUE(AddrV4(198, 18, 0, 1).Benchmarking());
+    EXPECT_TRUE(AddrV4(198, 19, 255, 254).Benchmarking());
+    EXPECT_FALSE(AddrV4(198, 20, 0, 1).Benchmarking());
+
+    EXPECT_TRUE(AddrV4(192, 0, 2, 1).Documentation());
+    EXPECT_TRUE(AddrV4(198, 51, 100, 1).Documentation());
+    EXPECT_TRUE(AddrV4(203, 0, 113, 1).Documentation());
+    EXPECT_FALSE(AddrV4(192, 13, 0, 1).Documentation());
+
+    EXPECT_FALSE(AddrV4(10, 0, 0, 1).Global());
+    EXPECT_FALSE(AddrV4(192, 0, 2, 1).Global());
+    EXPECT_FALSE(AddrV4::Broadcast().Global());
+    EXPECT_TRUE(AddrV4(1, 1, 1, 1).Global());
+
+    // the rest of 192.0.0.0/24 isn't global, but its PCP and TURN anycast addresses are
+    EXPECT_FALSE(AddrV4(192, 0, 0, 8).Global());
+    EXPECT_TRUE(AddrV4(192, 0, 0, 9).Global());
+    EXPECT_TRUE(AddrV4(192, 0, 0, 10).Global());
+    EXPECT_FALSE(AddrV4(192, 0, 0, 11).Global());
+    EXPECT_TRUE(AddrV4(192, 0, 0, 9).Classify().Contains(AddrClass::kProtocolAssignment));
+    static_assert(AddrV4(192, 0, 0, 10).Global());
+}
+
+TEST(AddrV4, Classify)
+{
+    static_assert(AddrV4(8, 8, 8, 8).Classify().Empty());
+    static_assert(AddrV4(0, 0, 0, 0).Classify() == (AddrClass::kUnspecified | AddrClass::kThisNetwork));
+    static_assert(AddrV4::Broadcast().Classify() == (AddrClass::kBroadcast | AddrClass::kReserved));
+
+    EXPECT_EQ(AddrV4(0, 1, 2, 3).Classify(), AddrClassSet(AddrClass::kThisNetwork));
+    EXPECT_EQ(AddrV4(127, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kLoopback));
+    EXPECT_EQ(AddrV4(10, 1, 2, 3).Classify(), AddrClassSet(AddrClass::kPrivate));
+    EXPECT_EQ(AddrV4(172, 31, 0, 1).Classify(), AddrClassSet(AddrClass::kPrivate));
+    EXPECT_TRUE(AddrV4(172, 32, 0, 1).Classify().Empty());
+    EXPECT_EQ(AddrV4(192, 168, 0, 1).Classify(), AddrClassSet(AddrClass::kPrivate));
+    EXPECT_EQ(AddrV4(100, 100, 0, 1).Classify(), AddrClassSet(AddrClass::kShared));
+    EXPECT_EQ(AddrV4(169, 254, 1, 1).Classify(), AddrClassSet(AddrClass::kLinkLocal));
+    EXPECT_EQ(AddrV4(192, 0, 0, 8).Classify(), AddrClassSet(AddrClass::kProtocolAssignment));
+    EXPECT_EQ(AddrV4(203, 0, 113, 9).Classify(), AddrClassSet(AddrClass::kDocumentation));
+    EXPECT_EQ(AddrV4(198, 19, 0, 1).Classify(), AddrClassSet(AddrClass::kBenchmarking));
+    EXPECT_EQ(AddrV4(240, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kReserved));
+    EXPECT_EQ(AddrV4(239, 255, 255, 250).Classify(), AddrClassSet(AddrClass::kMulticast));
+    EXPECT_EQ(AddrV4(192, 31, 196, 1).Classify(), AddrClassSet(AddrClass::kAS112));
+    EXPECT_EQ(AddrV4(192, 175, 48, 6).Classify(), AddrClassSet(AddrClass::kAS112));
+    EXPECT_EQ(AddrV4(192, 52, 193, 1).Classify(), AddrClassSet(AddrClass::kAMT));
+
+    // AS112 and AMT addresses are special, but still global
+    EXPECT_TRUE(AddrV4(192, 175, 48, 6).Global());
+    EXPECT_TRUE(AddrV4(192, 52, 193, 1).Global());
+}
+
+TEST(AddrV4, ClassifyBatchMatchesScalar)
+{
+    Vec<AddrV4> addrs;
+    for (UInt32 i = 0; i < 1027; ++i) {
+        // walk the whole space with a stride that lands in most special ranges
+        UInt32 ip = i * 0x00FE4F1DU;
+        addrs.emplace_back(ip >> 24, (ip >> 16) & 0xFF, (ip >> 8) & 0xFF, ip & 0xFF);
+    }
+
+    addrs.push_back(AddrV4(0, 0, 0, 0));
+    addrs.push_back(AddrV4::Broadcast());
+    addrs.push_back(AddrV4(192, 168, 4, 4));
+
+    Vec<AddrClassSet> out(addrs.size());
+    AddrV4::Classify(addrs, out);
+
+    for (UInt i = 0; i < addrs.size(); ++i) {
+        EXPECT_EQ(out[i], addrs[i].Classify()) << "mismatch at " << addrs[i].ToString();
+    }
+}
+
+TEST(AddrV4, ParseMany)
+{
+    Array<Str, 7> inputs = { "10.0.0.1", "1.2.3.4.5", "1..3.4", "1.2.99999999999.4", "1.2.300.4", "1.2.3", "" };
+    Array<AddrV4, 7> addrs;
+    Array<AddrV4::ParseStatus, 7> status;
+
+    EXPECT_EQ(AddrV4::ParseMany(inputs, addrs, status), 1);
+
+    EXPECT_EQ(status[0], AddrV4::ParseStatus::kOk);
+    EXPECT_EQ(addrs[0], AddrV4(10, 0, 0, 1));
+    EXPECT_EQ(status[1], AddrV4::ParseStatus::kExceededOctetLimit);
+    EXPECT_EQ(status[2], AddrV4::ParseStatus::kInvalidIntegral);
+    EXPECT_EQ(status[3], AddrV4::ParseStatus::kIntegralOutOfRange);
+    EXPECT_EQ(status[4], AddrV4::ParseStatus::kMaxOctetNumber);
+    EXPECT_EQ(status[5], AddrV4::ParseStatus::kNotAtleast4Octets);
+    EXPECT_EQ(status[6], AddrV4::ParseStatus::kInvalidIntegral);
+
+    for (UInt i = 1; i < inputs.size(); ++i) {
+        EXPECT_EQ(addrs[i], AddrV4()) << "input `" << inputs[i] << "'";
+        EXPECT_FALSE(AddrV4::FromStr(inputs[i])) << "input `" << inputs[i] << "'";
+    }
+}
+
+TEST(AddrV4, ConstexprParse)
+{
+    using namespace violet::net::literals; // NOLINT(google-build-using-namespace)
+
+    static_assert(AddrV4::Parse("10.0.0.1").Unwrap() == AddrV4(10, 0, 0, 1));
+    static_assert(AddrV4::Parse("255.255.255.255").Unwrap() == AddrV4::Broadcast());
+    static_assert(!AddrV4::Parse("10.0.0"));
+    static_assert(!AddrV4::Parse("10.0.0.256"));
+    static_assert("192.168.0.1"_ipv4 == AddrV4(192, 168, 0, 1));
+    static_assert("127.0.0.1"_ipv4.Loopback());
+
+    Array<Str, 10> inputs = { "1.2.3.4", "001.002.003.004", "1.2.3.4.5", "1..3.4", "1.2.3.", "1.2x.3.4", "1.2.3.4 ",
+        "+1.2.3.4", "1.2.3.99999999999", "" };
+
+    for (const auto& input: inputs) {
+        auto expected = AddrV4::FromStr(input);
+        auto actual = AddrV4::Parse(input);
+
+        ASSERT_EQ(expected.Ok(), actual.HasValue()) << "input `" << input << "'";
+        if (actual) {
+            EXPECT_EQ(expected.Value(), actual.Unwrap());
+        }
+    }
+}
+
+TEST(AddrV4, RejectsTrailingCharactersInOctet)
+{
+    EXPECT_EQ(AddrV4::FromStr("1.2x.3.4").Error().ToString(),
+        "invalid IPv4 address: failed to parse integral value: Invalid argument");
+    EXPECT_FALSE(AddrV4::FromStr("1.2.3.4 "));
+}
+
+TEST(AddrV4, Hash)
+{
+    EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly(
+        { AddrV4(), AddrV4(0, 0, 0, 1), AddrV4(1, 0, 0, 0), AddrV4(192, 0, 2, 1), AddrV4::Broadcast() }));
+    EXPECT_EQ(std::hash<AddrV4>{ }(AddrV4(192, 0, 2, 1)), FixedHash(AddrV4(192, 0, 2, 1)));
+
+    // the addresses of a subnet fill a power-of-two table evenly, whichever bits pick the bucket
+    std::unordered_set<UInt64> low;
+    std::unordered_set<UInt64> high;
+    for (UInt32 i = 0; i < 1024; i++) {
+        const UInt64 hash = std::hash<AddrV4>{ }(AddrV4::FromUInt32(0x0A000000 + i));
+        low.insert(hash & 0xFFF);
+        high.insert(hash >> 52);
+    }
+
+    EXPECT_GT(low.size(), 800u);
+    EXPECT_GT(high.size(), 800u);
+}
@@ -19,9 +19,12 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <absl/hash/hash_testing.h>
 #include <gtest/gtest.h>
 #include <violet/Networking/IP/AddrV6.h>
 
+#include <unordered_set>
+
 // NOLINTBEGIN(google-build-using-namespace)
 using namespace violet::net::ip;
 using namespace violet;
@@ -83,6 +86,28 @@ TEST(AddrV6, RFC5952Formatting)
     EXPECT_EQ(addr3.ToString(), "fe80::202:b3ff:fe1e:8329");
 }
 
+TEST(AddrV6, ToChars)
+{
+    Array<char, AddrV6::kMaxStringLength> buf;
+
+    AddrV6 full(0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe);
+    auto [end, ec] = full.ToChars(buf.data(), buf.data() + buf.size());
+    ASSERT_EQ(ec, std::errc{ });
+    EXPECT_EQ(Str(buf.data(), end), "ffff:ffff:ffff:ffff:ffff:ffff:ffff:fffe");
+
+    AddrV6 trailing(0x2001, 0xdb8, 0, 0, 0, 0, 0, 0);
+    auto [end2, ec2] = trailing.ToChars(buf.data(), buf.data() + 10);
+    ASSERT_EQ(ec2, std::errc{ });
+    EXPECT_EQ(Str(buf.data(), end2), "2001:db8::");
+
+    auto [end3, ec3] = AddrV6::Localhost().ToChars(buf.data(), buf.data() + 2);
+    EXPECT_EQ(ec3, std::errc::value_too_large);
+    EXPECT_EQ(end3, buf.data() + 2);
+
+    EXPECT_EQ(AddrV6(0, 0xa, 0, 0, 0xb, 0, 0, 0xc).ToString(), "0:a::b:0:0:c");
+    EXPECT_EQ(AddrV6(1, 0, 2, 0, 3, 0, 4, 0).ToString(), "1:0:2:0:3:0:4:0");
+}
+
 TEST(AddrV6, FromStrValid)
 {
     auto res = AddrV6::FromStr("2001:db8::1");
@@ -107,6 +132,22 @@ TEST(AddrV6, FromStrInvalid)
     ASSERT_TRUE(res3.Err());
 }
 
+TEST(AddrV6, ParseErrorOffsets)
+{
+    static_assert(sizeof(InvalidV6AddressError) == 4);
+
+    auto error = AddrV6::FromStr("2001:db8::1::2").Error();
+    EXPECT_EQ(error.Kind(), AddrV6::ParseStatus::kMultipleColon);
+    EXPECT_EQ(error.Offset(), 11);
+
+    EXPECT_EQ(AddrV6::FromStr("2001:db8::g").Error(), InvalidV6AddressError(AddrV6::ParseStatus::kInvalidIntegral, 10));
+    EXPECT_EQ(AddrV6::FromStr("12345::").Error(), InvalidV6AddressError(AddrV6::ParseStatus::kInvalidIntegral, 0));
+    EXPECT_EQ(AddrV6::FromStr("1:2:3").Error(), InvalidV6AddressError(AddrV6::ParseStatus::kInvalidNumberOfParts, 5));
+    EXPECT_EQ(AddrV6::FromStr("::ffff:1.2.300.4").Error(),
+        InvalidV6AddressError(AddrV6::ParseStatus::kIntegralOutOfRange, 11));
+    EXPECT_EQ(AddrV6::FromStr("1:2:3").Error().ToString(), "invalid IPv6 address: invalid number of parts");
+}
+
 // TEST(AddrV6, UnicastVariants) {
 //     AddrV6 linkLocal(0xfe80,0,0,0,0,0,0,1);
 //     EXPECT_TRUE(linkLocal.Unicast());
@@ -133,6 +174,94 @@ TEST(AddrV6, BenchmarkingAndDocumentation)
     ASSERT_TRUE(doc.Documentation());
 }
 
+TEST(AddrV6, Classify)
+{
+    static_assert(AddrV6().Classify() == AddrClassSet(AddrClass::kUnspecified));
+    static_assert(AddrV6::Localhost().Classify() == AddrClassSet(AddrClass::kLoopback));
+    static_assert(AddrV6(0x2606, 0x4700, 0, 0, 0, 0, 0, 0x1111).Classify().Empty());
+
+    EXPECT_EQ(AddrV6(0, 0, 0, 0, 0, 0xffff, 0x0a00, 1).Classify(), AddrClassSet(AddrClass::kIPv4Mapped));
+    EXPECT_EQ(AddrV6(0x64, 0xff9b, 0, 0, 0, 0, 0x0808, 0x0808).Classify(), AddrClassSet(AddrClass::kTranslation));
+    EXPECT_EQ(AddrV6(0x64, 0xff9b, 1, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kTranslation));
+    EXPECT_EQ(AddrV6(0x100, 0, 0, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kDiscardOnly));
+    EXPECT_EQ(AddrV6(0x2001, 0x0002, 0, 0, 0, 0, 0, 1).Classify(),
+        AddrClass::kProtocolAssignment | AddrClass::kBenchmarking);
+    EXPECT_EQ(AddrV6(0x2001, 0x0db8, 0, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kDocumentation));
+    EXPECT_EQ(AddrV6(0x3fff, 0x0fff, 0, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kDocumentation));
+    EXPECT_EQ(AddrV6(0xfd00, 0, 0, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kUniqueLocal));
+    EXPECT_EQ(AddrV6(0xfebf, 0, 0, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kLinkLocal));
+    EXPECT_EQ(AddrV6(0xff02, 0, 0, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kMulticast));
+    EXPECT_EQ(AddrV6(0x2001, 0x0003, 0, 0, 0, 0, 0, 1).Classify(), AddrClass::kProtocolAssignment | AddrClass::kAMT);
+    EXPECT_EQ(AddrV6(0x2001, 0x0004, 0x0112, 0, 0, 0, 0, 1).Classify(),
+        AddrClass::kProtocolAssignment | AddrClass::kAS112);
+    EXPECT_EQ(AddrV6(0x2001, 0x002f, 0, 0, 0, 0, 0, 1).Classify(),
+        AddrClass::kProtocolAssignment | AddrClass::kORCHIDv2);
+    EXPECT_EQ(AddrV6(0x2001, 0x0030, 0, 0, 0, 0, 0, 1).Classify(),
+        AddrClass::kProtocolAssignment | AddrClass::kDroneRemoteId);
+    EXPECT_EQ(AddrV6(0x2002, 0xc000, 0x0201, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::k6to4));
+    EXPECT_EQ(AddrV6(0x2620, 0x004f, 0x8000, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kAS112));
+    EXPECT_TRUE(AddrV6(0x2620, 0x004f, 0x8001, 0, 0, 0, 0, 1).Classify().Empty());
+    EXPECT_EQ(AddrV6(0x5f00, 0x0001, 0, 0, 0, 0, 0, 1).Classify(), AddrClassSet(AddrClass::kSegmentRouting));
+    EXPECT_TRUE(AddrV6(0x5f01, 0, 0, 0, 0, 0, 0, 1).Classify().Empty());
+
+    EXPECT_FALSE(AddrV6(0x2001, 0x0003, 0, 0, 0, 0, 0, 1).Benchmarking());
+
+    Array<AddrV6, 3> addrs = { AddrV6::Localhost(), AddrV6(0xff02, 0, 0, 0, 0, 0, 0, 1), AddrV6() };
+    Array<AddrClassSet, 3> out;
+    AddrV6::Classify(addrs, out);
+
+    for (UInt i = 0; i < addrs.size(); ++i) {
+        EXPECT_EQ(out[i], addrs[i].Classify());
+    }
+}
+
+TEST(AddrV6, ParseMany)
+{
+    Array<Str, 6> inputs = { "2001:db8::1", "1:2:3", "::ffff:1.2.3", "::ffff:1.2.3.256", "1::2::3", "::ffff:10.0.0.1" };
+    Array<AddrV6, 6> addrs;
+    Array<AddrV6::ParseStatus, 6> status;
+
+    EXPECT_EQ(AddrV6::ParseMany(inputs, addrs, status), 2);
+
+    EXPECT_EQ(status[0], AddrV6::ParseStatus::kOk);
+    EXPECT_EQ(addrs[0], AddrV6(0x2001, 0xdb8, 0, 0, 0, 0, 0, 1));
+    EXPECT_EQ(status[1], AddrV6::ParseStatus::kInvalidNumberOfParts);
+    EXPECT_EQ(status[2], AddrV6::ParseStatus::kInvalidIntegral);
+    EXPECT_EQ(status[3], AddrV6::ParseStatus::kIntegralOutOfRange);
+    EXPECT_EQ(status[4], AddrV6::ParseStatus::kMultipleColon);
+    EXPECT_EQ(status[5], AddrV6::ParseStatus::kOk);
+    EXPECT_EQ(addrs[5], AddrV6(0, 0, 0, 0, 0, 0xffff, 0x0a00, 1));
+
+    for (UInt i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(AddrV6::FromStr(inputs[i]).Ok(), status[i] == AddrV6::ParseStatus::kOk);
+    }
+}
+
+TEST(AddrV6, ConstexprParse)
+{
+    using namespace violet::net::literals; // NOLINT(google-build-using-namespace)
+
+    static_assert(AddrV6::Parse("::1").Unwrap() == AddrV6::Localhost());
+    static_assert(AddrV6::Parse("2001:db8::8a2e:370:7334").Unwrap()
+        == AddrV6(0x2001, 0x0db8, 0, 0, 0, 0x8a2e, 0x0370, 0x7334));
+    static_assert(!AddrV6::Parse("1::2::3"));
+    static_assert("fe80::1"_ipv6.LinkLocal());
+    static_assert("::ffff:10.0.0.1"_ipv6 == AddrV6(0, 0, 0, 0, 0, 0xffff, 0x0a00, 1));
+
+    Array<Str, 8> inputs = { "::", "1:2:3:4:5:6:7:8", "1::", "::ffff:1.2.3.4", "1:2:3:4:5:6:7:8:9", ":1", "g::1",
+        "" };
+
+    for (const auto& input: inputs) {
+        auto expected = AddrV6::FromStr(input);
+        auto actual = AddrV6::Parse(input);
+
+        ASSERT_EQ(expected.Ok(), actual.HasValue()) << "input `" << input << "'";
+        if (actual) {
+            EXPECT_EQ(expected.Value(), actual.Unwrap());
+        }
+    }
+}
+
 TEST(AddrV6, UInt128Conversion)
 {
     AddrV6 a1(0x2001, 0xdb8, 0, 0, 0, 0, 0, 1);
@@ -142,6 +271,42 @@ TEST(AddrV6, UInt128Conversion)
     EXPECT_EQ(a1.ToString(), b1.ToString());
 }
 
+TEST(AddrV6, WordAccess)
+{
+    constexpr AddrV6 addr(0x2001, 0x0db8, 0x85a3, 0x0000, 0x0000, 0x8a2e, 0x0370, 0x7334);
+    static_assert(addr.High64() == 0x20010db885a30000);
+    static_assert(addr.Low64() == 0x00008a2e03707334);
+    static_assert(AddrV6(addr.Hextets()) == addr);
+    static_assert(AddrV6::FromWords(addr.High64(), addr.Low64()) == addr);
+
+    EXPECT_EQ(addr.Hextets()[0], 0x20);
+    EXPECT_EQ(addr.Hextets()[15], 0x34);
+
+    EXPECT_TRUE(AddrV6::FromWords(1, 0) > AddrV6::FromWords(0, ~UInt64{ 0 }));
+    EXPECT_TRUE(AddrV6::FromWords(1, 1) < AddrV6::FromWords(1, 2));
+
+    auto mask = AddrV6::FromWords(~UInt64{ 0 }, 0);
+    EXPECT_EQ(addr & mask, AddrV6(0x2001, 0x0db8, 0x85a3, 0, 0, 0, 0, 0));
+    EXPECT_EQ((addr | ~mask).Low64(), ~UInt64{ 0 });
+}
+
+TEST(AddrV6, Hash)
+{
+    EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly({ AddrV6(), AddrV6::Localhost(), AddrV6::FromWords(1, 0),
+        AddrV6::FromWords(0x20010DB800000002, 1), AddrV6::FromWords(0x20010DB800000000, 0) }));
+    EXPECT_EQ(std::hash<AddrV6>{ }(AddrV6::Localhost()), FixedHash(AddrV6::Localhost()));
+
+    // the first hosts of neighbouring subnets, which collided when the two words were combined with a shift
+    std::unordered_set<UInt> hashes;
+    for (UInt64 subnet = 0; subnet < 256; subnet++) {
+        for (UInt64 host = 0; host < 256; host++) {
+            hashes.insert(std::hash<AddrV6>{ }(AddrV6::FromWords(0x20010DB800000000 | subnet, host)));
+        }
+    }
+
+    EXPECT_EQ(hashes.size(), 256u * 256u);
+}
+
 namespace {
 
 struct AddrV6RFC: public testing::Test {
@@ -273,3 +438,24 @@ TEST_F(AddrV6RFC, OnlySingleColon)
 {
     ExpectFailure(":");
 }
+
+TEST_F(AddrV6RFC, TrailingCompression)
+{
+    ExpectSuccess("fe80::", { 0xfe80, 0, 0, 0, 0, 0, 0, 0 });
+}
+
+TEST_F(AddrV6RFC, IPv4WithoutCompression)
+{
+    ExpectSuccess("1:2:3:4:5:6:10.0.0.1", { 1, 2, 3, 4, 5, 6, 0x0a00, 0x0001 });
+}
+
+TEST_F(AddrV6RFC, TripleColon)
+{
+    ExpectFailure(":::");
+    ExpectFailure("1:::2");
+}
+
+TEST_F(AddrV6RFC, IPv4TooManyHextets)
+{
+    ExpectFailure("1:2:3:4:5:6:7:10.0.0.1");
+}
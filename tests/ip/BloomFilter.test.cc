@@ -0,0 +1,116 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/BloomFilter.h>
+#include <violet/Networking/IPAddress.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+// even addresses go in, odd ones are only queried
+auto member(UInt32 i) -> AddrV4
+{
+    return AddrV4::FromUInt32(i * 2);
+}
+
+auto stranger(UInt32 i) -> AddrV4
+{
+    return AddrV4::FromUInt32((i * 2) + 1);
+}
+
+} // namespace
+
+TEST(BloomFilter, Empty)
+{
+    const BloomFilter<AddrV4> filter(1000);
+    EXPECT_FALSE(filter.MayContain(AddrV4(10, 0, 0, 1)));
+    EXPECT_EQ(filter.MemoryUsage(), 1504u);
+}
+
+TEST(BloomFilter, HasNoFalseNegatives)
+{
+    constexpr UInt32 kCount = 100'000;
+
+    BloomFilter<AddrV4> filter(kCount);
+    for (UInt32 i = 0; i < kCount; i++) {
+        filter.Insert(member(i));
+    }
+
+    for (UInt32 i = 0; i < kCount; i++) {
+        ASSERT_TRUE(filter.MayContain(member(i))) << member(i);
+    }
+}
+
+TEST(BloomFilter, FalsePositiveRate)
+{
+    constexpr UInt32 kCount = 100'000;
+
+    for (const auto& [bits, rate]: Vec<std::pair<UInt, double>>{ { 8, 0.04 }, { 12, 0.007 }, { 16, 0.002 } }) {
+        BloomFilter<AddrV4> filter(kCount, bits);
+        for (UInt32 i = 0; i < kCount; i++) {
+            filter.Insert(member(i));
+        }
+
+        UInt positives = 0;
+        for (UInt32 i = 0; i < kCount; i++) {
+            positives += filter.MayContain(stranger(i)) ? 1 : 0;
+        }
+
+        EXPECT_LT(static_cast<double>(positives) / kCount, rate) << bits << " bits per address";
+    }
+}
+
+TEST(BloomFilter, AddressFamilies)
+{
+    BloomFilter<AddrV6> v6(100);
+    v6.Insert(AddrV6::FromStr("2001:db8::1").Value());
+    EXPECT_TRUE(v6.MayContain(AddrV6::FromStr("2001:db8::1").Value()));
+    EXPECT_FALSE(v6.MayContain(AddrV6::FromStr("2001:db8::2").Value()));
+
+    BloomFilter<IPAddress> both(100);
+    both.Insert(IPAddress::V4(AddrV4(192, 0, 2, 1)));
+    both.Insert(IPAddress::V6(AddrV6::Localhost()));
+    EXPECT_TRUE(both.MayContain(IPAddress::V4(AddrV4(192, 0, 2, 1))));
+    EXPECT_TRUE(both.MayContain(IPAddress::V6(AddrV6::Localhost())));
+    EXPECT_FALSE(both.MayContain(IPAddress::V4(AddrV4(192, 0, 2, 2))));
+}
+
+TEST(BloomFilter, MergeAndClear)
+{
+    BloomFilter<AddrV4> first(1000);
+    BloomFilter<AddrV4> second(1000);
+    first.Insert(AddrV4(10, 0, 0, 1));
+    second.Insert(AddrV4(10, 0, 0, 2));
+
+    first.Merge(second);
+    EXPECT_TRUE(first.MayContain(AddrV4(10, 0, 0, 1)));
+    EXPECT_TRUE(first.MayContain(AddrV4(10, 0, 0, 2)));
+
+    first.Clear();
+    EXPECT_FALSE(first.MayContain(AddrV4(10, 0, 0, 1)));
+    EXPECT_FALSE(first.MayContain(AddrV4(10, 0, 0, 2)));
+}
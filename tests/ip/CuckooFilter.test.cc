@@ -0,0 +1,139 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/CuckooFilter.h>
+#include <violet/Networking/IPAddress.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto member(UInt64 i) -> AddrV6
+{
+    return AddrV6(absl::MakeUint128(0x20010DB800000000, i * 2));
+}
+
+auto stranger(UInt64 i) -> AddrV6
+{
+    return AddrV6(absl::MakeUint128(0x20010DB800000000, (i * 2) + 1));
+}
+
+} // namespace
+
+TEST(CuckooFilter, InsertAndRemove)
+{
+    CuckooFilter<AddrV4> filter(100);
+    EXPECT_TRUE(filter.Empty());
+    EXPECT_FALSE(filter.MayContain(AddrV4(10, 0, 0, 1)));
+
+    EXPECT_TRUE(filter.Insert(AddrV4(10, 0, 0, 1)));
+    EXPECT_TRUE(filter.Insert(AddrV4(10, 0, 0, 2)));
+    EXPECT_EQ(filter.Size(), 2u);
+    EXPECT_TRUE(filter.MayContain(AddrV4(10, 0, 0, 1)));
+
+    EXPECT_TRUE(filter.Remove(AddrV4(10, 0, 0, 1)));
+    EXPECT_FALSE(filter.MayContain(AddrV4(10, 0, 0, 1)));
+    EXPECT_TRUE(filter.MayContain(AddrV4(10, 0, 0, 2)));
+    EXPECT_FALSE(filter.Remove(AddrV4(10, 0, 0, 1)));
+    EXPECT_EQ(filter.Size(), 1u);
+
+    filter.Clear();
+    EXPECT_TRUE(filter.Empty());
+    EXPECT_FALSE(filter.MayContain(AddrV4(10, 0, 0, 2)));
+}
+
+TEST(CuckooFilter, DuplicatesAreCounted)
+{
+    CuckooFilter<AddrV4> filter(100);
+    filter.Insert(AddrV4(10, 0, 0, 1));
+    filter.Insert(AddrV4(10, 0, 0, 1));
+
+    EXPECT_TRUE(filter.Remove(AddrV4(10, 0, 0, 1)));
+    EXPECT_TRUE(filter.MayContain(AddrV4(10, 0, 0, 1)));
+    EXPECT_TRUE(filter.Remove(AddrV4(10, 0, 0, 1)));
+    EXPECT_FALSE(filter.MayContain(AddrV4(10, 0, 0, 1)));
+}
+
+TEST(CuckooFilter, HoldsItsCapacity)
+{
+    constexpr UInt kCount = 100'000;
+
+    CuckooFilter<AddrV6> filter(kCount);
+    EXPECT_LT(filter.MemoryUsage() * 8 / kCount, 17u);
+
+    for (UInt i = 0; i < kCount; i++) {
+        ASSERT_TRUE(filter.Insert(member(i))) << i;
+    }
+
+    UInt positives = 0;
+    for (UInt i = 0; i < kCount; i++) {
+        ASSERT_TRUE(filter.MayContain(member(i))) << i;
+        positives += filter.MayContain(stranger(i)) ? 1 : 0;
+    }
+
+    EXPECT_LT(static_cast<double>(positives) / kCount, 0.0005);
+}
+
+TEST(CuckooFilter, RemovingMakesRoomWhenFull)
+{
+    CuckooFilter<AddrV6> filter(1000);
+
+    UInt count = 0;
+    while (filter.Insert(member(count))) {
+        count++;
+    }
+
+    // the address that filled it is kept, and nothing else fits
+    EXPECT_GE(count, 1000u);
+    EXPECT_EQ(filter.Size(), count);
+    EXPECT_FALSE(filter.Insert(member(count + 1)));
+    for (UInt i = 0; i < count; i++) {
+        ASSERT_TRUE(filter.MayContain(member(i))) << i;
+    }
+
+    for (UInt i = 0; i < count; i += 2) {
+        ASSERT_TRUE(filter.Remove(member(i))) << i;
+    }
+
+    EXPECT_EQ(filter.Size(), count - ((count + 1) / 2));
+    for (UInt i = 1; i < count; i += 2) {
+        ASSERT_TRUE(filter.MayContain(member(i))) << i;
+    }
+
+    EXPECT_TRUE(filter.Insert(member(count + 1)));
+}
+
+TEST(CuckooFilter, MixedFamilies)
+{
+    CuckooFilter<IPAddress> filter(100);
+    filter.Insert(IPAddress::V4(AddrV4(192, 0, 2, 1)));
+    filter.Insert(IPAddress::V6(AddrV6::Localhost()));
+
+    EXPECT_TRUE(filter.MayContain(IPAddress::V4(AddrV4(192, 0, 2, 1))));
+    EXPECT_TRUE(filter.MayContain(IPAddress::V6(AddrV6::Localhost())));
+    EXPECT_TRUE(filter.Remove(IPAddress::V6(AddrV6::Localhost())));
+    EXPECT_FALSE(filter.MayContain(IPAddress::V6(AddrV6::Localhost())));
+}
@@ -0,0 +1,75 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/FixedHash.h>
+#include <violet/Networking/IPAddress.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto addr(Str input) -> AddrV6
+{
+    return AddrV6::FromStr(input).Value();
+}
+
+} // namespace
+
+TEST(FixedHash, IsStable)
+{
+    // these can never change: filters and files that are sized for them would stop working
+    EXPECT_EQ(FixedHash(AddrV4(192, 0, 2, 1)), 0xE345F7B1D459776Eu);
+    EXPECT_EQ(FixedHash(AddrV4(192, 0, 2, 1), 42), 0x4CAA5DF8DA2D168Fu);
+    EXPECT_EQ(FixedHash(addr("2001:db8::1")), 0x48C505BEC6F2FE2Eu);
+    EXPECT_EQ(FixedHash(addr("2001:db8::1"), 42), 0x578ECCA0AE6C1685u);
+
+    static_assert(FixedHash(AddrV4(192, 0, 2, 1)) == 0xE345F7B1D459776Eu);
+}
+
+TEST(FixedHash, SeparatesFamiliesAndSeeds)
+{
+    EXPECT_NE(FixedHash(AddrV4(10, 0, 0, 1)), FixedHash(addr("::a00:1")));
+    EXPECT_NE(FixedHash(AddrV4(10, 0, 0, 1)), FixedHash(AddrV4(10, 0, 0, 1), 1));
+    EXPECT_NE(FixedHash(addr("2001:db8::1")), FixedHash(addr("2001:db8::1:0:0:0")));
+}
+
+TEST(FixedHash, OfIPAddressIsTheHashOfItsAddress)
+{
+    EXPECT_EQ(FixedHash(IPAddress::V4(AddrV4(192, 0, 2, 1)), 7), FixedHash(AddrV4(192, 0, 2, 1), 7));
+    EXPECT_EQ(FixedHash(IPAddress::V6(addr("2001:db8::1")), 7), FixedHash(addr("2001:db8::1"), 7));
+}
+
+TEST(FixedHash, MixesEveryBit)
+{
+    // flipping any input bit flips about half of the output bits
+    const AddrV6 base = addr("2001:db8:85a3::8a2e:370:7334");
+    for (UInt bit = 0; bit < 128; bit++) {
+        const AddrV6 flipped(base.AsUInt128() ^ (absl::uint128(1) << bit));
+        const int changed = std::popcount(FixedHash(base) ^ FixedHash(flipped));
+        EXPECT_GT(changed, 12) << bit;
+        EXPECT_LT(changed, 52) << bit;
+    }
+}
@@ -0,0 +1,207 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/IPSetV4.h>
+
+#include <bitset>
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto cidr(Str input) -> NetworkV4
+{
+    return NetworkV4::FromStr(input).Value();
+}
+
+auto ranges(const IPSetV4& set) -> Vec<IPSetV4::Range>
+{
+    return { set.begin(), set.end() };
+}
+
+// the brute-force tests only use addresses in `10.0.0.0/20`, so a set fits in a bitset
+constexpr UInt32 kBase = 0x0A000000;
+constexpr UInt kUniverse = 4096;
+using Bits = std::bitset<kUniverse>;
+
+auto randomSet(std::mt19937& rng, Bits& bits) -> IPSetV4
+{
+    IPSetV4::Builder builder;
+    for (int i = 0; i < 40; i++) {
+        const UInt32 first = rng() % kUniverse;
+        const UInt32 last = std::min<UInt32>(first + (rng() % 200), kUniverse - 1);
+        builder.Add(AddrV4::FromUInt32(kBase + first), AddrV4::FromUInt32(kBase + last));
+
+        for (UInt32 key = first; key <= last; key++) {
+            bits.set(key);
+        }
+    }
+
+    return builder.Build();
+}
+
+void expectMatches(const IPSetV4& set, const Bits& bits)
+{
+    for (UInt32 key = 0; key < kUniverse; key++) {
+        EXPECT_EQ(set.Contains(AddrV4::FromUInt32(kBase + key)), bits.test(key)) << key;
+    }
+
+    EXPECT_FALSE(set.Contains(AddrV4::FromUInt32(kBase - 1)));
+    EXPECT_FALSE(set.Contains(AddrV4::FromUInt32(kBase + kUniverse)));
+}
+
+} // namespace
+
+TEST(IPSetV4, Empty)
+{
+    const IPSetV4 set;
+    EXPECT_TRUE(set.Empty());
+    EXPECT_EQ(set.begin(), set.end());
+    EXPECT_FALSE(set.Contains(AddrV4()));
+    EXPECT_FALSE(set.Contains(AddrV4::Broadcast()));
+    EXPECT_FALSE(set.Contains(cidr("0.0.0.0/0")));
+    EXPECT_EQ(set, IPSetV4::Builder().Build());
+}
+
+TEST(IPSetV4, MergesOverlappingAndAdjacentRanges)
+{
+    const IPSetV4 set = IPSetV4::Builder()
+                            .Add(AddrV4(10, 0, 0, 10), AddrV4(10, 0, 0, 20))
+                            .Add(AddrV4(10, 0, 0, 15), AddrV4(10, 0, 0, 30))
+                            .Add(AddrV4(10, 0, 0, 31))
+                            .Add(AddrV4(10, 0, 0, 5))
+                            .Add(cidr("192.168.0.0/24"))
+                            .Add(cidr("192.168.1.0/24"))
+                            .Build();
+
+    const Vec<IPSetV4::Range> expected{
+        { AddrV4(10, 0, 0, 5), AddrV4(10, 0, 0, 5) },
+        { AddrV4(10, 0, 0, 10), AddrV4(10, 0, 0, 31) },
+        { AddrV4(192, 168, 0, 0), AddrV4(192, 168, 1, 255) },
+    };
+
+    EXPECT_EQ(set.Size(), 3);
+    EXPECT_EQ(ranges(set), expected);
+    EXPECT_EQ(set.MemoryUsage(), 4 * 8);
+
+    EXPECT_TRUE(set.Contains(AddrV4(10, 0, 0, 5)));
+    EXPECT_FALSE(set.Contains(AddrV4(10, 0, 0, 6)));
+    EXPECT_TRUE(set.Contains(AddrV4(10, 0, 0, 31)));
+    EXPECT_FALSE(set.Contains(AddrV4(10, 0, 0, 32)));
+    EXPECT_TRUE(set.Contains(AddrV4(192, 168, 1, 1)));
+}
+
+TEST(IPSetV4, ContainsNetwork)
+{
+    const IPSetV4 set = IPSetV4::Builder().Add(cidr("10.0.0.0/24")).Add(cidr("10.0.1.0/24")).Build();
+    EXPECT_TRUE(set.Contains(cidr("10.0.0.0/23")));
+    EXPECT_TRUE(set.Contains(cidr("10.0.1.128/25")));
+    EXPECT_FALSE(set.Contains(cidr("10.0.0.0/22")));
+    EXPECT_FALSE(set.Contains(cidr("10.0.2.0/24")));
+}
+
+TEST(IPSetV4, MovedFromIsEmpty)
+{
+    IPSetV4 set = IPSetV4::Builder().Add(cidr("10.0.0.0/24")).Add(cidr("192.168.0.0/16")).Build();
+    const IPSetV4 moved = std::move(set);
+    EXPECT_EQ(moved.Size(), 2);
+
+    // NOLINTBEGIN(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+    EXPECT_TRUE(set.Empty());
+    EXPECT_EQ(set.Size(), 0);
+    EXPECT_EQ(set.begin(), set.end());
+    EXPECT_FALSE(set.Contains(AddrV4(10, 0, 0, 1)));
+    EXPECT_FALSE(set.Contains(AddrV4::Broadcast()));
+    EXPECT_EQ(set, IPSetV4());
+    EXPECT_EQ(set.Union(moved), moved);
+
+    set = moved;
+    EXPECT_TRUE(set.Contains(AddrV4(10, 0, 0, 1)));
+    // NOLINTEND(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+}
+
+TEST(IPSetV4, WholeAddressSpace)
+{
+    // the first and last addresses mustn't wrap around when ranges are merged or cut
+    const IPSetV4 all = IPSetV4::Builder()
+                            .Add(AddrV4(), AddrV4(127, 255, 255, 255))
+                            .Add(AddrV4(128, 0, 0, 0), AddrV4::Broadcast())
+                            .Build();
+
+    EXPECT_EQ(all.Size(), 1);
+    EXPECT_TRUE(all.Contains(cidr("0.0.0.0/0")));
+
+    const IPSetV4 edges = IPSetV4::Builder().Add(AddrV4()).Add(AddrV4::Broadcast()).Build();
+    const IPSetV4 middle = all.Difference(edges);
+
+    EXPECT_EQ(ranges(middle), (Vec<IPSetV4::Range>{ { AddrV4(0, 0, 0, 1), AddrV4(255, 255, 255, 254) } }));
+    EXPECT_EQ(middle.Union(edges), all);
+    EXPECT_EQ(all.Intersection(edges), edges);
+    EXPECT_TRUE(edges.Difference(all).Empty());
+}
+
+TEST(IPSetV4, SetOperations)
+{
+    const IPSetV4 lhs = IPSetV4::Builder().Add(AddrV4(10, 0, 0, 0), AddrV4(10, 0, 0, 99)).Build();
+    const IPSetV4 rhs = IPSetV4::Builder()
+                            .Add(AddrV4(10, 0, 0, 10), AddrV4(10, 0, 0, 19))
+                            .Add(AddrV4(10, 0, 0, 90), AddrV4(10, 0, 0, 200))
+                            .Build();
+
+    EXPECT_EQ(ranges(lhs.Union(rhs)), (Vec<IPSetV4::Range>{ { AddrV4(10, 0, 0, 0), AddrV4(10, 0, 0, 200) } }));
+    EXPECT_EQ(ranges(lhs.Intersection(rhs)),
+        (Vec<IPSetV4::Range>{
+            { AddrV4(10, 0, 0, 10), AddrV4(10, 0, 0, 19) },
+            { AddrV4(10, 0, 0, 90), AddrV4(10, 0, 0, 99) },
+        }));
+    EXPECT_EQ(ranges(lhs.Difference(rhs)),
+        (Vec<IPSetV4::Range>{
+            { AddrV4(10, 0, 0, 0), AddrV4(10, 0, 0, 9) },
+            { AddrV4(10, 0, 0, 20), AddrV4(10, 0, 0, 89) },
+        }));
+    EXPECT_EQ(ranges(rhs.Difference(lhs)),
+        (Vec<IPSetV4::Range>{ { AddrV4(10, 0, 0, 100), AddrV4(10, 0, 0, 200) } }));
+}
+
+TEST(IPSetV4, MatchesBruteForce)
+{
+    std::mt19937 rng(7); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    for (int round = 0; round < 20; round++) {
+        Bits lhsBits;
+        Bits rhsBits;
+        const IPSetV4 lhs = randomSet(rng, lhsBits);
+        const IPSetV4 rhs = randomSet(rng, rhsBits);
+
+        expectMatches(lhs, lhsBits);
+        expectMatches(lhs.Union(rhs), lhsBits | rhsBits);
+        expectMatches(lhs.Intersection(rhs), lhsBits & rhsBits);
+        expectMatches(lhs.Difference(rhs), lhsBits & ~rhsBits);
+
+        // rebuilding from the ranges gives the same layout
+        EXPECT_EQ(IPSetV4::Builder().Add(lhs).Build(), lhs);
+    }
+}
@@ -0,0 +1,133 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/IPSetV6.h>
+
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto cidr(Str input) -> NetworkV6
+{
+    return NetworkV6::FromStr(input).Value();
+}
+
+auto addr(Str input) -> AddrV6
+{
+    return AddrV6::FromStr(input).Value();
+}
+
+auto ranges(const IPSetV6& set) -> Vec<IPSetV6::Range>
+{
+    return { set.begin(), set.end() };
+}
+
+} // namespace
+
+TEST(IPSetV6, Empty)
+{
+    const IPSetV6 set;
+    EXPECT_TRUE(set.Empty());
+    EXPECT_EQ(set.begin(), set.end());
+    EXPECT_FALSE(set.Contains(AddrV6()));
+    EXPECT_FALSE(set.Contains(~AddrV6()));
+}
+
+TEST(IPSetV6, MergesOverlappingAndAdjacentRanges)
+{
+    // the two networks meet across the boundary between the 64-bit halves
+    const IPSetV6 set = IPSetV6::Builder()
+                            .Add(cidr("2001:db8:0:0::/64"))
+                            .Add(cidr("2001:db8:0:1::/64"))
+                            .Add(addr("2001:db8::5"))
+                            .Add(AddrV6::Localhost())
+                            .Build();
+
+    const Vec<IPSetV6::Range> expected{
+        { AddrV6::Localhost(), AddrV6::Localhost() },
+        { addr("2001:db8::"), addr("2001:db8:0:1:ffff:ffff:ffff:ffff") },
+    };
+
+    EXPECT_EQ(ranges(set), expected);
+    EXPECT_EQ(set.MemoryUsage(), 3 * 32);
+
+    EXPECT_TRUE(set.Contains(addr("2001:db8:0:1::1")));
+    EXPECT_FALSE(set.Contains(addr("2001:db8:0:2::")));
+    EXPECT_TRUE(set.Contains(cidr("2001:db8::/63")));
+    EXPECT_FALSE(set.Contains(cidr("2001:db8::/62")));
+}
+
+TEST(IPSetV6, WholeAddressSpace)
+{
+    const IPSetV6 all = IPSetV6::Builder().Add(cidr("::/1")).Add(cidr("8000::/1")).Build();
+    EXPECT_EQ(all.Size(), 1);
+    EXPECT_TRUE(all.Contains(cidr("::/0")));
+
+    const IPSetV6 edges = IPSetV6::Builder().Add(AddrV6()).Add(~AddrV6()).Build();
+    EXPECT_EQ(ranges(all.Difference(edges)),
+        (Vec<IPSetV6::Range>{ { addr("::1"), addr("ffff:ffff:ffff:ffff:ffff:ffff:ffff:fffe") } }));
+    EXPECT_EQ(all.Difference(edges).Union(edges), all);
+}
+
+TEST(IPSetV6, MatchesSortedSearch)
+{
+    std::mt19937_64 rng(11); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    // sizes around powers of two exercise every shape of the last level of the tree
+    for (const UInt count: { 1, 2, 3, 7, 8, 9, 100, 1000 }) {
+        IPSetV6::Builder builder;
+        Vec<std::pair<absl::uint128, absl::uint128>> expected;
+        for (UInt i = 0; i < count; i++) {
+            // disjoint and non-adjacent, in a random order
+            const absl::uint128 first = absl::MakeUint128(rng() % 4, 0) + (absl::uint128(i) << 70);
+            expected.emplace_back(first, first + (rng() % 1000));
+        }
+
+        std::ranges::shuffle(expected, rng);
+        for (const auto& [first, last]: expected) {
+            builder.Add(AddrV6(first), AddrV6(last));
+        }
+
+        const IPSetV6 set = builder.Build();
+        ASSERT_EQ(set.Size(), count);
+
+        for (const auto& [first, last]: expected) {
+            EXPECT_TRUE(set.Contains(AddrV6(first)));
+            EXPECT_TRUE(set.Contains(AddrV6(last)));
+            EXPECT_FALSE(set.Contains(AddrV6(first - 1)));
+            EXPECT_FALSE(set.Contains(AddrV6(last + 1)));
+        }
+
+        std::ranges::sort(expected);
+        UInt i = 0;
+        for (const auto& range: set) {
+            EXPECT_EQ(range.First, AddrV6(expected[i].first));
+            EXPECT_EQ(range.Last, AddrV6(expected[i].second));
+            i++;
+        }
+    }
+}
@@ -0,0 +1,181 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/NetworkV4.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto cidr(Str input) -> NetworkV4
+{
+    auto result = NetworkV4::FromStr(input);
+    EXPECT_TRUE(result) << "failed to parse `" << input << "': " << result.Error();
+
+    return result.Value();
+}
+
+} // namespace
+
+TEST(NetworkV4, Defaults)
+{
+    NetworkV4 all;
+    EXPECT_EQ(all.Address(), AddrV4());
+    EXPECT_EQ(all.PrefixLength(), 0);
+    EXPECT_TRUE(all.Contains(AddrV4::Broadcast()));
+    EXPECT_EQ(all.ToString(), "0.0.0.0/0");
+}
+
+TEST(NetworkV4, ClearsHostBits)
+{
+    NetworkV4 network(AddrV4(10, 1, 2, 3), 8);
+    EXPECT_EQ(network.Address(), AddrV4(10, 0, 0, 0));
+    EXPECT_EQ(network, cidr("10.1.2.3/8"));
+    EXPECT_EQ(network.ToString(), "10.0.0.0/8");
+}
+
+TEST(NetworkV4, Masks)
+{
+    auto network = cidr("192.168.0.0/16");
+    EXPECT_EQ(network.Netmask(), AddrV4(255, 255, 0, 0));
+    EXPECT_EQ(network.Hostmask(), AddrV4(0, 0, 255, 255));
+    EXPECT_EQ(network.Last(), AddrV4(192, 168, 255, 255));
+
+    EXPECT_EQ(cidr("0.0.0.0/0").Netmask(), AddrV4());
+    EXPECT_EQ(cidr("1.2.3.4/32").Netmask(), AddrV4::Broadcast());
+    EXPECT_EQ(cidr("1.2.3.4/32").Last(), AddrV4(1, 2, 3, 4));
+}
+
+TEST(NetworkV4, FromStr)
+{
+    EXPECT_EQ(cidr("1.2.3.4"), NetworkV4(AddrV4(1, 2, 3, 4), 32));
+    EXPECT_EQ(cidr("172.16.0.0/12").PrefixLength(), 12);
+
+    auto error = NetworkV4::FromStr("10.0.0.0/33").Error();
+    EXPECT_EQ(error.Kind(), NetworkV4::ParseStatus::kPrefixOutOfRange);
+    EXPECT_EQ(error.Offset(), 9);
+    EXPECT_EQ(error.ToString(), "invalid IPv4 network: prefix length is larger than 32");
+
+    EXPECT_EQ(NetworkV4::FromStr("10.0.0.0/").Error().Kind(), NetworkV4::ParseStatus::kInvalidPrefix);
+    EXPECT_EQ(NetworkV4::FromStr("10.0.0.0/8x").Error().Kind(), NetworkV4::ParseStatus::kInvalidPrefix);
+    EXPECT_EQ(NetworkV4::FromStr("10.0.0.0/-1").Error().Kind(), NetworkV4::ParseStatus::kInvalidPrefix);
+
+    auto address = NetworkV4::FromStr("10.0.300.0/24").Error();
+    EXPECT_EQ(address.Kind(), NetworkV4::ParseStatus::kInvalidAddress);
+    ASSERT_TRUE(address.Address());
+    EXPECT_EQ(address.Address()->Kind(), AddrV4::ParseStatus::kMaxOctetNumber);
+    EXPECT_EQ(address.Offset(), 5);
+}
+
+TEST(NetworkV4, ConstexprParse)
+{
+    static_assert(NetworkV4::Parse("10.0.0.0/8").Unwrap() == NetworkV4(AddrV4(10, 0, 0, 0), 8));
+    static_assert(NetworkV4::Parse("10.0.0.1").Unwrap().PrefixLength() == 32);
+    static_assert(!NetworkV4::Parse("10.0.0.0/33"));
+    static_assert(!NetworkV4::Parse("10.0.0/8"));
+
+    for (const auto* input: { "0.0.0.0/0", "10.0.0.0/8", "192.168.1.0/24", "1.2.3.4", "1.2.3.4/", "1.2.3.4/40" }) {
+        EXPECT_EQ(NetworkV4::Parse(input).HasValue(), NetworkV4::FromStr(input).Ok()) << input;
+    }
+}
+
+TEST(NetworkV4, ContainsAddress)
+{
+    auto network = cidr("172.16.0.0/12");
+    EXPECT_TRUE(network.Contains(AddrV4(172, 16, 0, 0)));
+    EXPECT_TRUE(network.Contains(AddrV4(172, 31, 255, 255)));
+    EXPECT_FALSE(network.Contains(AddrV4(172, 32, 0, 0)));
+    EXPECT_FALSE(network.Contains(AddrV4(172, 15, 255, 255)));
+
+    // every address is in `/0`, only the address itself in `/32`
+    EXPECT_TRUE(cidr("0.0.0.0/0").Contains(AddrV4(8, 8, 8, 8)));
+    EXPECT_TRUE(cidr("8.8.8.8/32").Contains(AddrV4(8, 8, 8, 8)));
+    EXPECT_FALSE(cidr("8.8.8.8/32").Contains(AddrV4(8, 8, 8, 9)));
+}
+
+TEST(NetworkV4, ContainsAndOverlapsNetworks)
+{
+    auto outer = cidr("10.0.0.0/8");
+    auto inner = cidr("10.20.0.0/16");
+    auto other = cidr("11.0.0.0/8");
+
+    EXPECT_TRUE(outer.Contains(inner));
+    EXPECT_TRUE(outer.Contains(outer));
+    EXPECT_FALSE(inner.Contains(outer));
+    EXPECT_FALSE(outer.Contains(other));
+
+    EXPECT_TRUE(outer.Overlaps(inner));
+    EXPECT_TRUE(inner.Overlaps(outer));
+    EXPECT_FALSE(outer.Overlaps(other));
+    EXPECT_FALSE(inner.Overlaps(cidr("10.21.0.0/16")));
+    EXPECT_TRUE(cidr("0.0.0.0/0").Overlaps(other));
+}
+
+TEST(NetworkV4, Supernet)
+{
+    EXPECT_EQ(cidr("10.1.0.0/16").Supernet(), cidr("10.0.0.0/15"));
+    EXPECT_EQ(cidr("10.1.0.0/16").Supernet(8), cidr("10.0.0.0/8"));
+    EXPECT_EQ(cidr("0.0.0.0/0").Supernet(), cidr("0.0.0.0/0"));
+    EXPECT_EQ(cidr("10.1.2.3/32").Supernet(0), cidr("0.0.0.0/0"));
+}
+
+TEST(NetworkV4, Subnets)
+{
+    auto subnets = cidr("10.0.0.0/8").Subnets(10);
+    ASSERT_EQ(subnets.size(), 4);
+
+    Vec<String> names;
+    for (auto subnet: subnets) {
+        names.push_back(subnet.ToString());
+    }
+
+    EXPECT_EQ(names, (Vec<String>{ "10.0.0.0/10", "10.64.0.0/10", "10.128.0.0/10", "10.192.0.0/10" }));
+    EXPECT_EQ(subnets.end() - subnets.begin(), 4);
+    EXPECT_EQ(subnets.begin()[3], cidr("10.192.0.0/10"));
+
+    EXPECT_EQ(cidr("10.0.0.0/8").Subnets(8).size(), 1);
+    EXPECT_EQ(cidr("0.0.0.0/0").Subnets(0)[0], cidr("0.0.0.0/0"));
+    EXPECT_EQ(cidr("0.0.0.0/0").Subnets(32).size(), UInt64(1) << 32);
+    EXPECT_EQ(cidr("0.0.0.0/0").Subnets(32)[0xFFFFFFFF], cidr("255.255.255.255/32"));
+    EXPECT_EQ(cidr("192.168.1.0/24").Subnets(32)[7], cidr("192.168.1.7/32"));
+}
+
+TEST(NetworkV4, Ordering)
+{
+    EXPECT_LT(cidr("10.0.0.0/8"), cidr("10.0.0.0/16"));
+    EXPECT_LT(cidr("10.0.0.0/16"), cidr("10.1.0.0/16"));
+    EXPECT_LT(cidr("9.0.0.0/8"), cidr("10.0.0.0/8"));
+}
+
+TEST(NetworkV4, ToChars)
+{
+    Array<char, NetworkV4::kMaxStringLength> buf;
+    auto [end, ec] = cidr("255.255.255.255/32").ToChars(buf.data(), buf.data() + buf.size());
+    ASSERT_EQ(ec, std::errc{ });
+    EXPECT_EQ(Str(buf.data(), end), "255.255.255.255/32");
+
+    Array<char, 4> small;
+    EXPECT_EQ(cidr("10.0.0.0/8").ToChars(small.data(), small.data() + small.size()).ec, std::errc::value_too_large);
+}
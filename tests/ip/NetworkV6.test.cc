@@ -0,0 +1,192 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/NetworkV6.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto cidr(Str input) -> NetworkV6
+{
+    auto result = NetworkV6::FromStr(input);
+    EXPECT_TRUE(result) << "failed to parse `" << input << "': " << result.Error();
+
+    return result.Value();
+}
+
+auto addr(Str input) -> AddrV6
+{
+    return AddrV6::FromStr(input).Value();
+}
+
+} // namespace
+
+TEST(NetworkV6, Defaults)
+{
+    NetworkV6 all;
+    EXPECT_EQ(all.Address(), AddrV6());
+    EXPECT_EQ(all.PrefixLength(), 0);
+    EXPECT_TRUE(all.Contains(addr("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff")));
+    EXPECT_EQ(all.ToString(), "::/0");
+}
+
+TEST(NetworkV6, ClearsHostBits)
+{
+    NetworkV6 network(addr("2001:db8:1234:5678::1"), 32);
+    EXPECT_EQ(network.Address(), addr("2001:db8::"));
+    EXPECT_EQ(network, cidr("2001:db8:ffff::/32"));
+    EXPECT_EQ(network.ToString(), "2001:db8::/32");
+
+    // prefixes that don't fall on a word boundary
+    EXPECT_EQ(cidr("2001:db8:ffff:ffff:ffff::/70").Address(), addr("2001:db8:ffff:ffff:fc00::"));
+}
+
+TEST(NetworkV6, Masks)
+{
+    auto network = cidr("fe80::/10");
+    EXPECT_EQ(network.Netmask(), addr("ffc0::"));
+    EXPECT_EQ(network.Hostmask(), addr("3f:ffff:ffff:ffff:ffff:ffff:ffff:ffff"));
+    EXPECT_EQ(network.Last(), addr("febf:ffff:ffff:ffff:ffff:ffff:ffff:ffff"));
+
+    EXPECT_EQ(cidr("::/0").Netmask(), AddrV6());
+    EXPECT_EQ(cidr("::1/128").Last(), AddrV6::Localhost());
+    EXPECT_EQ(cidr("2001:db8::/64").Netmask(), addr("ffff:ffff:ffff:ffff::"));
+}
+
+TEST(NetworkV6, FromStr)
+{
+    EXPECT_EQ(cidr("::1"), NetworkV6(AddrV6::Localhost(), 128));
+
+    auto error = NetworkV6::FromStr("2001:db8::/129").Error();
+    EXPECT_EQ(error.Kind(), NetworkV6::ParseStatus::kPrefixOutOfRange);
+    EXPECT_EQ(error.Offset(), 11);
+    EXPECT_EQ(error.ToString(), "invalid IPv6 network: prefix length is larger than 128");
+
+    EXPECT_EQ(NetworkV6::FromStr("2001:db8::/").Error().Kind(), NetworkV6::ParseStatus::kInvalidPrefix);
+    EXPECT_EQ(NetworkV6::FromStr("2001:db8::/3a").Error().Kind(), NetworkV6::ParseStatus::kInvalidPrefix);
+
+    auto address = NetworkV6::FromStr("2001:db8::1::2/64").Error();
+    EXPECT_EQ(address.Kind(), NetworkV6::ParseStatus::kInvalidAddress);
+    ASSERT_TRUE(address.Address());
+    EXPECT_EQ(address.Address()->Offset(), address.Offset());
+}
+
+TEST(NetworkV6, ConstexprParse)
+{
+    static_assert(NetworkV6::Parse("fe80::/10").Unwrap().PrefixLength() == 10);
+    static_assert(NetworkV6::Parse("::1").Unwrap().PrefixLength() == 128);
+    static_assert(!NetworkV6::Parse("::/129"));
+    static_assert(!NetworkV6::Parse(":::/8"));
+
+    for (const auto* input: { "::/0", "fe80::/10", "2001:db8::/32", "::1", "::1/", "::/200", "1.2.3.4/8" }) {
+        EXPECT_EQ(NetworkV6::Parse(input).HasValue(), NetworkV6::FromStr(input).Ok()) << input;
+    }
+}
+
+TEST(NetworkV6, ContainsAddress)
+{
+    auto network = cidr("2001:db8::/32");
+    EXPECT_TRUE(network.Contains(addr("2001:db8::")));
+    EXPECT_TRUE(network.Contains(addr("2001:db8:ffff:ffff:ffff:ffff:ffff:ffff")));
+    EXPECT_FALSE(network.Contains(addr("2001:db9::")));
+    EXPECT_FALSE(network.Contains(addr("2001:db7:ffff::")));
+
+    EXPECT_TRUE(cidr("::/0").Contains(AddrV6::Localhost()));
+    EXPECT_TRUE(cidr("::1/128").Contains(AddrV6::Localhost()));
+    EXPECT_FALSE(cidr("::1/128").Contains(AddrV6()));
+
+    // a prefix straddling the two 64-bit halves
+    auto odd = cidr("2001:db8:0:0:8000::/65");
+    EXPECT_TRUE(odd.Contains(addr("2001:db8:0:0:ffff::1")));
+    EXPECT_FALSE(odd.Contains(addr("2001:db8:0:0:7fff::1")));
+}
+
+TEST(NetworkV6, ContainsAndOverlapsNetworks)
+{
+    auto outer = cidr("2001:db8::/32");
+    auto inner = cidr("2001:db8:abcd::/48");
+    auto other = cidr("2001:db9::/32");
+
+    EXPECT_TRUE(outer.Contains(inner));
+    EXPECT_TRUE(outer.Contains(outer));
+    EXPECT_FALSE(inner.Contains(outer));
+    EXPECT_FALSE(outer.Contains(other));
+
+    EXPECT_TRUE(outer.Overlaps(inner));
+    EXPECT_TRUE(inner.Overlaps(outer));
+    EXPECT_FALSE(outer.Overlaps(other));
+    EXPECT_TRUE(cidr("::/0").Overlaps(other));
+}
+
+TEST(NetworkV6, Supernet)
+{
+    EXPECT_EQ(cidr("2001:db8::/32").Supernet(), cidr("2001:db8::/31"));
+    EXPECT_EQ(cidr("2001:db9::/32").Supernet(), cidr("2001:db8::/31"));
+    EXPECT_EQ(cidr("2001:db8:abcd::/48").Supernet(16), cidr("2001::/16"));
+    EXPECT_EQ(cidr("::/0").Supernet(), cidr("::/0"));
+}
+
+TEST(NetworkV6, Subnets)
+{
+    auto subnets = cidr("2001:db8::/32").Subnets(34);
+    ASSERT_EQ(subnets.size(), 4);
+
+    Vec<String> names;
+    for (auto subnet: subnets) {
+        names.push_back(subnet.ToString());
+    }
+
+    EXPECT_EQ(names,
+        (Vec<String>{ "2001:db8::/34", "2001:db8:4000::/34", "2001:db8:8000::/34", "2001:db8:c000::/34" }));
+
+    // subnets whose index bits straddle the two 64-bit halves
+    auto split = cidr("2001:db8::/60").Subnets(68);
+    EXPECT_EQ(split.size(), 256);
+    EXPECT_EQ(split[0x1F], cidr("2001:db8:0:1:f000::/68"));
+    EXPECT_EQ(split[0xFF], cidr("2001:db8:0:f:f000::/68"));
+
+    EXPECT_EQ(cidr("2001:db8::/72").Subnets(128)[5], cidr("2001:db8::5/128"));
+    EXPECT_EQ(cidr("::/0").Subnets(1)[1], cidr("8000::/1"));
+}
+
+TEST(NetworkV6, Ordering)
+{
+    EXPECT_LT(cidr("2001:db8::/32"), cidr("2001:db8::/48"));
+    EXPECT_LT(cidr("2001:db8::/48"), cidr("2001:db8:1::/48"));
+}
+
+TEST(NetworkV6, ToChars)
+{
+    Array<char, NetworkV6::kMaxStringLength> buf;
+    auto network = cidr("ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255/128");
+    auto [end, ec] = network.ToChars(buf.data(), buf.data() + buf.size());
+    ASSERT_EQ(ec, std::errc{ });
+    EXPECT_EQ(Str(buf.data(), end), network.ToString());
+
+    Array<char, 4> small;
+    EXPECT_EQ(cidr("::/0").ToChars(small.data(), small.data() + small.size()).ec, std::errc{ });
+    EXPECT_EQ(cidr("fe80::/10").ToChars(small.data(), small.data() + small.size()).ec, std::errc::value_too_large);
+}
@@ -0,0 +1,244 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/PrefixMapV4.h>
+
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto cidr(Str input) -> NetworkV4
+{
+    return NetworkV4::FromStr(input).Value();
+}
+
+auto lookup(const PrefixMapV4<int>& map, AddrV4 address) -> int
+{
+    auto value = map.Lookup(address);
+    return value ? value.Unwrap() : -1;
+}
+
+// the longest matching prefix by brute force
+auto reference(const Vec<std::pair<NetworkV4, int>>& networks, AddrV4 address) -> int
+{
+    int value = -1;
+    int longest = -1;
+    for (const auto& [network, v]: networks) {
+        if (network.Contains(address) && network.PrefixLength() > longest) {
+            longest = network.PrefixLength();
+            value = v;
+        }
+    }
+
+    return value;
+}
+
+} // namespace
+
+TEST(PrefixMapV4, Empty)
+{
+    PrefixMapV4<int> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_FALSE(map.Lookup(AddrV4(10, 0, 0, 1)));
+    EXPECT_FALSE(map.Get(cidr("10.0.0.0/8")));
+    EXPECT_FALSE(map.Remove(cidr("10.0.0.0/8")));
+}
+
+TEST(PrefixMapV4, LongestPrefixWins)
+{
+    PrefixMapV4<int> map;
+    EXPECT_TRUE(map.Insert(cidr("10.0.0.0/8"), 8));
+    EXPECT_TRUE(map.Insert(cidr("10.1.0.0/16"), 16));
+    EXPECT_TRUE(map.Insert(cidr("10.1.2.0/24"), 24));
+    EXPECT_TRUE(map.Insert(cidr("10.1.2.128/25"), 25));
+    EXPECT_TRUE(map.Insert(cidr("10.1.2.200/32"), 32));
+    EXPECT_EQ(map.Size(), 5);
+
+    EXPECT_EQ(lookup(map, AddrV4(10, 200, 0, 1)), 8);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 200, 1)), 16);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 1)), 24);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 129)), 25);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 200)), 32);
+    EXPECT_EQ(lookup(map, AddrV4(11, 0, 0, 0)), -1);
+}
+
+TEST(PrefixMapV4, InsertionOrderDoesNotMatter)
+{
+    // a shorter prefix inserted afterwards mustn't shadow the longer ones
+    PrefixMapV4<int> map;
+    map.Insert(cidr("10.1.2.128/25"), 25);
+    map.Insert(cidr("10.1.0.0/16"), 16);
+    map.Insert(cidr("0.0.0.0/0"), 0);
+
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 129)), 25);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 1)), 16);
+    EXPECT_EQ(lookup(map, AddrV4(192, 168, 0, 1)), 0);
+}
+
+TEST(PrefixMapV4, ReplaceAndGet)
+{
+    PrefixMapV4<int> map;
+    EXPECT_TRUE(map.Insert(cidr("192.168.0.0/16"), 1));
+    EXPECT_FALSE(map.Insert(cidr("192.168.0.0/16"), 2));
+    EXPECT_EQ(map.Size(), 1);
+
+    EXPECT_EQ(map.Get(cidr("192.168.0.0/16")).Unwrap(), 2);
+    EXPECT_FALSE(map.Get(cidr("192.168.0.0/24")));
+    EXPECT_EQ(lookup(map, AddrV4(192, 168, 1, 1)), 2);
+}
+
+TEST(PrefixMapV4, RemoveRestoresCoveringPrefix)
+{
+    PrefixMapV4<int> map;
+    map.Insert(cidr("10.0.0.0/8"), 8);
+    map.Insert(cidr("10.1.0.0/16"), 16);
+    map.Insert(cidr("10.1.2.0/26"), 26);
+
+    EXPECT_EQ(map.Remove(cidr("10.1.0.0/16")), Some<int>(16));
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 3, 1)), 8);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 1)), 26);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 100)), 8);
+
+    EXPECT_EQ(map.Remove(cidr("10.1.2.0/26")), Some<int>(26));
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 1)), 8);
+
+    EXPECT_EQ(map.Remove(cidr("10.0.0.0/8")), Some<int>(8));
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 1)), -1);
+    EXPECT_TRUE(map.Empty());
+}
+
+TEST(PrefixMapV4, RemovedValueStaysUntilIdIsReused)
+{
+    PrefixMapV4<String> map;
+    map.Insert(cidr("10.0.0.0/8"), String(32, 'a'));
+
+    EXPECT_EQ(map.Remove(cidr("10.0.0.0/8")), Some<String>(32, 'a'));
+    EXPECT_EQ(map.Values()[0], String(32, 'a'));
+
+    map.Insert(cidr("192.168.0.0/16"), "b");
+    EXPECT_EQ(map.Values()[0], "b");
+}
+
+TEST(PrefixMapV4, ReusesGroupsAndIds)
+{
+    PrefixMapV4<int> map;
+    map.Insert(cidr("10.0.0.0/25"), 1);
+    const UInt usage = map.MemoryUsage();
+
+    for (int i = 0; i < 100; i++) {
+        map.Remove(cidr("10.0.0.0/25"));
+        map.Insert(cidr("10.0.0.0/25"), i);
+    }
+
+    EXPECT_EQ(map.MemoryUsage(), usage);
+    EXPECT_EQ(lookup(map, AddrV4(10, 0, 0, 1)), 99);
+}
+
+TEST(PrefixMapV4, ApplyDelta)
+{
+    PrefixMapV4<int> map;
+    map.Insert(cidr("10.0.0.0/8"), 8);
+    map.Insert(cidr("192.168.0.0/16"), 16);
+
+    PrefixMapV4<int>::Delta delta;
+    delta.Insert(cidr("10.1.2.0/24"), 24).Remove(cidr("192.168.0.0/16")).Insert(cidr("10.0.0.0/8"), 80);
+    delta.Insert(cidr("172.16.0.0/12"), 12).Remove(cidr("172.16.0.0/12")).Remove(cidr("203.0.113.0/24"));
+    EXPECT_EQ(delta.Size(), 6u);
+
+    // the changes are applied in order, and removing what isn't there does nothing
+    map.Apply(delta);
+    EXPECT_EQ(map.Size(), 2u);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 3)), 24);
+    EXPECT_EQ(lookup(map, AddrV4(10, 9, 9, 9)), 80);
+    EXPECT_EQ(lookup(map, AddrV4(192, 168, 1, 1)), -1);
+    EXPECT_EQ(lookup(map, AddrV4(172, 16, 0, 1)), -1);
+
+    // applying it again gives the same map
+    map.Apply(delta);
+    EXPECT_EQ(map.Size(), 2u);
+    EXPECT_EQ(lookup(map, AddrV4(10, 1, 2, 3)), 24);
+}
+
+TEST(PrefixMapV4, LookupMany)
+{
+    PrefixMapV4<int> map;
+    map.Insert(cidr("10.0.0.0/8"), 8);
+    map.Insert(cidr("10.1.2.0/30"), 30);
+
+    Vec<AddrV4> addresses;
+    for (UInt32 i = 0; i < 200; i++) {
+        addresses.push_back(AddrV4::FromUInt32((i % 3 == 0 ? 0x0B000000 : 0x0A010200) + i));
+    }
+
+    Vec<const int*> values(addresses.size());
+    const UInt matched = map.LookupMany(addresses, values);
+
+    UInt expected = 0;
+    for (UInt i = 0; i < addresses.size(); i++) {
+        const int want = lookup(map, addresses[i]);
+        EXPECT_EQ(values[i] ? *values[i] : -1, want) << addresses[i];
+        expected += static_cast<UInt>(want != -1);
+    }
+
+    EXPECT_EQ(matched, expected);
+}
+
+TEST(PrefixMapV4, MatchesBruteForce)
+{
+    std::mt19937 rng(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    // prefixes are clustered in a few `/16`s so that they nest and share `tbl8` groups
+    auto randomAddress = [&rng]() -> AddrV4 {
+        return AddrV4::FromUInt32(0x0A000000 | ((rng() % 4) << 16) | (rng() & 0xFFFF));
+    };
+
+    PrefixMapV4<int> map;
+    Vec<std::pair<NetworkV4, int>> networks;
+    for (int i = 0; i < 300; i++) {
+        NetworkV4 network(randomAddress(), static_cast<UInt8>(8 + (rng() % 25)));
+        if (map.Insert(network, i)) {
+            networks.emplace_back(network, i);
+        } else {
+            auto same = [&](const auto& n) { return n.first == network; };
+            std::find_if(networks.begin(), networks.end(), same)->second = i;
+        }
+    }
+
+    // remove every third network again
+    for (UInt i = 0; i < networks.size(); i += 3) {
+        EXPECT_TRUE(map.Remove(networks[i].first));
+        networks[i].second = -2;
+    }
+
+    std::erase_if(networks, [](const auto& n) { return n.second == -2; });
+    ASSERT_EQ(map.Size(), networks.size());
+
+    for (int i = 0; i < 5000; i++) {
+        const AddrV4 address = randomAddress();
+        ASSERT_EQ(lookup(map, address), reference(networks, address)) << address;
+    }
+}
@@ -0,0 +1,223 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/PrefixMapV6.h>
+
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto cidr(Str input) -> NetworkV6
+{
+    return NetworkV6::FromStr(input).Value();
+}
+
+auto addr(Str input) -> AddrV6
+{
+    return AddrV6::FromStr(input).Value();
+}
+
+auto lookup(const PrefixMapV6<int>& map, const AddrV6& address) -> int
+{
+    auto value = map.Lookup(address);
+    return value ? value.Unwrap() : -1;
+}
+
+// the longest matching prefix by brute force
+auto reference(const Vec<std::pair<NetworkV6, int>>& networks, const AddrV6& address) -> int
+{
+    int value = -1;
+    int longest = -1;
+    for (const auto& [network, v]: networks) {
+        if (network.Contains(address) && network.PrefixLength() > longest) {
+            longest = network.PrefixLength();
+            value = v;
+        }
+    }
+
+    return value;
+}
+
+} // namespace
+
+TEST(PrefixMapV6, Empty)
+{
+    PrefixMapV6<int> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_FALSE(map.Lookup(AddrV6::Localhost()));
+    EXPECT_FALSE(map.Get(cidr("::/0")));
+    EXPECT_FALSE(map.Remove(cidr("2001:db8::/32")));
+}
+
+TEST(PrefixMapV6, LongestPrefixWins)
+{
+    PrefixMapV6<int> map;
+    EXPECT_TRUE(map.Insert(cidr("2001:db8::/32"), 32));
+    EXPECT_TRUE(map.Insert(cidr("2001:db8:1::/48"), 48));
+    EXPECT_TRUE(map.Insert(cidr("2001:db8:1::/53"), 53));
+    EXPECT_TRUE(map.Insert(cidr("2001:db8:1::1/128"), 128));
+    EXPECT_TRUE(map.Insert(cidr("2000::/3"), 3));
+    EXPECT_EQ(map.Size(), 5);
+
+    EXPECT_EQ(lookup(map, addr("2001:db8:2::1")), 32);
+    EXPECT_EQ(lookup(map, addr("2001:db8:1:ff00::1")), 48);
+    EXPECT_EQ(lookup(map, addr("2001:db8:1:700::1")), 53);
+    EXPECT_EQ(lookup(map, addr("2001:db8:1::1")), 128);
+    EXPECT_EQ(lookup(map, addr("2001:db8:1::2")), 53);
+    EXPECT_EQ(lookup(map, addr("3fff::1")), 3);
+    EXPECT_EQ(lookup(map, addr("fe80::1")), -1);
+}
+
+TEST(PrefixMapV6, DefaultRoute)
+{
+    PrefixMapV6<int> map;
+    EXPECT_TRUE(map.Insert(cidr("::/0"), 0));
+    EXPECT_TRUE(map.Insert(cidr("fe80::/10"), 10));
+
+    EXPECT_EQ(lookup(map, AddrV6::Localhost()), 0);
+    EXPECT_EQ(lookup(map, addr("fe80::1")), 10);
+    EXPECT_EQ(map.Size(), 2);
+
+    EXPECT_EQ(map.Remove(cidr("::/0")), Some<int>(0));
+    EXPECT_EQ(lookup(map, AddrV6::Localhost()), -1);
+    EXPECT_EQ(map.Size(), 1);
+}
+
+TEST(PrefixMapV6, ReplaceAndGet)
+{
+    PrefixMapV6<int> map;
+    EXPECT_TRUE(map.Insert(cidr("2001:db8::/32"), 1));
+    EXPECT_FALSE(map.Insert(cidr("2001:db8::/32"), 2));
+    EXPECT_EQ(map.Size(), 1);
+
+    EXPECT_EQ(map.Get(cidr("2001:db8::/32")).Unwrap(), 2);
+    EXPECT_FALSE(map.Get(cidr("2001:db8::/33")));
+    EXPECT_FALSE(map.Get(cidr("2001:db8::/64")));
+    EXPECT_EQ(lookup(map, addr("2001:db8::1")), 2);
+}
+
+TEST(PrefixMapV6, ApplyDelta)
+{
+    PrefixMapV6<int> map;
+    map.Insert(cidr("2001:db8::/32"), 32);
+    map.Insert(cidr("fe80::/10"), 10);
+
+    PrefixMapV6<int>::Delta delta;
+    delta.Insert(cidr("2001:db8:1::/48"), 48).Remove(cidr("fe80::/10")).Insert(cidr("2001:db8::/32"), 320);
+    map.Apply(delta);
+
+    EXPECT_EQ(map.Size(), 2u);
+    EXPECT_EQ(lookup(map, addr("2001:db8:1::1")), 48);
+    EXPECT_EQ(lookup(map, addr("2001:db8:2::1")), 320);
+    EXPECT_EQ(lookup(map, addr("fe80::1")), -1);
+}
+
+TEST(PrefixMapV6, RemovePrunesNodes)
+{
+    PrefixMapV6<int> map;
+    map.Insert(cidr("2001:db8::/32"), 32);
+    const UInt usage = map.MemoryUsage();
+
+    // deep prefixes allocate a node per byte; removing them gives the nodes back for reuse
+    for (int i = 0; i < 100; i++) {
+        map.Insert(cidr("2001:db8:1:2:3:4:5:6/128"), i);
+        EXPECT_EQ(lookup(map, addr("2001:db8:1:2:3:4:5:6")), i);
+        EXPECT_EQ(map.Remove(cidr("2001:db8:1:2:3:4:5:6/128")), Some<int>(i));
+    }
+
+    EXPECT_EQ(lookup(map, addr("2001:db8:1:2:3:4:5:6")), 32);
+    EXPECT_EQ(map.Size(), 1);
+    EXPECT_LE(map.MemoryUsage(), usage + (16 * 1024));
+}
+
+TEST(PrefixMapV6, LookupMany)
+{
+    PrefixMapV6<int> map;
+    map.Insert(cidr("2001:db8::/32"), 32);
+    map.Insert(cidr("2001:db8::/126"), 126);
+
+    Vec<AddrV6> addresses;
+    for (UInt64 i = 0; i < 200; i++) {
+        addresses.push_back(AddrV6::FromWords(i % 3 == 0 ? 0x20010db900000000 : 0x20010db800000000, i));
+    }
+
+    Vec<const int*> values(addresses.size());
+    const UInt matched = map.LookupMany(addresses, values);
+
+    UInt expected = 0;
+    for (UInt i = 0; i < addresses.size(); i++) {
+        const int want = lookup(map, addresses[i]);
+        EXPECT_EQ(values[i] ? *values[i] : -1, want) << addresses[i];
+        expected += static_cast<UInt>(want != -1);
+    }
+
+    EXPECT_EQ(matched, expected);
+}
+
+TEST(PrefixMapV6, MatchesBruteForce)
+{
+    std::mt19937_64 rng(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    // addresses share a `/28` and a few possible values per byte, so that prefixes nest and nodes fill up
+    auto randomAddress = [&rng]() -> AddrV6 {
+        UInt64 high = 0x20010db000000000;
+        for (UInt shift = 0; shift < 36; shift += 4) {
+            high |= (rng() % 3) << shift;
+        }
+
+        return AddrV6::FromWords(high, rng() % 4);
+    };
+
+    PrefixMapV6<int> map;
+    Vec<std::pair<NetworkV6, int>> networks;
+    for (int i = 0; i < 500; i++) {
+        NetworkV6 network(randomAddress(), static_cast<UInt8>(rng() % 129));
+        if (map.Insert(network, i)) {
+            networks.emplace_back(network, i);
+        } else {
+            auto same = [&](const auto& n) { return n.first == network; };
+            std::find_if(networks.begin(), networks.end(), same)->second = i;
+        }
+    }
+
+    for (UInt i = 0; i < networks.size(); i += 3) {
+        EXPECT_TRUE(map.Remove(networks[i].first));
+        networks[i].second = -2;
+    }
+
+    std::erase_if(networks, [](const auto& n) { return n.second == -2; });
+    ASSERT_EQ(map.Size(), networks.size());
+
+    for (const auto& [network, value]: networks) {
+        ASSERT_EQ(map.Get(network).Unwrap(), value) << network;
+    }
+
+    for (int i = 0; i < 5000; i++) {
+        const AddrV6 address = randomAddress();
+        ASSERT_EQ(lookup(map, address), reference(networks, address)) << address;
+    }
+}
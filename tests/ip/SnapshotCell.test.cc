@@ -0,0 +1,318 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/IPSetV4.h>
+#include <violet/Networking/IP/PrefixMapV4.h>
+#include <violet/Networking/IP/SnapshotCell.h>
+
+#include <thread>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto cidr(Str input) -> NetworkV4
+{
+    return NetworkV4::FromStr(input).Value();
+}
+
+// a snapshot whose destruction can be observed through `Alive`
+struct Tracked final {
+    int Value = 0;
+    std::shared_ptr<int> Alive = std::make_shared<int>(0);
+};
+
+// a snapshot that counts how often it was copied
+struct Counted final {
+    static inline int Copies = 0;
+
+    int Value = 0;
+
+    Counted() = default;
+    Counted(const Counted& other)
+        : Value(other.Value)
+    {
+        Copies++;
+    }
+
+    Counted(Counted&&) = default;
+};
+
+} // namespace
+
+TEST(SnapshotCell, PublishReplacesTheSnapshot)
+{
+    SnapshotCell<PrefixMapV4<int>> cell;
+    auto reader = cell.Register();
+
+    EXPECT_TRUE(reader.Read()->Empty());
+
+    PrefixMapV4<int> next;
+    next.Insert(cidr("10.0.0.0/8"), 1);
+    cell.Publish(std::move(next));
+
+    auto snapshot = reader.Read();
+    ASSERT_TRUE(snapshot->Lookup(AddrV4(10, 1, 2, 3)));
+    EXPECT_EQ(snapshot->Lookup(AddrV4(10, 1, 2, 3)).Unwrap(), 1);
+}
+
+TEST(SnapshotCell, UpdateModifiesACopy)
+{
+    SnapshotCell<PrefixMapV4<int>> cell;
+    auto reader = cell.Register();
+
+    cell.Update([](PrefixMapV4<int>& map) { map.Insert(cidr("10.0.0.0/8"), 1); });
+    auto before = reader.Read();
+
+    cell.Update([](PrefixMapV4<int>& map) { map.Insert(cidr("10.1.0.0/16"), 2); });
+    auto after = reader.Read();
+
+    EXPECT_EQ(before->Size(), 1u);
+    EXPECT_EQ(after->Size(), 2u);
+    EXPECT_EQ(after->Lookup(AddrV4(10, 1, 0, 1)).Unwrap(), 2);
+}
+
+TEST(SnapshotCell, GuardsDeferReclamation)
+{
+    SnapshotCell<Tracked> cell(Tracked{ 1 });
+    auto reader = cell.Register();
+
+    std::weak_ptr<int> first;
+    {
+        auto snapshot = reader.Read();
+        first = snapshot->Alive;
+
+        cell.Publish(Tracked{ 2 });
+        EXPECT_EQ(snapshot->Value, 1);
+        EXPECT_FALSE(first.expired());
+        EXPECT_EQ(cell.Retired(), 1u);
+
+        // a guard taken after the publication doesn't hold the old snapshot
+        EXPECT_EQ(reader.Read()->Value, 2);
+        EXPECT_EQ(cell.Reclaim(), 1u);
+    }
+
+    EXPECT_EQ(cell.Reclaim(), 0u);
+    EXPECT_TRUE(first.expired());
+}
+
+TEST(SnapshotCell, NestedGuardsKeepTheOutermostEpoch)
+{
+    SnapshotCell<Tracked> cell(Tracked{ 1 });
+    auto reader = cell.Register();
+
+    auto outer = reader.Read();
+    std::weak_ptr<int> second;
+    {
+        cell.Publish(Tracked{ 2 });
+        auto inner = reader.Read();
+        second = inner->Alive;
+        EXPECT_EQ(inner->Value, 2);
+    }
+
+    // the outer guard still pins the first snapshot, and with it everything retired after it
+    cell.Publish(Tracked{ 3 });
+    EXPECT_EQ(cell.Reclaim(), 2u);
+    EXPECT_FALSE(second.expired());
+    EXPECT_EQ(outer->Value, 1);
+}
+
+TEST(SnapshotCell, ReadersThatAreQuiescentDontBlockReclamation)
+{
+    SnapshotCell<Tracked> cell;
+    auto idle = cell.Register();
+    auto reader = cell.Register();
+
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(reader.Read()->Value, i);
+        cell.Publish(Tracked{ i + 1 });
+    }
+
+    EXPECT_EQ(cell.Retired(), 0u);
+
+    // slots are reused once their reader is gone
+    idle = cell.Register();
+    cell.Synchronize();
+    EXPECT_EQ(cell.Retired(), 0u);
+}
+
+TEST(SnapshotCell, ConcurrentReadersSeeWholeSnapshots)
+{
+    constexpr UInt kReaders = 4;
+    constexpr UInt64 kVersions = 2000;
+
+    // every range of a snapshot is the same /24, so a torn or freed snapshot shows up as a mix
+    const auto makeSnapshot = [](UInt64 version) -> IPSetV4 {
+        IPSetV4::Builder builder;
+        for (UInt32 i = 0; i < 16; i++) {
+            builder.Add(NetworkV4(AddrV4::FromUInt32((i << 24) | (static_cast<UInt32>(version) << 8)), 24));
+        }
+
+        return builder.Build();
+    };
+
+    SnapshotCell<IPSetV4> cell(makeSnapshot(0));
+    std::atomic<bool> done = false;
+    std::atomic<UInt> failures = 0;
+
+    Vec<std::thread> readers;
+    for (UInt r = 0; r < kReaders; r++) {
+        readers.emplace_back([&]() {
+            auto reader = cell.Register();
+
+            UInt32 last = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                auto snapshot = reader.Read();
+
+                const UInt32 version = ((*snapshot->begin()).First.AsUInt32() >> 8) & 0xFFFF;
+                for (const auto& range: *snapshot) {
+                    if (((range.First.AsUInt32() >> 8) & 0xFFFF) != version) {
+                        failures++;
+                    }
+                }
+
+                // a reader never goes back to an older snapshot
+                if (version < last) {
+                    failures++;
+                }
+
+                last = version;
+            }
+        });
+    }
+
+    for (UInt64 version = 1; version <= kVersions; version++) {
+        cell.Publish(makeSnapshot(version));
+    }
+
+    done = true;
+    for (auto& thread: readers) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0u);
+    cell.Synchronize();
+    EXPECT_EQ(cell.Retired(), 0u);
+}
+
+TEST(SnapshotCell, ModifyReusesTheReplacedSnapshot)
+{
+    SnapshotCell<Counted> cell;
+    auto reader = cell.Register();
+    Counted::Copies = 0;
+
+    for (int i = 1; i <= 10; i++) {
+        cell.Modify([](Counted& snapshot) { snapshot.Value++; });
+        EXPECT_EQ(reader.Read()->Value, i);
+    }
+
+    // only the first `Modify` copies, and nothing is left to reclaim
+    EXPECT_EQ(Counted::Copies, 1);
+    EXPECT_EQ(cell.Retired(), 0u);
+
+    // a published snapshot replaces the spare too
+    cell.Publish(Counted());
+    cell.Modify([](Counted& snapshot) { snapshot.Value += 5; });
+    cell.Modify([](Counted& snapshot) { snapshot.Value += 5; });
+    EXPECT_EQ(reader.Read()->Value, 10);
+    EXPECT_EQ(Counted::Copies, 2);
+}
+
+TEST(SnapshotCell, ModifyWaitsForReadersOfTheSpare)
+{
+    SnapshotCell<Counted> cell;
+    auto reader = cell.Register();
+    const auto increment = [](Counted& snapshot) { snapshot.Value++; };
+
+    auto old = reader.Read();
+    cell.Modify(increment); // the snapshot `old` sees is now the spare
+
+    std::atomic<bool> modified = false;
+    std::thread writer([&]() {
+        cell.Modify(increment);
+        modified = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(modified.load());
+    EXPECT_EQ(old->Value, 0);
+
+    { [[maybe_unused]] auto dropped = std::move(old); }
+    writer.join();
+
+    EXPECT_TRUE(modified.load());
+    EXPECT_EQ(reader.Read()->Value, 2);
+}
+
+TEST(SnapshotCell, ConcurrentReadersSeeWholeDeltas)
+{
+    constexpr UInt kReaders = 4;
+    constexpr int kDeltas = 200;
+
+    SnapshotCell<PrefixMapV4<int>> cell;
+    std::atomic<bool> done = false;
+    std::atomic<UInt> failures = 0;
+
+    Vec<std::thread> readers;
+    for (UInt r = 0; r < kReaders; r++) {
+        readers.emplace_back([&]() {
+            auto reader = cell.Register();
+
+            int last = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                auto snapshot = reader.Read();
+
+                auto first = snapshot->Lookup(AddrV4(10, 0, 0, 1));
+                auto second = snapshot->Lookup(AddrV4(192, 168, 0, 1));
+                const int version = first ? first.Unwrap() : 0;
+
+                // both networks change in every delta, so a partly applied one shows up as a mismatch
+                if (version != (second ? second.Unwrap() : 0) || version < last) {
+                    failures++;
+                }
+
+                last = version;
+            }
+        });
+    }
+
+    for (int version = 1; version <= kDeltas; version++) {
+        PrefixMapV4<int>::Delta delta;
+        delta.Insert(cidr("10.0.0.0/8"), version).Insert(cidr("192.168.0.0/16"), version);
+        delta.Remove(cidr("172.16.0.0/12")).Insert(cidr("172.16.0.0/12"), version);
+        cell.Modify([delta](PrefixMapV4<int>& map) { map.Apply(delta); });
+    }
+
+    done = true;
+    for (auto& thread: readers) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0u);
+
+    auto reader = cell.Register();
+    EXPECT_EQ(reader.Read()->Size(), 3u);
+    EXPECT_EQ(reader.Read()->Lookup(AddrV4(172, 16, 0, 1)).Unwrap(), kDeltas);
+}
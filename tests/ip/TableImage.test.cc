@@ -0,0 +1,348 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/IP/TableImage.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net::ip;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+using Status = TableImageError::Status;
+
+auto cidr4(Str input) -> NetworkV4
+{
+    return NetworkV4::FromStr(input).Value();
+}
+
+auto cidr6(Str input) -> NetworkV6
+{
+    return NetworkV6::FromStr(input).Value();
+}
+
+auto addr6(Str input) -> AddrV6
+{
+    return AddrV6::FromStr(input).Value();
+}
+
+// a copy of an image at a 64-byte boundary, plus `shift` bytes
+struct AlignedBytes final {
+    explicit AlignedBytes(Span<const UInt8> bytes, UInt shift = 0)
+        : n_data(static_cast<UInt8*>(std::aligned_alloc(64, bytes.size() + 64)))
+        , n_bytes(n_data + shift, bytes.size())
+    {
+        std::memcpy(this->n_bytes.data(), bytes.data(), bytes.size());
+    }
+
+    AlignedBytes(const AlignedBytes&) = delete;
+    auto operator=(const AlignedBytes&) -> AlignedBytes& = delete;
+
+    ~AlignedBytes()
+    {
+        std::free(this->n_data);
+    }
+
+    UInt8* n_data;
+    Span<UInt8> n_bytes;
+};
+
+auto open(const AlignedBytes& bytes) -> Result<TableImage, TableImageError>
+{
+    return TableImage::FromBytes(bytes.n_bytes);
+}
+
+struct Tables final {
+    IPSetV4 SetV4;
+    IPSetV6 SetV6;
+    PrefixMapV4<String> PrefixesV4;
+    PrefixMapV6<String> PrefixesV6;
+    Vec<Str> Labels;
+};
+
+auto makeTables() -> Tables
+{
+    Tables tables;
+    tables.SetV4 = IPSetV4::Builder()
+                       .Add(cidr4("10.0.0.0/8"))
+                       .Add(cidr4("192.168.1.0/24"))
+                       .Add(AddrV4(203, 0, 113, 7))
+                       .Build();
+
+    tables.SetV6 = IPSetV6::Builder().Add(cidr6("2001:db8::/32")).Add(AddrV6::Localhost()).Build();
+
+    tables.PrefixesV4.Insert(cidr4("0.0.0.0/0"), "default");
+    tables.PrefixesV4.Insert(cidr4("10.0.0.0/8"), "private");
+    tables.PrefixesV4.Insert(cidr4("10.1.2.128/25"), "lab");
+
+    tables.PrefixesV6.Insert(cidr6("2001:db8::/32"), "documentation");
+    tables.PrefixesV6.Insert(cidr6("2001:db8:1::/48"), "site");
+
+    // the two maps have their own ids, so only the IPv4 values are used as labels
+    for (const String& value: tables.PrefixesV4.Values()) {
+        tables.Labels.push_back(value);
+    }
+
+    return tables;
+}
+
+auto serialize(const Tables& tables) -> Vec<UInt8>
+{
+    return TableImageWriter()
+        .SetV4(tables.SetV4.AsView())
+        .SetV6(tables.SetV6.AsView())
+        .PrefixesV4(tables.PrefixesV4.AsView())
+        .PrefixesV6(tables.PrefixesV6.AsView())
+        .Labels(tables.Labels)
+        .Serialize();
+}
+
+auto label(const TableImage& image, UInt32 id) -> Str
+{
+    auto value = image.Label(id);
+    return value ? value.Unwrap() : "<none>";
+}
+
+void expectSameAs(const TableImage& image, const Tables& tables)
+{
+    ASSERT_TRUE(image.SetV4() && image.SetV6() && image.PrefixesV4() && image.PrefixesV6());
+
+    const auto setV4 = image.SetV4().Unwrap();
+    const auto setV6 = image.SetV6().Unwrap();
+    const auto prefixesV4 = image.PrefixesV4().Unwrap();
+    const auto prefixesV6 = image.PrefixesV6().Unwrap();
+
+    EXPECT_EQ(setV4.Size(), tables.SetV4.Size());
+    EXPECT_EQ(prefixesV4.Size(), tables.PrefixesV4.Size());
+    EXPECT_EQ(prefixesV6.Size(), tables.PrefixesV6.Size());
+
+    EXPECT_EQ(label(image, prefixesV4.Lookup(AddrV4(10, 1, 2, 200))), "lab");
+    EXPECT_EQ(label(image, prefixesV4.Lookup(AddrV4(10, 9, 9, 9))), "private");
+    EXPECT_EQ(label(image, prefixesV4.Lookup(AddrV4(8, 8, 8, 8))), "default");
+    EXPECT_EQ(prefixesV6.Lookup(addr6("2001:db8:2::1")), tables.PrefixesV6.AsView().Lookup(addr6("2001:db8:2::1")));
+    EXPECT_EQ(prefixesV6.Lookup(addr6("2001:db9::1")), detail::TreeBitmapV6::kNoMatch);
+
+    std::mt19937_64 rng(15);
+    for (int i = 0; i < 10000; i++) {
+        const auto v4 = AddrV4::FromUInt32(static_cast<UInt32>(rng()) & 0xCFFFFFFF);
+        const auto v6 = AddrV6(absl::MakeUint128(0x20010DB800000000 | (rng() & 0x3FFFFFFFF), rng()));
+
+        ASSERT_EQ(setV4.Contains(v4), tables.SetV4.Contains(v4)) << v4;
+        ASSERT_EQ(setV6.Contains(v6), tables.SetV6.Contains(v6)) << v6;
+        ASSERT_EQ(prefixesV4.Lookup(v4), tables.PrefixesV4.AsView().Lookup(v4)) << v4;
+        ASSERT_EQ(prefixesV6.Lookup(v6), tables.PrefixesV6.AsView().Lookup(v6)) << v6;
+    }
+}
+
+// rewrites the header checksum after the header or section table was edited on purpose
+void reseal(Span<UInt8> bytes)
+{
+    UInt32 count;
+    std::memcpy(&count, bytes.data() + 12, sizeof(count));
+
+    UInt32 crc = detail::Crc32c(bytes.first(60));
+    crc = detail::Crc32c(bytes.subspan(64, UInt(count) * 32), crc);
+    std::memcpy(bytes.data() + 60, &crc, sizeof(crc));
+}
+
+} // namespace
+
+TEST(TableImage, Crc32c)
+{
+    const Str check = "123456789";
+    const Span<const UInt8> bytes(reinterpret_cast<const UInt8*>(check.data()), check.size());
+
+    EXPECT_EQ(detail::Crc32c({ }), 0u);
+    EXPECT_EQ(detail::Crc32c(bytes), 0xE3069283u);
+    EXPECT_EQ(detail::Crc32c(bytes.subspan(4), detail::Crc32c(bytes.first(4))), 0xE3069283u);
+}
+
+TEST(TableImage, Empty)
+{
+    const auto bytes = TableImageWriter().Serialize();
+    EXPECT_EQ(bytes.size(), 64u);
+
+    const AlignedBytes aligned(bytes);
+    auto image = open(aligned);
+    ASSERT_TRUE(image);
+
+    EXPECT_TRUE(image->Verify());
+    EXPECT_FALSE(image->SetV4());
+    EXPECT_FALSE(image->SetV6());
+    EXPECT_FALSE(image->PrefixesV4());
+    EXPECT_FALSE(image->PrefixesV6());
+    EXPECT_FALSE(image->Label(0));
+}
+
+TEST(TableImage, RoundTripsInMemory)
+{
+    const Tables tables = makeTables();
+    const AlignedBytes aligned(serialize(tables));
+
+    auto image = open(aligned);
+    ASSERT_TRUE(image);
+    EXPECT_TRUE(image->Verify());
+    EXPECT_EQ(image->Bytes().size(), aligned.n_bytes.size());
+
+    expectSameAs(*image, tables);
+    EXPECT_FALSE(image->Label(static_cast<UInt32>(tables.Labels.size())));
+}
+
+TEST(TableImage, RoundTripsThroughAFile)
+{
+    const Tables tables = makeTables();
+    const String path = testing::TempDir() + "violet-table-image.vip";
+
+    auto written = TableImageWriter()
+                       .SetV4(tables.SetV4.AsView())
+                       .SetV6(tables.SetV6.AsView())
+                       .PrefixesV4(tables.PrefixesV4.AsView())
+                       .PrefixesV6(tables.PrefixesV6.AsView())
+                       .Labels(tables.Labels)
+                       .WriteTo(path);
+    ASSERT_TRUE(written);
+
+    auto image = TableImage::Open(path);
+    ASSERT_TRUE(image) << image.Error();
+    EXPECT_TRUE(image->Verify());
+    expectSameAs(*image, tables);
+
+    // the views stay valid in the moved-to image, which now owns the mapping
+    TableImage moved = std::move(image.Value());
+    expectSameAs(moved, tables);
+
+    std::remove(path.c_str());
+}
+
+TEST(TableImage, OpenReportsSystemErrors)
+{
+    auto image = TableImage::Open(testing::TempDir() + "violet-table-image-missing.vip");
+    ASSERT_FALSE(image);
+    EXPECT_EQ(image.Error().Kind(), Status::kSystem);
+    EXPECT_EQ(image.Error().Errno(), ENOENT);
+}
+
+TEST(TableImage, RejectsMalformedImages)
+{
+    const Tables tables = makeTables();
+    const auto bytes = TableImageWriter().SetV4(tables.SetV4.AsView()).SetV6(tables.SetV6.AsView()).Serialize();
+
+    {
+        const AlignedBytes aligned(bytes, 1);
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kMisaligned);
+    }
+
+    {
+        const AlignedBytes aligned(Span<const UInt8>(bytes).first(bytes.size() - 64));
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kTruncated);
+    }
+
+    {
+        const AlignedBytes aligned(Span<const UInt8>(bytes).first(32));
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kTruncated);
+    }
+
+    {
+        const AlignedBytes aligned(bytes);
+        aligned.n_bytes[0] = 'X';
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kBadMagic);
+    }
+
+    {
+        const AlignedBytes aligned(bytes);
+        aligned.n_bytes[8] = 2;
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kUnsupportedVersion);
+    }
+
+    {
+        // the size of the first section
+        const AlignedBytes aligned(bytes);
+        aligned.n_bytes[64 + 16] ^= 0x40;
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kCorruptHeader);
+    }
+
+    {
+        // same, with a valid header checksum
+        const AlignedBytes aligned(bytes);
+        aligned.n_bytes[64 + 16 + 7] = 0x10;
+        reseal(aligned.n_bytes);
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kInvalidSection);
+    }
+
+    {
+        // both sections are IPv4 sets
+        const AlignedBytes aligned(bytes);
+        aligned.n_bytes[64 + 32] = 1;
+        reseal(aligned.n_bytes);
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kInvalidSection);
+    }
+
+    {
+        // the IPv4 set doesn't start with its sentinel
+        const AlignedBytes aligned(bytes);
+        UInt64 offset;
+        std::memcpy(&offset, aligned.n_bytes.data() + 64 + 8, sizeof(offset));
+        aligned.n_bytes[offset] = 0;
+        EXPECT_EQ(open(aligned).Error().Kind(), Status::kInvalidSection);
+    }
+}
+
+TEST(TableImage, VerifyDetectsCorruptedSections)
+{
+    const Tables tables = makeTables();
+    const AlignedBytes aligned(TableImageWriter().SetV4(tables.SetV4.AsView()).Serialize());
+
+    // a range after the sentinel, which opening doesn't look at
+    UInt64 offset;
+    std::memcpy(&offset, aligned.n_bytes.data() + 64 + 8, sizeof(offset));
+    aligned.n_bytes[offset + 8] ^= 1;
+
+    auto image = open(aligned);
+    ASSERT_TRUE(image);
+
+    auto verified = image->Verify();
+    ASSERT_FALSE(verified);
+    EXPECT_EQ(verified.Error().Kind(), Status::kChecksumMismatch);
+}
+
+TEST(TableImage, IgnoresUnknownSections)
+{
+    const Tables tables = makeTables();
+    const AlignedBytes aligned(
+        TableImageWriter().SetV4(tables.SetV4.AsView()).SetV6(tables.SetV6.AsView()).Serialize());
+
+    aligned.n_bytes[64] = 100;
+    reseal(aligned.n_bytes);
+
+    auto image = open(aligned);
+    ASSERT_TRUE(image);
+    EXPECT_TRUE(image->Verify());
+    EXPECT_FALSE(image->SetV4());
+    ASSERT_TRUE(image->SetV6());
+    EXPECT_TRUE(image->SetV6()->Contains(AddrV6::Localhost()));
+}
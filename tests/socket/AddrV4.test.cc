@@ -19,9 +19,14 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <absl/hash/hash_testing.h>
 #include <gtest/gtest.h>
 #include <violet/Networking/Socket/AddrV4.h>
 
+#include <arpa/inet.h>
+
+#include <unordered_set>
+
 // NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
 using namespace violet::net;
 using namespace violet;
@@ -77,4 +82,74 @@ TEST(SocketAddrV4, Comparison)
     EXPECT_TRUE(c > a);
 }
 
+TEST(SocketAddrV4, ParseErrors)
+{
+    static_assert(sizeof(socket::ParseV4Error) == 4);
+
+    auto outOfRange = socket::AddrV4::FromStr("1.2.3.4:99999").Error();
+    EXPECT_EQ(outOfRange.Kind(), socket::ParseV4Error::ErrorKind::kPortOutOfRange);
+    EXPECT_EQ(outOfRange.Offset(), 8);
+    EXPECT_FALSE(outOfRange.Address());
+
+    auto emptyPort = socket::AddrV4::FromStr("1.2.3.4:").Error();
+    EXPECT_EQ(emptyPort.Kind(), socket::ParseV4Error::ErrorKind::kInvalidPort);
+    EXPECT_EQ(emptyPort.ToString(), "Invalid argument");
+
+    auto address = socket::AddrV4::FromStr("1.2.300.4:80").Error();
+    EXPECT_EQ(address.Kind(), socket::ParseV4Error::ErrorKind::kInvalidAddress);
+    EXPECT_EQ(address.Offset(), 4);
+    ASSERT_TRUE(address.Address());
+    EXPECT_EQ(address.Address()->Kind(), ip::AddrV4::ParseStatus::kMaxOctetNumber);
+    EXPECT_EQ(address.ToString(), "invalid IPv4 address: max octet number (>255)");
+}
+
+TEST(SocketAddrV4, Hash)
+{
+    EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly({
+        socket::AddrV4(), socket::AddrV4(ip::AddrV4(10, 0, 0, 1), 80), socket::AddrV4(ip::AddrV4(10, 0, 0, 1), 81),
+        socket::AddrV4(ip::AddrV4(10, 0, 0, 2), 80) }));
+
+    const auto address = socket::AddrV4(ip::AddrV4(10, 0, 0, 1), 80);
+    EXPECT_EQ(std::hash<socket::AddrV4>{ }(address), FixedHash(address));
+    EXPECT_NE(FixedHash(address), ip::FixedHash(address.Address));
+
+    // every port of one address, like the flows behind a NAT
+    std::unordered_set<UInt> hashes;
+    for (UInt32 port = 0; port < 65536; port++) {
+        hashes.insert(std::hash<socket::AddrV4>{ }({ address.Address, static_cast<UInt16>(port) }));
+    }
+
+    EXPECT_EQ(hashes.size(), 65536u);
+}
+
+TEST(SocketAddrV4, ToSockAddr)
+{
+    sockaddr_in expected{ };
+    expected.sin_family = AF_INET;
+    expected.sin_port = htons(8080);
+    ASSERT_EQ(inet_pton(AF_INET, "192.168.1.10", &expected.sin_addr), 1);
+
+    sockaddr_in actual; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    std::memset(&actual, 0xAA, sizeof(actual));
+    EXPECT_EQ(socket::AddrV4(ip::AddrV4(192, 168, 1, 10), 8080).ToSockAddr(actual), sizeof(sockaddr_in));
+    EXPECT_EQ(std::memcmp(&actual, &expected, sizeof(sockaddr_in)), 0);
+}
+
+TEST(SocketAddrV4, FromSockAddr)
+{
+    sockaddr_storage storage{ };
+    const auto address = socket::AddrV4(ip::AddrV4(10, 0, 0, 1), 53);
+    const socklen_t length = address.ToSockAddr(storage);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* sa = reinterpret_cast<const sockaddr*>(&storage);
+    EXPECT_EQ(socket::AddrV4::FromSockAddr(sa, length), Some<socket::AddrV4>(address));
+    EXPECT_FALSE(socket::AddrV4::FromSockAddr(sa, length - 1));
+    EXPECT_FALSE(socket::AddrV4::FromSockAddr(nullptr, length));
+
+    storage.ss_family = AF_INET6;
+    EXPECT_FALSE(socket::AddrV4::FromSockAddr(sa, sizeof(storage)));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
 // NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -19,9 +19,14 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <absl/hash/hash_testing.h>
 #include <gtest/gtest.h>
 #include <violet/Networking/Socket/AddrV6.h>
 
+#include <arpa/inet.h>
+
+#include <unordered_set>
+
 // NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
 using namespace violet::net;
 using namespace violet;
@@ -77,4 +82,129 @@ TEST(SocketAddrV6, ComparisonOperators)
     EXPECT_TRUE(c > a);
 }
 
+TEST(SocketAddrV6, ParseErrors)
+{
+    static_assert(sizeof(socket::ParseV6Error) == 4);
+
+    using ErrorKind = socket::ParseV6Error::ErrorKind;
+
+    EXPECT_EQ(socket::AddrV6::FromStr("::1").Error().Kind(), ErrorKind::kInvalidBracketPlacement);
+    EXPECT_EQ(socket::AddrV6::FromStr("::1").Error().Offset(), 0);
+    EXPECT_EQ(socket::AddrV6::FromStr("[::1").Error().Offset(), 4);
+    EXPECT_EQ(socket::AddrV6::FromStr("[::1]x").Error().Offset(), 5);
+    EXPECT_EQ(socket::AddrV6::FromStr("[::1]x").Error().ToString(), "invalid bracket placement");
+
+    auto port = socket::AddrV6::FromStr("[::1]:x").Error();
+    EXPECT_EQ(port.Kind(), ErrorKind::kInvalidPort);
+    EXPECT_EQ(port.Offset(), 6);
+
+    // offsets into the address are relative to the whole input
+    auto address = socket::AddrV6::FromStr("[::g]:80").Error();
+    EXPECT_EQ(address.Kind(), ErrorKind::kInvalidAddress);
+    EXPECT_EQ(address.Offset(), 3);
+    ASSERT_TRUE(address.Address());
+    EXPECT_EQ(address.Address()->Kind(), ip::AddrV6::ParseStatus::kInvalidIntegral);
+
+    auto scope = socket::AddrV6::FromStr("[fe80::1%x]:80").Error();
+    EXPECT_EQ(scope.Kind(), ErrorKind::kInvalidScopeId);
+    EXPECT_EQ(scope.Offset(), 9);
+    EXPECT_EQ(scope.ToString(), "invalid scope id");
+    EXPECT_EQ(socket::AddrV6::FromStr("[fe80::1%4294967296]").Error().Kind(), ErrorKind::kInvalidScopeId);
+}
+
+TEST(SocketAddrV6, ScopeId)
+{
+    const ip::AddrV6 linkLocal(0xfe80, 0, 0, 0, 0, 0, 0, 1);
+
+    auto parsed = socket::AddrV6::FromStr("[fe80::1%3]:80");
+    ASSERT_TRUE(parsed.Ok());
+    EXPECT_EQ(parsed.Value(), socket::AddrV6(linkLocal, 80, 0, 3));
+    EXPECT_EQ(parsed.Value().ToString(), "[fe80::1%3]:80");
+    EXPECT_EQ(socket::AddrV6::Parse("[fe80::1%3]:80"), Some<socket::AddrV6>(parsed.Value()));
+
+    // a zero scope id is the same as none, and the flow information isn't printed
+    EXPECT_EQ(socket::AddrV6(linkLocal, 80, 7, 0).ToString(), "[fe80::1]:80");
+    EXPECT_NE(socket::AddrV6(linkLocal, 80, 0, 1), socket::AddrV6(linkLocal, 80, 0, 2));
+    EXPECT_NE(FixedHash(socket::AddrV6(linkLocal, 80, 0, 1)), FixedHash(socket::AddrV6(linkLocal, 80, 0, 2)));
+}
+
+TEST(SocketAddrV6, FlowInfoIsNotIdentity)
+{
+    // the same peer with another flow label is the same address, in every container
+    const socket::AddrV6 first(ip::AddrV6::Localhost(), 443, 0x00001, 0);
+    const socket::AddrV6 relabeled(ip::AddrV6::Localhost(), 443, 0xABCDE, 0);
+
+    EXPECT_EQ(first, relabeled);
+    EXPECT_EQ(first <=> relabeled, std::strong_ordering::equal);
+    EXPECT_EQ(absl::HashOf(first), absl::HashOf(relabeled));
+    EXPECT_EQ(std::hash<socket::AddrV6>{ }(first), std::hash<socket::AddrV6>{ }(relabeled));
+
+    // but it's still carried along to the kernel
+    sockaddr_in6 out{ };
+    relabeled.ToSockAddr(out);
+    EXPECT_EQ(ntohl(out.sin6_flowinfo), 0xABCDEu);
+
+    // unlike the scope id
+    EXPECT_NE(first, socket::AddrV6(ip::AddrV6::Localhost(), 443, 0x00001, 1));
+}
+
+TEST(SocketAddrV6, ToSockAddr)
+{
+    sockaddr_in6 expected{ };
+    expected.sin6_family = AF_INET6;
+    expected.sin6_port = htons(443);
+    expected.sin6_flowinfo = htonl(0xABCDE);
+    expected.sin6_scope_id = 2;
+    ASSERT_EQ(inet_pton(AF_INET6, "fe80::1:2:3:4", &expected.sin6_addr), 1);
+
+    sockaddr_in6 actual; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    std::memset(&actual, 0xAA, sizeof(actual));
+
+    const socket::AddrV6 address(ip::AddrV6(0xfe80, 0, 0, 0, 1, 2, 3, 4), 443, 0xABCDE, 2);
+    EXPECT_EQ(address.ToSockAddr(actual), sizeof(sockaddr_in6));
+    EXPECT_EQ(std::memcmp(&actual, &expected, sizeof(sockaddr_in6)), 0);
+}
+
+TEST(SocketAddrV6, FromSockAddr)
+{
+    sockaddr_storage storage{ };
+    const socket::AddrV6 address(ip::AddrV6(0x2001, 0xdb8, 0, 0, 0, 0, 0, 1), 8443, 0x12345, 7);
+    const socklen_t length = address.ToSockAddr(storage);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* sa = reinterpret_cast<const sockaddr*>(&storage);
+    auto back = socket::AddrV6::FromSockAddr(sa, length);
+    ASSERT_TRUE(back);
+    EXPECT_EQ(back->FlowInfo, 0x12345u);
+    EXPECT_EQ(back->ScopeId, 7u);
+    EXPECT_EQ(back.Unwrap(), address);
+
+    EXPECT_FALSE(socket::AddrV6::FromSockAddr(sa, sizeof(sockaddr_in)));
+    EXPECT_FALSE(socket::AddrV6::FromSockAddr(nullptr, length));
+
+    storage.ss_family = AF_INET;
+    EXPECT_FALSE(socket::AddrV6::FromSockAddr(sa, sizeof(storage)));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+TEST(SocketAddrV6, Hash)
+{
+    EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly({
+        socket::AddrV6(), socket::AddrV6(ip::AddrV6::Localhost(), 80), socket::AddrV6(ip::AddrV6::Localhost(), 81),
+        socket::AddrV6(ip::AddrV6::FromWords(1, 1), 80), socket::AddrV6(ip::AddrV6::Localhost(), 80, 0, 1),
+        socket::AddrV6(ip::AddrV6::Localhost(), 80, 1, 0) }));
+
+    const auto address = socket::AddrV6(ip::AddrV6::Localhost(), 80);
+    EXPECT_EQ(std::hash<socket::AddrV6>{ }(address), FixedHash(address));
+    EXPECT_NE(FixedHash(address), ip::FixedHash(address.Address));
+
+    // every port of one address, like the flows behind a NAT
+    std::unordered_set<UInt> hashes;
+    for (UInt32 port = 0; port < 65536; port++) {
+        hashes.insert(std::hash<socket::AddrV6>{ }({ address.Address, static_cast<UInt16>(port) }));
+    }
+
+    EXPECT_EQ(hashes.size(), 65536u);
+}
+
 // NOLINTEND(google-build-using-namespace,readability-identifier-length)
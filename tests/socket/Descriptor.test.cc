@@ -0,0 +1,91 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/Socket/Descriptor.h>
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+TEST(SocketDescriptor, OwnsAndCloses)
+{
+    auto opened = socket::Descriptor::Open(SocketAddress::Type::V4, SOCK_DGRAM);
+    ASSERT_TRUE(opened.Ok()) << opened.Error();
+
+    socket::Descriptor fd = std::move(opened.Value());
+    const int raw = fd.Get();
+    ASSERT_TRUE(fd.Valid());
+    EXPECT_NE(::fcntl(raw, F_GETFD) & FD_CLOEXEC, 0);
+
+    socket::Descriptor moved = std::move(fd);
+    EXPECT_FALSE(fd.Valid()); // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+    EXPECT_EQ(moved.Get(), raw);
+
+    moved.Close();
+    EXPECT_FALSE(moved.Valid());
+    EXPECT_EQ(::fcntl(raw, F_GETFD), -1);
+}
+
+TEST(SocketDescriptor, BindAndLocalAddress)
+{
+    auto fd = std::move(socket::Descriptor::Open(SocketAddress::Type::V6, SOCK_DGRAM).Value());
+    ASSERT_TRUE(fd.Bind(SocketAddress::V6({ ip::AddrV6::Localhost(), 0 })).Ok());
+
+    auto local = fd.LocalAddress();
+    ASSERT_TRUE(local.Ok()) << local.Error();
+    ASSERT_EQ(local.Value().TypeOf(), SocketAddress::Type::V6);
+
+    const socket::AddrV6& address = local.Value().AsV6().Unwrap();
+    EXPECT_EQ(address.Address, ip::AddrV6::Localhost());
+    EXPECT_NE(address.Port, 0);
+
+    // not connected
+    EXPECT_EQ(fd.PeerAddress().Error(), socket::SocketError(ENOTCONN));
+}
+
+TEST(SocketDescriptor, Options)
+{
+    auto fd = std::move(socket::Descriptor::Open(SocketAddress::Type::V4, SOCK_STREAM).Value());
+
+    ASSERT_TRUE(fd.SetOption(SOL_SOCKET, SO_REUSEADDR, 1).Ok());
+    EXPECT_EQ(fd.GetOption(SOL_SOCKET, SO_REUSEADDR).Value(), 1);
+
+    ASSERT_TRUE(fd.SetNonBlocking(true).Ok());
+    EXPECT_NE(::fcntl(fd.Get(), F_GETFL) & O_NONBLOCK, 0);
+    ASSERT_TRUE(fd.SetNonBlocking(false).Ok());
+    EXPECT_EQ(::fcntl(fd.Get(), F_GETFL) & O_NONBLOCK, 0);
+
+    EXPECT_EQ(fd.SetOption(SOL_SOCKET, -1, 1).Error().Errno(), ENOPROTOOPT);
+}
+
+TEST(SocketDescriptor, Errors)
+{
+    EXPECT_TRUE(socket::SocketError(EAGAIN).WouldBlock());
+    EXPECT_FALSE(socket::SocketError(ECONNREFUSED).WouldBlock());
+    EXPECT_EQ(socket::SocketError(ECONNREFUSED).ToString(), "Connection refused");
+}
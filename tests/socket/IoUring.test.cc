@@ -0,0 +1,135 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/Socket/IoUring.h>
+
+#include <thread>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+using socket::detail::IoUring;
+
+namespace {
+
+// io_uring can be disabled (`kernel.io_uring_disabled`) or filtered out by seccomp in containers.
+auto create(UInt32 entries) -> Optional<IoUring>
+{
+    auto ring = IoUring::Create(entries);
+    if (ring.Err()) {
+        return Nothing;
+    }
+
+    return Some<IoUring>(std::move(ring.Value()));
+}
+
+} // namespace
+
+TEST(IoUring, Nop)
+{
+    auto ring = create(8);
+    if (!ring) {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    for (UInt64 i = 0; i < 3; i++) {
+        io_uring_sqe* sqe = ring->NextSqe();
+        ASSERT_NE(sqe, nullptr);
+
+        sqe->opcode = IORING_OP_NOP;
+        sqe->user_data = i;
+    }
+
+    EXPECT_EQ(ring->Unsubmitted(), 3u);
+
+    auto entered = ring->Enter(3);
+    ASSERT_TRUE(entered.Ok()) << entered.Error();
+    EXPECT_EQ(entered.Value(), 3u);
+    EXPECT_EQ(ring->Unsubmitted(), 0u);
+
+    Vec<UInt64> completed;
+    EXPECT_EQ(ring->Drain([&](const io_uring_cqe& cqe) {
+        EXPECT_EQ(cqe.res, 0);
+        completed.push_back(cqe.user_data);
+    }),
+        3u);
+
+    EXPECT_EQ(completed, (Vec<UInt64>{ 0, 1, 2 }));
+    EXPECT_EQ(ring->Drain([](const io_uring_cqe&) { FAIL() << "drained a completion twice"; }), 0u);
+    EXPECT_EQ(ring->Enters(), 1u);
+}
+
+TEST(IoUring, FullQueue)
+{
+    auto ring = create(4);
+    if (!ring) {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    for (UInt i = 0; i < 4; i++) {
+        io_uring_sqe* sqe = ring->NextSqe();
+        ASSERT_NE(sqe, nullptr);
+        sqe->opcode = IORING_OP_NOP;
+    }
+
+    EXPECT_EQ(ring->NextSqe(), nullptr);
+
+    ASSERT_TRUE(ring->Enter(0).Ok());
+    EXPECT_NE(ring->NextSqe(), nullptr);
+}
+
+TEST(IoUring, Timeout)
+{
+    auto ring = create(4);
+    if (!ring) {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    auto entered = ring->Enter(1, std::chrono::milliseconds(10));
+    ASSERT_TRUE(entered.Err());
+    EXPECT_EQ(entered.Error().Errno(), ETIME);
+}
+
+TEST(IoUring, EnteredFromAnotherThread)
+{
+    auto ring = create(4);
+    if (!ring) {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    // the ring belongs to the thread that enters it first, not to the one that created it
+    std::thread([&ring] {
+        for (int i = 0; i < 2; i++) {
+            io_uring_sqe* sqe = ring->NextSqe();
+            ASSERT_NE(sqe, nullptr);
+            sqe->opcode = IORING_OP_NOP;
+
+            auto entered = ring->Enter(1);
+            ASSERT_TRUE(entered.Ok()) << entered.Error();
+            EXPECT_EQ(ring->Drain([](const io_uring_cqe& cqe) { EXPECT_EQ(cqe.res, 0); }), 1u);
+        }
+    }).join();
+
+    EXPECT_EQ(ring->Enters(), 2u);
+}
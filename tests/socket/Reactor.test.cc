@@ -0,0 +1,453 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/Socket/Reactor.h>
+
+#include <algorithm>
+#include <map>
+#include <thread>
+
+#include <sys/socket.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+using socket::ConnectionId;
+using socket::Reactor;
+
+namespace {
+
+auto bytesOf(Str text) -> Span<const UInt8>
+{
+    return { reinterpret_cast<const UInt8*>(text.data()), text.size() }; // NOLINT
+}
+
+// Echoes what it receives, and closes a connection when it receives "bye".
+struct Echo final: Reactor::Handler {
+    Vec<ConnectionId> Opened;
+    std::map<ConnectionId, Optional<socket::SocketError>> Closed;
+    Vec<socket::SocketError> AcceptErrors;
+    UInt CloseCount = 0;
+    UInt Received = 0;
+
+    void OnOpen(Reactor&, ConnectionId id) override
+    {
+        this->Opened.push_back(id);
+    }
+
+    void OnData(Reactor& reactor, ConnectionId id, Span<const UInt8> data) override
+    {
+        this->Received += data.size();
+        if (Str(reinterpret_cast<const char*>(data.data()), data.size()) == "bye") { // NOLINT
+            reactor.Close(id);
+            return;
+        }
+
+        reactor.Send(id, data);
+    }
+
+    void OnClose(Reactor&, ConnectionId id, Optional<socket::SocketError> error) override
+    {
+        this->Closed.insert_or_assign(id, error);
+        this->CloseCount++;
+    }
+
+    void OnAcceptError(Reactor&, socket::SocketError error) override
+    {
+        this->AcceptErrors.push_back(error);
+    }
+};
+
+struct ReactorTest: testing::Test {
+    void SetUp() override
+    {
+        auto created = Reactor::Create(this->Handler, this->Options());
+        if (created.Err()) {
+            GTEST_SKIP() << "io_uring is not available: " << created.Error();
+        }
+
+        this->Loop = Some<Reactor>(std::move(created.Value()));
+        this->Listener = Some<socket::TcpListener>(
+            std::move(socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })).Value()));
+
+        ASSERT_TRUE(this->Loop->Listen(*this->Listener).Ok());
+    }
+
+    auto Options() const -> Reactor::Options
+    {
+        return { .Entries = 64, .MaxConnections = 16, .BufferCount = 16, .BufferSize = 256 };
+    }
+
+    auto Connect() -> socket::TcpStream
+    {
+        auto client = std::move(socket::TcpStream::Connect(this->Listener->LocalAddress().Value()).Value());
+        EXPECT_TRUE(client.SetNonBlocking(true).Ok());
+
+        return client;
+    }
+
+    // Polls the reactor until `done` returns **true**, or a second has passed.
+    template<typename Fn>
+    auto PollUntil(Fn&& done) -> bool
+    {
+        for (UInt i = 0; i < 100 && !done(); i++) {
+            auto polled = this->Loop->Poll(std::chrono::milliseconds(10));
+            EXPECT_TRUE(polled.Ok()) << polled.Error();
+        }
+
+        return done();
+    }
+
+    // Reads what's available from `client` into `into`, polling the reactor in between, until it has
+    // `size` bytes or the stream ends.
+    auto ReadAll(socket::TcpStream& client, UInt size) -> String
+    {
+        String into;
+        Array<UInt8, 4096> buffer{ };
+        this->PollUntil([&] {
+            while (into.size() < size) {
+                auto read = client.Read(buffer);
+                if (read.Err() || read.Value() == 0) {
+                    break;
+                }
+
+                into.append(reinterpret_cast<const char*>(buffer.data()), read.Value()); // NOLINT
+            }
+
+            return into.size() >= size;
+        });
+
+        return into;
+    }
+
+    Echo Handler;
+    Optional<Reactor> Loop;
+    Optional<socket::TcpListener> Listener;
+};
+
+} // namespace
+
+TEST_F(ReactorTest, Echo)
+{
+    auto client = this->Connect();
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 1; }));
+    EXPECT_EQ(this->Handler.Opened.size(), 1u);
+
+    ASSERT_EQ(client.Write(bytesOf("hello")).Value(), 5u);
+    EXPECT_EQ(this->ReadAll(client, 5), "hello");
+
+    ASSERT_EQ(client.Write(bytesOf("world")).Value(), 5u);
+    EXPECT_EQ(this->ReadAll(client, 5), "world");
+
+    const auto stats = this->Loop->Statistics();
+    EXPECT_EQ(stats.Accepted, 1u);
+    EXPECT_EQ(stats.Received, 2u);
+    EXPECT_GT(stats.Completions, 0u);
+    EXPECT_GT(stats.Enters, 0u);
+}
+
+TEST_F(ReactorTest, PolledFromAnotherThread)
+{
+    // the reactor was set up on this thread, and belongs to the one that polls it first
+    auto client = this->Connect();
+    String echoed;
+    std::thread([&] {
+        ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 1; }));
+        ASSERT_EQ(client.Write(bytesOf("hello")).Value(), 5u);
+        echoed = this->ReadAll(client, 5);
+    }).join();
+
+    EXPECT_EQ(echoed, "hello");
+}
+
+TEST_F(ReactorTest, ManyConnections)
+{
+    Vec<socket::TcpStream> clients;
+    for (UInt i = 0; i < 8; i++) {
+        clients.push_back(this->Connect());
+    }
+
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == clients.size(); }));
+
+    for (UInt i = 0; i < clients.size(); i++) {
+        const String message = "client " + std::to_string(i);
+        ASSERT_EQ(clients[i].Write(bytesOf(message)).Value(), message.size());
+    }
+
+    for (UInt i = 0; i < clients.size(); i++) {
+        const String message = "client " + std::to_string(i);
+        EXPECT_EQ(this->ReadAll(clients[i], message.size()), message);
+    }
+
+    // every connection got its own slot of the table
+    auto opened = this->Handler.Opened;
+    std::sort(opened.begin(), opened.end());
+    EXPECT_EQ(std::unique(opened.begin(), opened.end()), opened.end());
+}
+
+TEST_F(ReactorTest, PeerCloses)
+{
+    {
+        auto client = this->Connect();
+        ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 1; }));
+    }
+
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 0; }));
+    ASSERT_EQ(this->Handler.Closed.size(), 1u);
+    EXPECT_FALSE(this->Handler.Closed.begin()->second.HasValue());
+}
+
+TEST_F(ReactorTest, ServerCloses)
+{
+    auto client = this->Connect();
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 1; }));
+
+    ASSERT_EQ(client.Write(bytesOf("bye")).Value(), 3u);
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 0; }));
+    EXPECT_EQ(this->Handler.Closed.size(), 1u);
+
+    // the client sees the end of the stream
+    Array<UInt8, 16> buffer{ };
+    ASSERT_TRUE(client.SetNonBlocking(false).Ok());
+    EXPECT_EQ(client.Read(buffer).Value(), 0u);
+}
+
+TEST_F(ReactorTest, ReusesSlots)
+{
+    // more connections than the table has room for go through it, one after another
+    for (UInt i = 0; i < 40; i++) {
+        auto client = this->Connect();
+        ASSERT_EQ(client.Write(bytesOf("bye")).Value(), 3u);
+        ASSERT_TRUE(this->PollUntil([&] {
+            return this->Handler.CloseCount == i + 1 && this->Loop->Connections() == 0;
+        }))
+            << "connection " << i;
+    }
+
+    EXPECT_EQ(this->Loop->Statistics().Accepted, 40u);
+}
+
+TEST_F(ReactorTest, Adopt)
+{
+    auto server = std::move(socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })).Value());
+    auto outgoing = std::move(socket::TcpStream::Connect(server.LocalAddress().Value()).Value());
+
+    this->Loop->Adopt(std::move(outgoing));
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 1; }));
+
+    Vec<socket::TcpStream> peer;
+    ASSERT_TRUE(this->PollUntil([&] {
+        if (auto accepted = server.Accept(); accepted.Ok()) {
+            peer.push_back(std::move(accepted.Value().Stream));
+        }
+
+        return !peer.empty();
+    }));
+
+    ASSERT_EQ(peer[0].Write(bytesOf("ping")).Value(), 4u);
+    EXPECT_EQ(this->ReadAll(peer[0], 4), "ping");
+    EXPECT_EQ(this->Loop->Statistics().Accepted, 0u);
+
+    // an adopted stream still had its descriptor to ask for the peer
+    ASSERT_EQ(this->Handler.Opened.size(), 1u);
+    EXPECT_EQ(this->Loop->PeerAddress(this->Handler.Opened[0]), Some<SocketAddress>(server.LocalAddress().Value()));
+}
+
+TEST_F(ReactorTest, NoPeerAddressesByDefault)
+{
+    auto client = this->Connect();
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 1; }));
+    EXPECT_FALSE(this->Loop->PeerAddress(this->Handler.Opened[0]).HasValue());
+}
+
+TEST_F(ReactorTest, LargerThanTheBuffers)
+{
+    auto client = this->Connect();
+    ASSERT_TRUE(this->PollUntil([&] { return this->Loop->Connections() == 1; }));
+
+    // 64 KiB through 16 buffers of 256 bytes, so the receive runs out of buffers and is re-armed
+    String payload(64 * 1024, '\0');
+    for (UInt i = 0; i < payload.size(); i++) {
+        payload[i] = static_cast<char>('a' + (i % 26));
+    }
+
+    UInt written = 0;
+    String echoed;
+    Array<UInt8, 4096> buffer{ };
+    ASSERT_TRUE(this->PollUntil([&] {
+        while (written < payload.size()) {
+            auto wrote = client.Write(bytesOf(Str(payload).substr(written)));
+            if (wrote.Err()) {
+                break;
+            }
+
+            written += wrote.Value();
+        }
+
+        while (true) {
+            auto read = client.Read(buffer);
+            if (read.Err() || read.Value() == 0) {
+                break;
+            }
+
+            echoed.append(reinterpret_cast<const char*>(buffer.data()), read.Value()); // NOLINT
+        }
+
+        return echoed.size() == payload.size();
+    }));
+
+    EXPECT_EQ(echoed, payload);
+    EXPECT_EQ(this->Handler.Received, payload.size());
+}
+
+TEST_F(ReactorTest, AcceptError)
+{
+    // a listening socket that's shut down fails its accepts with `EINVAL`
+    ASSERT_TRUE(this->Loop->Poll(std::chrono::milliseconds(1)).Ok());
+    ASSERT_EQ(::shutdown(this->Listener->AsDescriptor().Get(), SHUT_RDWR), 0);
+
+    ASSERT_TRUE(this->PollUntil([&] { return !this->Handler.AcceptErrors.empty(); }));
+    EXPECT_EQ(this->Handler.AcceptErrors, (Vec<socket::SocketError>{ socket::SocketError(EINVAL) }));
+}
+
+TEST(Reactor, PeerAddresses)
+{
+    Echo handler;
+    auto created = Reactor::Create(handler, { .MaxConnections = 16, .PeerAddresses = true });
+    if (created.Err()) {
+        GTEST_SKIP() << "io_uring is not available: " << created.Error();
+    }
+
+    auto& reactor = created.Value();
+    auto listener = std::move(socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })).Value());
+    ASSERT_TRUE(reactor.Listen(listener).Ok());
+
+    // more connections than one accept takes, so that it's re-armed for each
+    Vec<socket::TcpStream> clients;
+    for (UInt i = 0; i < 4; i++) {
+        clients.push_back(std::move(socket::TcpStream::Connect(listener.LocalAddress().Value()).Value()));
+    }
+
+    for (UInt i = 0; i < 100 && reactor.Connections() < clients.size(); i++) {
+        ASSERT_TRUE(reactor.Poll(std::chrono::milliseconds(10)).Ok());
+    }
+
+    ASSERT_EQ(handler.Opened.size(), clients.size());
+
+    Vec<SocketAddress> expected;
+    Vec<SocketAddress> peers;
+    for (UInt i = 0; i < clients.size(); i++) {
+        expected.push_back(clients[i].LocalAddress().Value());
+
+        auto peer = reactor.PeerAddress(handler.Opened[i]);
+        ASSERT_TRUE(peer.HasValue());
+        peers.push_back(peer.Unwrap());
+    }
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(peers.begin(), peers.end());
+    EXPECT_EQ(peers, expected);
+    EXPECT_FALSE(reactor.PeerAddress(15).HasValue());
+}
+
+TEST(Reactor, ListenerClosedAfterListen)
+{
+    Echo handler;
+    auto created = Reactor::Create(handler, { .MaxConnections = 16, .PeerAddresses = true });
+    if (created.Err()) {
+        GTEST_SKIP() << "io_uring is not available: " << created.Error();
+    }
+
+    // the accepts are re-armed on the reactor's own descriptor, not on the one that was closed
+    auto& reactor = created.Value();
+    SocketAddress address = SocketAddress::V4({ });
+    {
+        auto listener = std::move(socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })).Value());
+        address = listener.LocalAddress().Value();
+        ASSERT_TRUE(reactor.Listen(listener).Ok());
+    }
+
+    Vec<socket::TcpStream> clients;
+    for (UInt i = 0; i < 3; i++) {
+        clients.push_back(std::move(socket::TcpStream::Connect(address).Value()));
+    }
+
+    for (UInt i = 0; i < 100 && reactor.Connections() < clients.size(); i++) {
+        ASSERT_TRUE(reactor.Poll(std::chrono::milliseconds(10)).Ok());
+    }
+
+    EXPECT_EQ(reactor.Connections(), clients.size());
+    EXPECT_TRUE(handler.AcceptErrors.empty());
+}
+
+TEST(Reactor, SubmissionQueueOfOne)
+{
+    // every connection needs more entries than the queue has room for in one turn, so the reactor has to
+    // submit them as it goes
+    Echo handler;
+    auto created = Reactor::Create(handler, { .Entries = 1, .MaxConnections = 16, .BufferCount = 16 });
+    if (created.Err()) {
+        GTEST_SKIP() << "io_uring is not available: " << created.Error();
+    }
+
+    auto& reactor = created.Value();
+    auto listener = std::move(socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })).Value());
+    ASSERT_TRUE(reactor.Listen(listener).Ok());
+
+    Vec<socket::TcpStream> clients;
+    for (UInt i = 0; i < 8; i++) {
+        clients.push_back(std::move(socket::TcpStream::Connect(listener.LocalAddress().Value()).Value()));
+        ASSERT_TRUE(clients.back().SetNonBlocking(true).Ok());
+    }
+
+    for (UInt i = 0; i < 100 && reactor.Connections() < clients.size(); i++) {
+        ASSERT_TRUE(reactor.Poll(std::chrono::milliseconds(10)).Ok());
+    }
+
+    ASSERT_EQ(reactor.Connections(), clients.size());
+    for (auto& client: clients) {
+        ASSERT_EQ(client.Write(bytesOf("ping")).Value(), 4u);
+    }
+
+    UInt echoed = 0;
+    Array<UInt8, 16> buffer{ };
+    for (UInt i = 0; i < 100 && echoed < clients.size() * 4; i++) {
+        ASSERT_TRUE(reactor.Poll(std::chrono::milliseconds(10)).Ok());
+        for (auto& client: clients) {
+            if (auto read = client.Read(buffer); read.Ok()) {
+                echoed += read.Value();
+            }
+        }
+    }
+
+    EXPECT_EQ(echoed, clients.size() * 4);
+}
+
+TEST(Reactor, InvalidOptions)
+{
+    Echo handler;
+    auto created = Reactor::Create(handler, { .BufferCount = 1000 });
+    ASSERT_TRUE(created.Err());
+    EXPECT_EQ(created.Error().Errno(), EINVAL);
+}
@@ -0,0 +1,131 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/Socket/TcpListener.h>
+
+#include <fcntl.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto listenLoopback(SocketAddress::Type family = SocketAddress::Type::V4) -> socket::TcpListener
+{
+    auto address = family == SocketAddress::Type::V4 ? SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })
+                                                     : SocketAddress::V6({ ip::AddrV6::Localhost(), 0 });
+
+    auto listener = socket::TcpListener::Bind(address);
+    EXPECT_TRUE(listener.Ok()) << listener.Error();
+
+    return std::move(listener.Value());
+}
+
+} // namespace
+
+TEST(TcpListener, Accept)
+{
+    for (auto family: { SocketAddress::Type::V4, SocketAddress::Type::V6 }) {
+        auto listener = listenLoopback(family);
+
+        // nobody has connected yet
+        auto none = listener.Accept();
+        ASSERT_TRUE(none.Err());
+        EXPECT_TRUE(none.Error().WouldBlock());
+
+        auto client = socket::TcpStream::Connect(listener.LocalAddress().Value());
+        ASSERT_TRUE(client.Ok()) << client.Error();
+
+        auto accepted = listener.Accept();
+        ASSERT_TRUE(accepted.Ok()) << accepted.Error();
+        EXPECT_EQ(accepted.Value().Peer, client.Value().LocalAddress().Value());
+        EXPECT_EQ(accepted.Value().Stream.PeerAddress().Value(), accepted.Value().Peer);
+
+        const int fd = accepted.Value().Stream.AsDescriptor().Get();
+        EXPECT_NE(::fcntl(fd, F_GETFL) & O_NONBLOCK, 0);
+        EXPECT_NE(::fcntl(fd, F_GETFD) & FD_CLOEXEC, 0);
+    }
+}
+
+TEST(TcpListener, AcceptAll)
+{
+    auto listener = listenLoopback();
+    const auto address = listener.LocalAddress().Value();
+
+    Vec<socket::TcpStream> clients;
+    for (UInt i = 0; i < 5; i++) {
+        clients.push_back(std::move(socket::TcpStream::Connect(address).Value()));
+    }
+
+    Vec<SocketAddress> peers;
+    auto accepted = listener.AcceptAll([&](socket::TcpListener::Accepted&& connection) {
+        peers.push_back(connection.Peer);
+    });
+
+    ASSERT_TRUE(accepted.Ok()) << accepted.Error();
+    ASSERT_EQ(accepted.Value(), 5u);
+    for (UInt i = 0; i < clients.size(); i++) {
+        EXPECT_EQ(peers[i], clients[i].LocalAddress().Value());
+    }
+
+    // running out isn't an error
+    EXPECT_EQ(listener.AcceptAll([](auto&&) { }).Value(), 0u);
+
+    // and the limit is respected
+    for (UInt i = 0; i < 3; i++) {
+        clients.push_back(std::move(socket::TcpStream::Connect(address).Value()));
+    }
+
+    EXPECT_EQ(listener.AcceptAll([](auto&&) { }, 2).Value(), 2u);
+    EXPECT_EQ(listener.AcceptAll([](auto&&) { }).Value(), 1u);
+}
+
+TEST(TcpListener, ReusePort)
+{
+    socket::TcpListener::Options options;
+    options.ReusePort = true;
+
+    auto first = socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 }), options);
+    ASSERT_TRUE(first.Ok()) << first.Error();
+
+    const auto address = first.Value().LocalAddress().Value();
+    auto second = socket::TcpListener::Bind(address, options);
+    ASSERT_TRUE(second.Ok()) << second.Error();
+    EXPECT_EQ(second.Value().LocalAddress().Value(), address);
+
+    // every listener has to opt in
+    auto third = socket::TcpListener::Bind(address);
+    ASSERT_TRUE(third.Err());
+    EXPECT_EQ(third.Error().Errno(), EADDRINUSE);
+
+    // the connections are spread over both listeners, but each lands on exactly one
+    Vec<socket::TcpStream> clients;
+    for (UInt i = 0; i < 32; i++) {
+        clients.push_back(std::move(socket::TcpStream::Connect(address).Value()));
+    }
+
+    const UInt accepted = first.Value().AcceptAll([](auto&&) { }).Value()
+        + second.Value().AcceptAll([](auto&&) { }).Value();
+    EXPECT_EQ(accepted, clients.size());
+}
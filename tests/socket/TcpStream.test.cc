@@ -0,0 +1,127 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/Socket/TcpListener.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto bytesOf(Str text) -> Span<const UInt8>
+{
+    return { reinterpret_cast<const UInt8*>(text.data()), text.size() }; // NOLINT
+}
+
+auto textOf(Span<const UInt8> bytes) -> Str
+{
+    return { reinterpret_cast<const char*>(bytes.data()), bytes.size() }; // NOLINT
+}
+
+// A connected pair of streams over loopback; `Server` is non-blocking, `Client` isn't.
+struct Connection {
+    socket::TcpStream Client;
+    socket::TcpStream Server;
+
+    static auto Open() -> Connection
+    {
+        auto listener = std::move(socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })).Value());
+        auto client = std::move(socket::TcpStream::Connect(listener.LocalAddress().Value()).Value());
+        auto server = std::move(listener.Accept().Value());
+
+        return { std::move(client), std::move(server.Stream) };
+    }
+};
+
+} // namespace
+
+TEST(TcpStream, ReadAndWrite)
+{
+    auto connection = Connection::Open();
+
+    ASSERT_EQ(connection.Client.Write(bytesOf("hello")).Value(), 5u);
+    ASSERT_TRUE(connection.Server.SetNonBlocking(false).Ok());
+
+    Array<UInt8, 16> buffer{ };
+    auto read = connection.Server.Read(buffer);
+    ASSERT_TRUE(read.Ok()) << read.Error();
+    EXPECT_EQ(textOf(Span(buffer).first(read.Value())), "hello");
+
+    // a FIN reads as the end of the stream
+    ASSERT_TRUE(connection.Client.Shutdown(SHUT_WR).Ok());
+    EXPECT_EQ(connection.Server.Read(buffer).Value(), 0u);
+}
+
+TEST(TcpStream, NonBlockingRead)
+{
+    auto connection = Connection::Open();
+
+    Array<UInt8, 16> buffer{ };
+    auto read = connection.Server.Read(buffer);
+    ASSERT_TRUE(read.Err());
+    EXPECT_TRUE(read.Error().WouldBlock());
+}
+
+TEST(TcpStream, WriteToClosedPeer)
+{
+    auto connection = Connection::Open();
+    connection.Server = socket::TcpStream(socket::Descriptor());
+
+    // the first write can still succeed; the peer's reset makes a later one fail, without `SIGPIPE`
+    auto error = socket::SocketError(0);
+    for (UInt i = 0; i < 100 && error.Errno() == 0; i++) {
+        if (auto written = connection.Client.Write(bytesOf("data")); written.Err()) {
+            error = written.Error();
+        }
+    }
+
+    EXPECT_TRUE(error.Errno() == EPIPE || error.Errno() == ECONNRESET) << error;
+}
+
+TEST(TcpStream, Options)
+{
+    auto connection = Connection::Open();
+    const auto& fd = connection.Client.AsDescriptor();
+
+    ASSERT_TRUE(connection.Client.SetNoDelay(true).Ok());
+    EXPECT_NE(fd.GetOption(IPPROTO_TCP, TCP_NODELAY).Value(), 0);
+
+    ASSERT_TRUE(connection.Client.SetKeepAlive(true).Ok());
+    EXPECT_NE(fd.GetOption(SOL_SOCKET, SO_KEEPALIVE).Value(), 0);
+
+    const int raw = fd.Get();
+    auto released = std::move(connection.Client).IntoDescriptor();
+    EXPECT_EQ(released.Get(), raw);
+}
+
+TEST(TcpStream, ConnectRefused)
+{
+    // bind a port, then close it so that nothing listens on it
+    auto port = socket::TcpListener::Bind(SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })).Value().LocalAddress();
+    ASSERT_TRUE(port.Ok());
+
+    auto refused = socket::TcpStream::Connect(port.Value());
+    ASSERT_TRUE(refused.Err());
+    EXPECT_EQ(refused.Error().Errno(), ECONNREFUSED);
+}
@@ -0,0 +1,289 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Networking/Socket/UdpSocket.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::net;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto bindLoopback(SocketAddress::Type family = SocketAddress::Type::V4) -> socket::UdpSocket
+{
+    auto address = family == SocketAddress::Type::V4 ? SocketAddress::V4({ ip::AddrV4::Localhost(), 0 })
+                                                     : SocketAddress::V6({ ip::AddrV6::Localhost(), 0 });
+
+    auto socket = socket::UdpSocket::Bind(address);
+    EXPECT_TRUE(socket.Ok()) << socket.Error();
+
+    return std::move(socket.Value());
+}
+
+auto bytesOf(Str text) -> Span<const UInt8>
+{
+    return { reinterpret_cast<const UInt8*>(text.data()), text.size() }; // NOLINT
+}
+
+auto textOf(Span<const UInt8> bytes) -> Str
+{
+    return { reinterpret_cast<const char*>(bytes.data()), bytes.size() }; // NOLINT
+}
+
+} // namespace
+
+TEST(UdpSocket, SendToAndRecvFrom)
+{
+    for (auto family: { SocketAddress::Type::V4, SocketAddress::Type::V6 }) {
+        auto receiver = bindLoopback(family);
+        auto sender = bindLoopback(family);
+
+        ASSERT_EQ(sender.SendTo(bytesOf("hello"), receiver.LocalAddress().Value()).Value(), 5u);
+
+        Array<UInt8, 64> buffer{ };
+        auto peer = SocketAddress::V4({ });
+        ASSERT_EQ(receiver.RecvFrom(buffer, peer).Value(), 5u);
+        EXPECT_EQ(textOf(Span(buffer).first(5)), "hello");
+        EXPECT_EQ(peer, sender.LocalAddress().Value());
+    }
+}
+
+TEST(UdpSocket, ConnectedSendAndRecv)
+{
+    auto receiver = bindLoopback();
+    auto sender = bindLoopback();
+    ASSERT_TRUE(sender.Connect(receiver.LocalAddress().Value()).Ok());
+
+    ASSERT_EQ(sender.Send(bytesOf("ping")).Value(), 4u);
+
+    Array<UInt8, 2> small{ };
+    ASSERT_EQ(receiver.Recv(small).Value(), 2u); // truncated
+    EXPECT_EQ(textOf(small), "pi");
+}
+
+TEST(UdpSocket, RecvManyAndSendMany)
+{
+    auto receiver = bindLoopback();
+    auto first = bindLoopback();
+    auto second = bindLoopback();
+
+    const Array<Str, 3> texts = { "one", "two", "three" };
+    Array<Span<const UInt8>, 3> datagrams = { bytesOf(texts[0]), bytesOf(texts[1]), bytesOf(texts[2]) };
+    Vec<SocketAddress> to(3, receiver.LocalAddress().Value());
+
+    ASSERT_EQ(first.SendMany(Span(datagrams).first(2), to).Value(), 2u);
+    ASSERT_EQ(second.SendMany(Span(datagrams).last(1), to).Value(), 1u);
+
+    Array<Array<UInt8, 16>, 8> storage{ };
+    Array<Span<UInt8>, 8> buffers;
+    for (UInt i = 0; i < buffers.size(); i++) {
+        buffers[i] = storage[i];
+    }
+
+    Array<UInt, 8> sizes{ };
+    Vec<SocketAddress> peers(8, SocketAddress::V4({ }));
+
+    // loopback delivers synchronously, so all three are queued by now
+    ASSERT_TRUE(receiver.SetNonBlocking(true).Ok());
+    ASSERT_EQ(receiver.RecvMany(buffers, sizes, peers).Value(), 3u);
+
+    for (UInt i = 0; i < 3; i++) {
+        EXPECT_EQ(textOf(Span(storage[i]).first(sizes[i])), texts[i]);
+    }
+
+    EXPECT_EQ(peers[0], first.LocalAddress().Value());
+    EXPECT_EQ(peers[1], first.LocalAddress().Value());
+    EXPECT_EQ(peers[2], second.LocalAddress().Value());
+
+    // and nothing is left
+    auto empty = receiver.RecvMany(buffers, sizes, peers);
+    ASSERT_TRUE(empty.Err());
+    EXPECT_TRUE(empty.Error().WouldBlock());
+}
+
+TEST(UdpSocket, BatchesAreCapped)
+{
+    auto receiver = bindLoopback();
+    auto sender = bindLoopback();
+    ASSERT_TRUE(sender.Connect(receiver.LocalAddress().Value()).Ok());
+    ASSERT_TRUE(receiver.SetNonBlocking(true).Ok());
+
+    constexpr UInt kCount = socket::UdpSocket::kMaxBatch + 6;
+    Vec<UInt8> payload(kCount);
+    Vec<Span<const UInt8>> datagrams;
+    for (UInt i = 0; i < kCount; i++) {
+        payload[i] = static_cast<UInt8>(i);
+        datagrams.emplace_back(&payload[i], 1);
+    }
+
+    // connected, so no peers
+    ASSERT_EQ(sender.SendMany(datagrams).Value(), socket::UdpSocket::kMaxBatch);
+    ASSERT_EQ(sender.SendMany(Span(datagrams).subspan(socket::UdpSocket::kMaxBatch)).Value(), 6u);
+
+    Vec<UInt8> received(kCount);
+    Vec<Span<UInt8>> buffers;
+    for (UInt i = 0; i < kCount; i++) {
+        buffers.emplace_back(&received[i], 1);
+    }
+
+    Vec<UInt> sizes(kCount);
+    Vec<SocketAddress> peers(kCount, SocketAddress::V4({ }));
+
+    ASSERT_EQ(receiver.RecvMany(buffers, sizes, peers).Value(), socket::UdpSocket::kMaxBatch);
+    ASSERT_EQ(receiver.RecvMany(Span(buffers).subspan(socket::UdpSocket::kMaxBatch),
+                          Span(sizes).subspan(socket::UdpSocket::kMaxBatch),
+                          Span(peers).subspan(socket::UdpSocket::kMaxBatch))
+                  .Value(),
+        6u);
+
+    EXPECT_EQ(received, payload);
+}
+
+TEST(UdpSocket, BindErrors)
+{
+    auto socket = bindLoopback();
+    auto taken = socket::UdpSocket::Bind(socket.LocalAddress().Value());
+    ASSERT_TRUE(taken.Err());
+    EXPECT_EQ(taken.Error().Errno(), EADDRINUSE);
+}
+
+TEST(UdpSocket, SegmentedDatagram)
+{
+    Array<UInt8, 10> bytes{ };
+    socket::SegmentedDatagram datagram{ bytes, 4 };
+
+    ASSERT_EQ(datagram.Count(), 3u);
+    EXPECT_EQ(datagram.Segment(0).data(), bytes.data());
+    EXPECT_EQ(datagram.Segment(1).size(), 4u);
+    EXPECT_EQ(datagram.Segment(2).data(), bytes.data() + 8);
+    EXPECT_EQ(datagram.Segment(2).size(), 2u);
+
+    // not coalesced
+    socket::SegmentedDatagram single{ bytes, bytes.size() };
+    ASSERT_EQ(single.Count(), 1u);
+    EXPECT_EQ(single.Segment(0).size(), bytes.size());
+
+    socket::SegmentedDatagram empty{ Span<UInt8>(), 0 };
+    EXPECT_EQ(empty.Count(), 1u);
+    EXPECT_TRUE(empty.Segment(0).empty());
+}
+
+namespace {
+
+// 5 full segments and a short one, each filled with its index.
+constexpr UInt16 kSegmentSize = 1000;
+
+auto segmentedPayload() -> Vec<UInt8>
+{
+    Vec<UInt8> payload((kSegmentSize * 5) + 500);
+    for (UInt i = 0; i < payload.size(); i++) {
+        payload[i] = static_cast<UInt8>(i / kSegmentSize);
+    }
+
+    return payload;
+}
+
+} // namespace
+
+TEST(UdpSocket, SendSegmented)
+{
+    auto receiver = bindLoopback();
+    auto sender = bindLoopback();
+    ASSERT_TRUE(receiver.SetNonBlocking(true).Ok());
+
+    const auto payload = segmentedPayload();
+    auto sent = sender.SendSegmented(payload, kSegmentSize, receiver.LocalAddress().Value());
+    if (sent.Err() && (sent.Error().Errno() == ENOPROTOOPT || sent.Error().Errno() == EIO)) {
+        GTEST_SKIP() << "UDP GSO isn't supported: " << sent.Error();
+    }
+
+    ASSERT_EQ(sent.Value(), payload.size());
+
+    // without GRO, the receiver sees the datagrams that the kernel cut the buffer into
+    Vec<Array<UInt8, 2048>> storage(8);
+    Vec<Span<UInt8>> buffers(storage.begin(), storage.end());
+    Vec<UInt> sizes(8);
+    Vec<SocketAddress> peers(8, SocketAddress::V4({ }));
+
+    ASSERT_EQ(receiver.RecvMany(buffers, sizes, peers).Value(), 6u);
+    for (UInt i = 0; i < 6; i++) {
+        EXPECT_EQ(sizes[i], i < 5 ? kSegmentSize : 500u);
+        EXPECT_EQ(storage[i][0], i);
+        EXPECT_EQ(peers[i], sender.LocalAddress().Value());
+    }
+}
+
+TEST(UdpSocket, SendSegmentedChecksTheSegments)
+{
+    auto receiver = bindLoopback();
+    auto sender = bindLoopback();
+    ASSERT_TRUE(receiver.SetNonBlocking(true).Ok());
+
+    const Vec<UInt8> payload(socket::UdpSocket::kMaxSegments * 8 + 1);
+    const auto peer = receiver.LocalAddress().Value();
+
+    EXPECT_EQ(sender.SendSegmented(payload, 0, peer).Error().Errno(), EINVAL);
+    EXPECT_EQ(sender.SendSegmented(payload, 8, peer).Error().Errno(), EINVAL);
+
+    Array<UInt8, 16> buffer{ };
+    EXPECT_TRUE(receiver.Recv(buffer).Error().WouldBlock());
+}
+
+TEST(UdpSocket, RecvSegmentedWithGro)
+{
+    auto receiver = bindLoopback(SocketAddress::Type::V6);
+    auto sender = bindLoopback(SocketAddress::Type::V6);
+    ASSERT_TRUE(sender.Connect(receiver.LocalAddress().Value()).Ok());
+
+    if (auto gro = receiver.SetGro(true); gro.Err()) {
+        GTEST_SKIP() << "UDP GRO isn't supported: " << gro.Error();
+    }
+
+    const auto payload = segmentedPayload();
+    if (auto sent = sender.SendSegmented(payload, kSegmentSize); sent.Err()) {
+        GTEST_SKIP() << "UDP GSO isn't supported: " << sent.Error();
+    }
+
+    ASSERT_TRUE(receiver.SetNonBlocking(true).Ok());
+
+    // the kernel can hand the segments over in one piece or in several, but they add up to the payload
+    Vec<UInt8> buffer(65536);
+    Vec<UInt8> reassembled;
+    Vec<UInt> segmentSizes;
+    auto peer = SocketAddress::V4({ });
+
+    while (reassembled.size() < payload.size()) {
+        auto datagram = receiver.RecvSegmented(buffer, peer);
+        ASSERT_TRUE(datagram.Ok()) << datagram.Error();
+        EXPECT_EQ(peer, sender.LocalAddress().Value());
+
+        for (UInt i = 0; i < datagram.Value().Count(); i++) {
+            const auto segment = datagram.Value().Segment(i);
+            segmentSizes.push_back(segment.size());
+            reassembled.insert(reassembled.end(), segment.begin(), segment.end());
+        }
+    }
+
+    EXPECT_EQ(reassembled, payload);
+    EXPECT_EQ(segmentSizes, (Vec<UInt>{ 1000, 1000, 1000, 1000, 1000, 500 }));
+}
@@ -0,0 +1,290 @@
+// 🌺💜 Violet.Networking: C++20 library that provides networking primitives
+// Copyright (c) 2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Builds and inspects the table images of `<violet/Networking/IP/TableImage.h>`.
+//
+//     iptable build OUTPUT [INPUT...]    reads stdin without inputs
+//     iptable show IMAGE
+//     iptable lookup IMAGE ADDRESS...
+//
+// Every input line is a network (`10.0.0.0/8`), an address, or an inclusive range (`10.0.0.1-10.0.0.9`,
+// first address not after the last) to add to the address set, or a network followed by a label
+// (`10.0.0.0/8 private`) to add to the prefix table. Empty lines and lines starting with `#` are skipped.
+
+#include <violet/Networking/IPSet.h>
+#include <violet/Networking/IP/TableImage.h>
+#include <violet/Print.h>
+
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet;
+using namespace violet::net;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+constexpr Str kWhitespace = " \t\r";
+constexpr Str kNotAnEntry = "not a network, address or range";
+constexpr Str kReversedRange = "range ends before it starts";
+
+auto trim(Str input) noexcept -> Str
+{
+    const auto first = input.find_first_not_of(kWhitespace);
+    if (first == Str::npos) {
+        return { };
+    }
+
+    return input.substr(first, input.find_last_not_of(kWhitespace) - first + 1);
+}
+
+struct Builder final {
+    IPSet::Builder Set;
+    ip::detail::Dir24Table PrefixesV4;
+    ip::detail::TreeBitmapV6 PrefixesV6;
+    Vec<String> Labels;
+    std::unordered_map<String, UInt32> Ids;
+
+    // both tables share the label ids, so that an id means the same in either
+    auto idOf(Str label) -> UInt32
+    {
+        auto [it, inserted] = this->Ids.try_emplace(String(label), static_cast<UInt32>(this->Labels.size()));
+        if (inserted) {
+            this->Labels.emplace_back(label);
+        }
+
+        return it->second;
+    }
+
+    // Returns why `line` was rejected, if it was.
+    auto addLine(Str line) -> Optional<Str>
+    {
+        line = trim(line);
+        if (line.empty() || line.front() == '#') {
+            return Nothing;
+        }
+
+        const auto space = line.find_first_of(kWhitespace);
+        const Str entry = line.substr(0, space);
+        const Str label = space == Str::npos ? Str() : trim(line.substr(space));
+
+        if (const auto dash = entry.find('-'); dash != Str::npos && label.empty()) {
+            auto first = IPAddress::Parse(entry.substr(0, dash));
+            auto last = IPAddress::Parse(entry.substr(dash + 1));
+            if (!first || !last) {
+                return Some<Str>(kNotAnEntry);
+            }
+
+            // the set's builders only assert the order, and the input isn't trusted
+            if (auto v4 = first->AsV4(), lastV4 = last->AsV4(); v4 && lastV4) {
+                if (lastV4.Unwrap() < v4.Unwrap()) {
+                    return Some<Str>(kReversedRange);
+                }
+
+                this->Set.Add(v4.Unwrap(), lastV4.Unwrap());
+                return Nothing;
+            }
+
+            if (auto v6 = first->AsV6(), lastV6 = last->AsV6(); v6 && lastV6) {
+                if (lastV6.Unwrap() < v6.Unwrap()) {
+                    return Some<Str>(kReversedRange);
+                }
+
+                this->Set.Add(v6.Unwrap(), lastV6.Unwrap());
+                return Nothing;
+            }
+
+            return Some<Str>(kNotAnEntry);
+        }
+
+        auto network = IPNetwork::Parse(entry);
+        if (!network) {
+            return Some<Str>(kNotAnEntry);
+        }
+
+        if (label.empty()) {
+            this->Set.Add(network.Unwrap());
+        } else if (auto v4 = network->AsV4()) {
+            this->PrefixesV4.Insert(v4.Unwrap(), this->idOf(label));
+        } else {
+            this->PrefixesV6.Insert(network->AsV6().Unwrap(), this->idOf(label));
+        }
+
+        return Nothing;
+    }
+
+    auto addFile(Str name, std::istream& input) -> bool
+    {
+        std::string line;
+        for (UInt number = 1; std::getline(input, line); number++) {
+            if (auto error = this->addLine(line)) {
+                violet::PrintErrln("{}:{}: {}: {}", name, number, *error, trim(line));
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+auto build(CStr output, Span<char*> inputs) -> int
+{
+    Builder builder;
+    if (inputs.empty() && !builder.addFile("<stdin>", std::cin)) {
+        return 1;
+    }
+
+    for (CStr input: inputs) {
+        std::ifstream file(input);
+        if (!file) {
+            violet::PrintErrln("failed to open `{}`", input);
+            return 1;
+        }
+
+        if (!builder.addFile(input, file)) {
+            return 1;
+        }
+    }
+
+    const IPSet set = builder.Set.Build();
+    const Vec<Str> labels(builder.Labels.begin(), builder.Labels.end());
+
+    ip::TableImageWriter writer;
+    writer.SetV4(set.V4().AsView()).SetV6(set.V6().AsView()).Labels(labels);
+
+    // the prefix tables take 64 MiB for IPv4 even when empty, so they're only written if used
+    if (builder.PrefixesV4.Size() != 0) {
+        writer.PrefixesV4(builder.PrefixesV4.AsView());
+    }
+
+    if (builder.PrefixesV6.Size() != 0) {
+        writer.PrefixesV6(builder.PrefixesV6.AsView());
+    }
+
+    if (auto result = writer.WriteTo(output); !result) {
+        violet::PrintErrln("failed to write `{}`: {}", output, result.Error());
+        return 1;
+    }
+
+    return 0;
+}
+
+auto open(CStr path) -> Optional<ip::TableImage>
+{
+    auto image = ip::TableImage::Open(path);
+    if (!image) {
+        violet::PrintErrln("failed to open `{}`: {}", path, image.Error());
+        return Nothing;
+    }
+
+    if (auto verified = image->Verify(); !verified) {
+        violet::PrintErrln("failed to verify `{}`: {}", path, verified.Error());
+        return Nothing;
+    }
+
+    return Some<ip::TableImage>(std::move(image.Value()));
+}
+
+auto show(CStr path) -> int
+{
+    auto image = open(path);
+    if (!image) {
+        return 1;
+    }
+
+    violet::Println("=+= {} ({} bytes) =+=", path, image->Bytes().size());
+    if (auto set = image->SetV4()) {
+        violet::Println("|> IPv4 set:      {} ranges", set->Size());
+    }
+
+    if (auto set = image->SetV6()) {
+        violet::Println("|> IPv6 set:      {} ranges", set->Size());
+    }
+
+    if (auto table = image->PrefixesV4()) {
+        violet::Println("|> IPv4 prefixes: {}", table->Size());
+    }
+
+    if (auto table = image->PrefixesV6()) {
+        violet::Println("|> IPv6 prefixes: {}", table->Size());
+    }
+
+    return 0;
+}
+
+auto lookup(CStr path, Span<char*> addresses) -> int
+{
+    auto image = open(path);
+    if (!image) {
+        return 1;
+    }
+
+    for (CStr input: addresses) {
+        auto address = IPAddress::Parse(input);
+        if (!address) {
+            violet::PrintErrln("not an IP address: {}", input);
+            return 1;
+        }
+
+        bool inSet = false;
+        UInt32 id = ip::detail::Dir24Table::kNoMatch;
+        if (auto v4 = address->AsV4()) {
+            inSet = image->SetV4() && image->SetV4()->Contains(v4.Unwrap());
+            id = image->PrefixesV4() ? image->PrefixesV4()->Lookup(v4.Unwrap()) : id;
+        } else {
+            const auto& v6 = address->AsV6().Unwrap();
+            inSet = image->SetV6() && image->SetV6()->Contains(v6);
+            id = image->PrefixesV6() ? image->PrefixesV6()->Lookup(v6) : id;
+        }
+
+        auto label = image->Label(id);
+        violet::Println("{}: {}, {}", input, inSet ? "in set" : "not in set", label ? label.Unwrap() : "no prefix");
+    }
+
+    return 0;
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    const Span<char*> args(argv, static_cast<UInt>(argc));
+    const Str command = args.size() > 1 ? args[1] : "";
+
+    if (command == "build" && args.size() >= 3) {
+        return build(args[2], args.subspan(3));
+    }
+
+    if (command == "show" && args.size() == 3) {
+        return show(args[2]);
+    }
+
+    if (command == "lookup" && args.size() >= 4) {
+        return lookup(args[2], args.subspan(3));
+    }
+
+    violet::PrintErrln("usage: iptable build OUTPUT [INPUT...]");
+    violet::PrintErrln("       iptable show IMAGE");
+    violet::PrintErrln("       iptable lookup IMAGE ADDRESS...");
+    return 2;
+}